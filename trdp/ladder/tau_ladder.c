@@ -17,6 +17,10 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: tau_linkResync: re-read the link states after a netlink overrun (ENOBUFS)
+ *      AG 2026-10-18: Link state from an event driven link monitor (rtnetlink) instead of ioctl polling
+ *      AG 2026-10-18: Read sections (tau_beginReadTrafficStore/tau_retryReadTrafficStore) for reading in place
+ *      AG 2026-10-18: Per slot sequence counters (seqlock) for lock-free Traffic Store access
  */
 
 #ifdef TRDP_OPTION_LADDER
@@ -24,11 +28,14 @@
  * INCLUDES
  */
 #include <string.h>
+#include <errno.h>
 
 #include <sys/ioctl.h>
 #include <netinet/in.h>
 #ifdef __linux
 #   include <linux/if.h>
+#   include <linux/netlink.h>
+#   include <linux/rtnetlink.h>
 #else
 #include <net/if.h>
 #endif
@@ -45,6 +52,8 @@
 /*******************************************************************************
  * DEFINES
  */
+#define TRAFFIC_STORE_SPIN_CNT  64u             /* busy loops on a slot before yielding the CPU */
+#define LINK_MONITOR_BUF_SIZE   8192u           /* rtnetlink receive buffer */
 
 /*******************************************************************************
  * TYPEDEFS
@@ -54,6 +63,17 @@
  *   Locals
  */
 
+/* Link monitor */
+#ifdef __linux
+static CHAR8 linkIfName[LINK_MONITOR_IF_CNT][IFNAMSIZ] = {"eth0", "eth1"};  /* interface of subnet1, subnet2 */
+#else
+static CHAR8 linkIfName[LINK_MONITOR_IF_CNT][IFNAMSIZ] = {"en0", "en1"};    /* interface of subnet1, subnet2 */
+#endif
+static UINT32 linkUpState[LINK_MONITOR_IF_CNT];           /* reported link state, accessed atomically */
+static UINT32 linkEventPending = 0u;                      /* a link changed since tau_getLinkEvent */
+static const TAU_LINK_MONITOR_T *pLinkMonitor = NULL;     /* open backend, NULL: link state is polled */
+static const TAU_LINK_MONITOR_T *pLinkMonitorSelected = NULL;   /* backend set by tau_setLinkMonitor */
+
 /******************************************************************************
  *   Globals
  */
@@ -68,6 +88,7 @@ mode_t PERMISSION     = 0666;                                /* Traffic Store pe
 UINT8 *pTrafficStoreAddr;                                /* pointer to pointer to Traffic Store Address */
 VOS_SHRD_T  pTrafficStoreHandle;                        /* Pointer to Traffic Store Handle */
 UINT16 TRAFFIC_STORE_MUTEX_VALUE_AREA = 0xFF00;        /* Traffic Store mutex ID Area */
+UINT32 *pTrafficStoreSeq = NULL;                        /* Sequence counters of the Traffic Store slots */
 
 /* PDComLadderThread */
 //CHAR8 pdComLadderThreadName[] ="PDComLadderThread";        /* Thread name is PDComLadder Thread. */
@@ -92,7 +113,8 @@ TRDP_ERR_T tau_ladder_init (void)
     extern CHAR8 TRAFFIC_STORE[];                    /* Traffic Store shared memory name */
     extern VOS_SHRD_T  pTrafficStoreHandle;                /* Pointer to Traffic Store Handle */
     extern UINT8 *pTrafficStoreAddr;                /* pointer to pointer to Traffic Store Address */
-    UINT32 trafficStoreSize = TRAFFIC_STORE_SIZE;    /* Traffic Store Size : 64KB */
+    UINT32 trafficStoreSize = TRAFFIC_STORE_SIZE
+                              + TRAFFIC_STORE_SLOT_CNT * sizeof(UINT32);    /* Traffic Store 64KB + counters */
 
 #if 0
     /* PDComLadderThread */
@@ -168,6 +190,10 @@ TRDP_ERR_T tau_ladder_init (void)
         pTrafficStoreHandle->sharedMemoryName = TRAFFIC_STORE;
     }
 
+    /* The slot sequence counters follow the Traffic Store, all slots are idle (even) */
+    pTrafficStoreSeq = (UINT32 *)(pTrafficStoreAddr + TRAFFIC_STORE_SIZE);
+    memset(pTrafficStoreSeq, 0, TRAFFIC_STORE_SLOT_CNT * sizeof(UINT32));
+
     /* Traffic Store Mutex unlock */
     vos_mutexUnlock(pTrafficStoreMutex);
 /*    if ((vos_mutexUnlock(pTrafficStoreMutex)) != VOS_NO_ERR)
@@ -231,6 +257,7 @@ TRDP_ERR_T tau_ladder_terminate (void)
 
     /* Delete Traffic Store */
     tau_lockTrafficStore();
+    pTrafficStoreSeq = NULL;                            /* the counters are unmapped with the Traffic Store */
     if (vos_sharedClose(pTrafficStoreHandle, pTrafficStoreAddr) != VOS_NO_ERR)
     {
         vos_printLog(VOS_LOG_ERROR, "Release Traffic Store shared memory failed\n");
@@ -313,7 +340,85 @@ TRDP_ERR_T  tau_getNetworkContext (
 }
 
 /**********************************************************************************************************************/
-/** Get Traffic Store accessibility.
+/** Check a Traffic Store area and get its slots.
+ *
+ *  @param[in]      offset              Traffic Store offset
+ *  @param[in]      size                number of bytes, > 0
+ *  @param[out]     pFirst              first slot
+ *  @param[out]     pLast               last slot
+ *
+ *  @retval         TRUE                area is inside the Traffic Store
+ */
+static BOOL8 tau_trafficStoreSlots (
+    UINT16  offset,
+    UINT32  size,
+    UINT32  *pFirst,
+    UINT32  *pLast)
+{
+    if ((pTrafficStoreSeq == NULL) || (size == 0u) || (size > (TRAFFIC_STORE_SIZE - (UINT32)offset)))
+    {
+        return FALSE;
+    }
+    *pFirst = (UINT32)offset / TRAFFIC_STORE_SLOT_SIZE;
+    *pLast  = ((UINT32)offset + size - 1u) / TRAFFIC_STORE_SLOT_SIZE;
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Mark slots as being written: an odd sequence counter is owned by one writer.
+ *  Slots are taken in ascending order, so writers of overlapping areas cannot deadlock.
+ *
+ *  @param[in]      first               first slot
+ *  @param[in]      last                last slot
+ */
+static void tau_trafficStoreWriteLock (
+    UINT32  first,
+    UINT32  last)
+{
+    UINT32  slot;
+    UINT32  seq;
+    UINT32  spin;
+
+    for (slot = first; slot <= last; slot++)
+    {
+        for (spin = 0u;; spin++)
+        {
+            seq = __atomic_load_n(&pTrafficStoreSeq[slot], __ATOMIC_RELAXED);
+            if (((seq & 1u) == 0u)
+                && __atomic_compare_exchange_n(&pTrafficStoreSeq[slot], &seq, seq + 1u, FALSE,
+                                               __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+            if (spin >= TRAFFIC_STORE_SPIN_CNT)
+            {
+                (void) vos_threadDelay(0u);
+            }
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/** Release slots after writing, the data becomes visible to the readers.
+ *
+ *  @param[in]      first               first slot
+ *  @param[in]      last                last slot
+ */
+static void tau_trafficStoreWriteUnlock (
+    UINT32  first,
+    UINT32  last)
+{
+    UINT32 slot;
+
+    for (slot = first; slot <= last; slot++)
+    {
+        (void) __atomic_fetch_add(&pTrafficStoreSeq[slot], 1u, __ATOMIC_RELEASE);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Get exclusive Traffic Store accessibility.
+ *  Waits for running slot writers and blocks all slot readers and writers until tau_unlockTrafficStore.
  *
  *  @retval         TRDP_NO_ERR            no error
  *  @retval         TRDP_MUTEX_ERR        mutex error
@@ -331,6 +436,11 @@ TRDP_ERR_T  tau_lockTrafficStore (
         vos_printLog(VOS_LOG_ERROR, "TRDP Traffic Store Mutex Lock failed\n");
         return TRDP_MUTEX_ERR;
     }
+    /* Own all slots */
+    if (pTrafficStoreSeq != NULL)
+    {
+        tau_trafficStoreWriteLock(0u, TRAFFIC_STORE_SLOT_CNT - 1u);
+    }
     return TRDP_NO_ERR;
 }
 
@@ -346,6 +456,10 @@ TRDP_ERR_T  tau_unlockTrafficStore (
 {
     extern VOS_MUTEX_T pTrafficStoreMutex;                            /* pointer to Mutex for Traffic Store */
 
+    if (pTrafficStoreSeq != NULL)
+    {
+        tau_trafficStoreWriteUnlock(0u, TRAFFIC_STORE_SLOT_CNT - 1u);
+    }
     /* Lock Traffic Store by Mutex */
     vos_mutexUnlock(pTrafficStoreMutex);
 /*    if (vos_mutexUnlock(pTrafficStoreMutex) != VOS_NO_ERR)
@@ -358,52 +472,238 @@ TRDP_ERR_T  tau_unlockTrafficStore (
 }
 
 /**********************************************************************************************************************/
-/** Check Link up/down
+/** Start a lock-free read section of a Traffic Store area.
+ *  Waits while a writer owns one of the slots and returns the sequence of the area.
+ *  The counters only grow, so their sum identifies the state of the area.
  *
- *  @param[in]        checkSubnetId            check Sub-network Id
- *  @param[out]        pLinkUpDown          pointer to check Sub-network Id Link Up Down TRUE:Up, FALSE:Down
+ *  @param[in]      offset              Traffic Store offset
+ *  @param[in]      size                number of bytes to read
+ *  @param[out]     pSeq                sequence to pass to tau_retryReadTrafficStore
  *
- *  @retval         TRDP_NO_ERR                no error
- *  @retval         TRDP_PARAM_ERR            parameter err
- *  @retval         TRDP_SOCK_ERR            socket err
+ *  @retval         TRDP_NO_ERR            no error
+ *  @retval         TRDP_PARAM_ERR        area outside the Traffic Store
+ */
+TRDP_ERR_T  tau_beginReadTrafficStore (
+    UINT16  offset,
+    UINT32  size,
+    UINT64  *pSeq)
+{
+    UINT32  first;
+    UINT32  last;
+    UINT32  slot;
+    UINT32  seq;
+    UINT32  spin;
+    UINT64  sum;
+
+    if ((pSeq == NULL) || (tau_trafficStoreSlots(offset, size, &first, &last) == FALSE))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    for (spin = 0u;; spin++)
+    {
+        sum = 0u;
+        for (slot = first; slot <= last; slot++)
+        {
+            seq = __atomic_load_n(&pTrafficStoreSeq[slot], __ATOMIC_ACQUIRE);
+            if ((seq & 1u) != 0u)
+            {
+                break;
+            }
+            sum += seq;
+        }
+        if (slot > last)
+        {
+            *pSeq = sum;
+            return TRDP_NO_ERR;
+        }
+        if (spin >= TRAFFIC_STORE_SPIN_CNT)
+        {
+            (void) vos_threadDelay(0u);
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/** End a lock-free read section of a Traffic Store area.
  *
+ *  @param[in]      offset              Traffic Store offset
+ *  @param[in]      size                number of bytes read
+ *  @param[in]      seq                 sequence from tau_beginReadTrafficStore
  *
+ *  @retval         TRUE                a writer changed the area meanwhile, the data must be read again
+ *  @retval         FALSE               the data read is consistent
  */
-static int ifGetSocket = 0;
+BOOL8  tau_retryReadTrafficStore (
+    UINT16  offset,
+    UINT32  size,
+    UINT64  seq)
+{
+    UINT32  first;
+    UINT32  last;
+    UINT32  slot;
+    UINT64  sum = 0u;
 
-TRDP_ERR_T  tau_checkLinkUpDown (
-    UINT32 checkSubnetId,
-    BOOL8 *pLinkUpDown)
+    if (tau_trafficStoreSlots(offset, size, &first, &last) == FALSE)
+    {
+        return FALSE;
+    }
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    for (slot = first; slot <= last; slot++)
+    {
+        sum += __atomic_load_n(&pTrafficStoreSeq[slot], __ATOMIC_RELAXED);
+    }
+    return (sum != seq) ? TRUE : FALSE;
+}
+
+/**********************************************************************************************************************/
+/** Read a consistent snapshot of a Traffic Store area without locking.
+ *  Seqlock read: the copy is repeated until no writer of the same slots was active meanwhile.
+ *
+ *  @param[in]      offset              Traffic Store offset
+ *  @param[out]     pData               buffer for the data
+ *  @param[in]      size                number of bytes to read
+ *
+ *  @retval         TRDP_NO_ERR            no error
+ *  @retval         TRDP_PARAM_ERR        area outside the Traffic Store
+ */
+TRDP_ERR_T  tau_readTrafficStore (
+    UINT16  offset,
+    UINT8   *pData,
+    UINT32  size)
 {
-    struct ifreq ifRead;
-    CHAR8 SUBNETWORK_ID1_IF_NAME[] = "eth0";
-    CHAR8 SUBNETWORK_ID2_IF_NAME[] = "eth1";
+    UINT64 seq;
 
-    /* Parameter Check */
-    if (pLinkUpDown == NULL)
+    if (size == 0u)
+    {
+        return TRDP_NO_ERR;
+    }
+    if (pData == NULL)
     {
-        vos_printLog(VOS_LOG_ERROR, "tau_checkLinkUpDown pLinkUpDown parameter err\n");
         return TRDP_PARAM_ERR;
     }
 
-    memset(&ifRead, 0, sizeof(ifRead));
+    do
+    {
+        if (tau_beginReadTrafficStore(offset, size, &seq) != TRDP_NO_ERR)
+        {
+            return TRDP_PARAM_ERR;
+        }
+        memcpy(pData, pTrafficStoreAddr + offset, size);
+    }
+    while (tau_retryReadTrafficStore(offset, size, seq) == TRUE);
+
+    return TRDP_NO_ERR;
+}
 
-    /* Check I/F setting */
-    if (checkSubnetId == SUBNET1)
+/**********************************************************************************************************************/
+/** Write a Traffic Store area.
+ *
+ *  @param[in]      offset              Traffic Store offset
+ *  @param[in]      pData               data to write, NULL to clear the area
+ *  @param[in]      size                number of bytes to write
+ *
+ *  @retval         TRDP_NO_ERR            no error
+ *  @retval         TRDP_PARAM_ERR        area outside the Traffic Store
+ */
+TRDP_ERR_T  tau_writeTrafficStore (
+    UINT16      offset,
+    const UINT8 *pData,
+    UINT32      size)
+{
+    UINT32  first;
+    UINT32  last;
+
+    if (size == 0u)
     {
-        /* Set I/F subnet1 */
-        strncpy(ifRead.ifr_name, SUBNETWORK_ID1_IF_NAME, IFNAMSIZ-1);
+        return TRDP_NO_ERR;
     }
-    else if (checkSubnetId == SUBNET2)
+    if (tau_trafficStoreSlots(offset, size, &first, &last) == FALSE)
     {
-        /* Set I/F subnet2 */
-        strncpy(ifRead.ifr_name, SUBNETWORK_ID2_IF_NAME, IFNAMSIZ-1);
+        return TRDP_PARAM_ERR;
+    }
+
+    tau_trafficStoreWriteLock(first, last);
+    if (pData == NULL)
+    {
+        memset(pTrafficStoreAddr + offset, 0, size);
     }
     else
     {
-        vos_printLog(VOS_LOG_ERROR, "tau_checkLinkUpDown Check SubnetId failed\n");
+        memcpy(pTrafficStoreAddr + offset, pData, size);
+    }
+    tau_trafficStoreWriteUnlock(first, last);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Start writing a Traffic Store area in place.
+ *
+ *  @param[in]      offset              Traffic Store offset
+ *  @param[in]      size                number of bytes to be written
+ *
+ *  @retval         TRDP_NO_ERR            no error
+ *  @retval         TRDP_PARAM_ERR        area outside the Traffic Store
+ */
+TRDP_ERR_T  tau_beginWriteTrafficStore (
+    UINT16  offset,
+    UINT32  size)
+{
+    UINT32  first;
+    UINT32  last;
+
+    if (tau_trafficStoreSlots(offset, size, &first, &last) == FALSE)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    tau_trafficStoreWriteLock(first, last);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Finish writing a Traffic Store area.
+ *
+ *  @param[in]      offset              Traffic Store offset
+ *  @param[in]      size                number of bytes written
+ *
+ *  @retval         TRDP_NO_ERR            no error
+ *  @retval         TRDP_PARAM_ERR        area outside the Traffic Store
+ */
+TRDP_ERR_T  tau_endWriteTrafficStore (
+    UINT16  offset,
+    UINT32  size)
+{
+    UINT32  first;
+    UINT32  last;
+
+    if (tau_trafficStoreSlots(offset, size, &first, &last) == FALSE)
+    {
         return TRDP_PARAM_ERR;
     }
+    tau_trafficStoreWriteUnlock(first, last);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Get the link state of an interface by ioctl
+ *
+ *  @param[in]      pIfName             interface name
+ *  @param[out]     pLinkUp             TRUE: up and running
+ *
+ *  @retval         TRDP_NO_ERR                no error
+ *  @retval         TRDP_SOCK_ERR            socket err
+ */
+static int ifGetSocket = 0;
+
+static TRDP_ERR_T tau_getIfLinkState (
+    const CHAR8 *pIfName,
+    BOOL8       *pLinkUp)
+{
+    struct ifreq ifRead;
+
+    memset(&ifRead, 0, sizeof(ifRead));
+    strncpy(ifRead.ifr_name, pIfName, IFNAMSIZ-1);
 
     if (ifGetSocket <= 0)
     {
@@ -428,19 +728,176 @@ TRDP_ERR_T  tau_checkLinkUpDown (
         && ((ifRead.ifr_ifru.ifru_flags & IFF_RUNNING) == IFF_RUNNING))
     {
         /* Link Up */
-        *pLinkUpDown = TRUE;
+        *pLinkUp = TRUE;
     }
     else
     {
         /* Link Down */
-        *pLinkUpDown = FALSE;
+        *pLinkUp = FALSE;
+    }
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Index of a Sub-network in the link monitor tables
+ *
+ *  @param[in]      subnetId            Sub-network Id: SUBNET1 or SUBNET2
+ *
+ *  @retval         index, LINK_MONITOR_IF_CNT for an unknown Sub-network
+ */
+static UINT32 tau_linkIndex (
+    UINT32 subnetId)
+{
+    if (subnetId == SUBNET1)
+    {
+        return 0u;
     }
+    else if (subnetId == SUBNET2)
+    {
+        return 1u;
+    }
+    return LINK_MONITOR_IF_CNT;
+}
 
-//    close(ifGetSocket);
+#ifdef __linux
+/**********************************************************************************************************************/
+/** rtnetlink link monitor backend */
+static int linkMonitorSocket = -1;
+
+static TRDP_ERR_T tau_netlinkOpen (void)
+{
+    struct sockaddr_nl addr;
 
+    linkMonitorSocket = socket(AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (linkMonitorSocket == -1)
+    {
+        vos_printLog(VOS_LOG_ERROR, "Link monitor netlink socket err.\n");
+        return TRDP_SOCK_ERR;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family  = AF_NETLINK;
+    addr.nl_groups  = RTMGRP_LINK;
+    if (bind(linkMonitorSocket, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        vos_printLog(VOS_LOG_ERROR, "Link monitor netlink bind err.\n");
+        close(linkMonitorSocket);
+        linkMonitorSocket = -1;
+        return TRDP_SOCK_ERR;
+    }
     return TRDP_NO_ERR;
 }
 
+static INT32 tau_netlinkGetFd (void)
+{
+    return (INT32)linkMonitorSocket;
+}
+
+static void tau_netlinkProcess (void)
+{
+    UINT32              buf[LINK_MONITOR_BUF_SIZE / sizeof(UINT32)];
+    struct nlmsghdr     *pHdr;
+    struct ifinfomsg    *pIfInfo;
+    struct rtattr       *pAttr;
+    const CHAR8         *pName;
+    int                 len;
+    int                 attrLen;
+
+    for (;;)
+    {
+        len = (int)recv(linkMonitorSocket, buf, sizeof(buf), 0);
+        if (len <= 0)
+        {
+            if ((len < 0) && (errno == ENOBUFS))
+            {
+                /* The socket buffer overran, events are lost: the queue goes on after the gap */
+                vos_printLog(VOS_LOG_WARNING, "Link monitor netlink overrun, link states re-read\n");
+                tau_linkResync();
+                continue;
+            }
+            break;
+        }
+        for (pHdr = (struct nlmsghdr *)buf; NLMSG_OK(pHdr, (unsigned int)len); pHdr = NLMSG_NEXT(pHdr, len))
+        {
+            if ((pHdr->nlmsg_type != RTM_NEWLINK) && (pHdr->nlmsg_type != RTM_DELLINK))
+            {
+                continue;
+            }
+            pIfInfo = (struct ifinfomsg *)NLMSG_DATA(pHdr);
+            pName   = NULL;
+            attrLen = (int)IFLA_PAYLOAD(pHdr);
+            for (pAttr = IFLA_RTA(pIfInfo); RTA_OK(pAttr, attrLen); pAttr = RTA_NEXT(pAttr, attrLen))
+            {
+                if (pAttr->rta_type == IFLA_IFNAME)
+                {
+                    pName = (const CHAR8 *)RTA_DATA(pAttr);
+                    break;
+                }
+            }
+            if (pName != NULL)
+            {
+                tau_linkEvent(pName,
+                              ((pHdr->nlmsg_type == RTM_NEWLINK)
+                               && ((pIfInfo->ifi_flags & IFF_UP) == IFF_UP)
+                               && ((pIfInfo->ifi_flags & IFF_RUNNING) == IFF_RUNNING)) ? TRUE : FALSE);
+            }
+        }
+    }
+}
+
+static void tau_netlinkClose (void)
+{
+    if (linkMonitorSocket != -1)
+    {
+        close(linkMonitorSocket);
+        linkMonitorSocket = -1;
+    }
+}
+
+static const TAU_LINK_MONITOR_T netlinkMonitor =
+{
+    tau_netlinkOpen, tau_netlinkGetFd, tau_netlinkProcess, tau_getIfLinkState, tau_netlinkClose
+};
+#endif /* __linux */
+
+/**********************************************************************************************************************/
+/** Check Link up/down
+ *  With an open link monitor the state reported by its events is returned, otherwise the interface is asked.
+ *
+ *  @param[in]        checkSubnetId            check Sub-network Id
+ *  @param[out]        pLinkUpDown          pointer to check Sub-network Id Link Up Down TRUE:Up, FALSE:Down
+ *
+ *  @retval         TRDP_NO_ERR                no error
+ *  @retval         TRDP_PARAM_ERR            parameter err
+ *  @retval         TRDP_SOCK_ERR            socket err
+ *
+ *
+ */
+TRDP_ERR_T  tau_checkLinkUpDown (
+    UINT32 checkSubnetId,
+    BOOL8 *pLinkUpDown)
+{
+    UINT32 index = tau_linkIndex(checkSubnetId);
+
+    /* Parameter Check */
+    if (pLinkUpDown == NULL)
+    {
+        vos_printLog(VOS_LOG_ERROR, "tau_checkLinkUpDown pLinkUpDown parameter err\n");
+        return TRDP_PARAM_ERR;
+    }
+    if (index >= LINK_MONITOR_IF_CNT)
+    {
+        vos_printLog(VOS_LOG_ERROR, "tau_checkLinkUpDown Check SubnetId failed\n");
+        return TRDP_PARAM_ERR;
+    }
+
+    if (pLinkMonitor != NULL)
+    {
+        *pLinkUpDown = (__atomic_load_n(&linkUpState[index], __ATOMIC_ACQUIRE) != 0u) ? TRUE : FALSE;
+        return TRDP_NO_ERR;
+    }
+    return tau_getIfLinkState(linkIfName[index], pLinkUpDown);
+}
+
 /**********************************************************************************************************************/
 /** Close check Link up/down
  *
@@ -450,6 +907,7 @@ TRDP_ERR_T  tau_checkLinkUpDown (
 
 TRDP_ERR_T  tau_closeCheckLinkUpDown (void)
 {
+    tau_closeLinkMonitor();
     if (ifGetSocket)
     {
         close(ifGetSocket);
@@ -458,4 +916,239 @@ TRDP_ERR_T  tau_closeCheckLinkUpDown (void)
     return TRDP_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Set the interface name of a Sub-network
+ *
+ *  @param[in]      subnetId            Sub-network Id: SUBNET1 or SUBNET2
+ *  @param[in]      pIfName             interface name
+ *
+ *  @retval         TRDP_NO_ERR                no error
+ *  @retval         TRDP_PARAM_ERR            parameter err
+ */
+TRDP_ERR_T  tau_setLinkIfName (
+    UINT32      subnetId,
+    const CHAR8 *pIfName)
+{
+    UINT32  index = tau_linkIndex(subnetId);
+    BOOL8   linkUp;
+
+    if ((index >= LINK_MONITOR_IF_CNT) || (pIfName == NULL)
+        || (pIfName[0] == 0) || (strlen(pIfName) >= IFNAMSIZ))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    strncpy(linkIfName[index], pIfName, IFNAMSIZ - 1);
+
+    /* a monitored interface was exchanged: start with its current state */
+    if ((pLinkMonitor != NULL)
+        && (pLinkMonitor->pfGetState(linkIfName[index], &linkUp) == TRDP_NO_ERR))
+    {
+        __atomic_store_n(&linkUpState[index], (linkUp == TRUE) ? 1u : 0u, __ATOMIC_RELEASE);
+        __atomic_store_n(&linkEventPending, 1u, __ATOMIC_RELEASE);
+    }
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Get the interface name of a Sub-network
+ *
+ *  @param[in]      subnetId            Sub-network Id: SUBNET1 or SUBNET2
+ *
+ *  @retval         interface name, NULL for an unknown Sub-network
+ */
+const CHAR8 *tau_getLinkIfName (
+    UINT32 subnetId)
+{
+    UINT32 index = tau_linkIndex(subnetId);
+
+    return (index < LINK_MONITOR_IF_CNT) ? linkIfName[index] : NULL;
+}
+
+/**********************************************************************************************************************/
+/** Select the link monitor backend
+ *
+ *  @param[in]      pMonitor            backend, NULL for the default
+ *
+ *  @retval         TRDP_NO_ERR                no error
+ *  @retval         TRDP_STATE_ERR            link monitor is open
+ */
+TRDP_ERR_T  tau_setLinkMonitor (
+    const TAU_LINK_MONITOR_T *pMonitor)
+{
+    if (pLinkMonitor != NULL)
+    {
+        return TRDP_STATE_ERR;
+    }
+    pLinkMonitorSelected = pMonitor;
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Start the link monitor
+ *
+ *  @retval         TRDP_NO_ERR                no error
+ *  @retval         TRDP_SOCK_ERR            backend could not be opened, the link state is polled
+ */
+TRDP_ERR_T  tau_openLinkMonitor (
+    void)
+{
+    const TAU_LINK_MONITOR_T    *pMonitor = pLinkMonitorSelected;
+    TRDP_ERR_T                  err;
+    UINT32                      index;
+    BOOL8                       linkUp;
+
+    if (pLinkMonitor != NULL)
+    {
+        return TRDP_NO_ERR;
+    }
+#ifdef __linux
+    if (pMonitor == NULL)
+    {
+        pMonitor = &netlinkMonitor;
+    }
+#endif
+    if (pMonitor == NULL)
+    {
+        return TRDP_SOCK_ERR;
+    }
+
+    err = pMonitor->pfOpen();
+    if (err != TRDP_NO_ERR)
+    {
+        return err;
+    }
+    /* Events arriving from now on are queued, the initial state cannot be overtaken */
+    for (index = 0u; index < LINK_MONITOR_IF_CNT; index++)
+    {
+        linkUp = FALSE;
+        (void) pMonitor->pfGetState(linkIfName[index], &linkUp);
+        __atomic_store_n(&linkUpState[index], (linkUp == TRUE) ? 1u : 0u, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&linkEventPending, 1u, __ATOMIC_RELAXED);
+    __atomic_store_n(&pLinkMonitor, pMonitor, __ATOMIC_RELEASE);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Stop the link monitor
+ */
+void  tau_closeLinkMonitor (
+    void)
+{
+    const TAU_LINK_MONITOR_T *pMonitor = __atomic_exchange_n(&pLinkMonitor, NULL, __ATOMIC_ACQ_REL);
+
+    if (pMonitor != NULL)
+    {
+        pMonitor->pfClose();
+    }
+}
+
+/**********************************************************************************************************************/
+/** Descriptor of the link monitor to select() on
+ *
+ *  @retval         descriptor, -1 if there is none
+ */
+INT32  tau_getLinkMonitorFd (
+    void)
+{
+    const TAU_LINK_MONITOR_T *pMonitor = __atomic_load_n(&pLinkMonitor, __ATOMIC_ACQUIRE);
+
+    return (pMonitor != NULL) ? pMonitor->pfGetFd() : -1;
+}
+
+/**********************************************************************************************************************/
+/** Read the pending events of the link monitor
+ */
+void  tau_processLinkMonitor (
+    void)
+{
+    const TAU_LINK_MONITOR_T *pMonitor = __atomic_load_n(&pLinkMonitor, __ATOMIC_ACQUIRE);
+
+    if (pMonitor != NULL)
+    {
+        pMonitor->pfProcess();
+    }
+}
+
+/**********************************************************************************************************************/
+/** Report a link state
+ *
+ *  @param[in]      pIfName             interface name
+ *  @param[in]      linkUp              TRUE: up and running
+ */
+void  tau_linkEvent (
+    const CHAR8 *pIfName,
+    BOOL8       linkUp)
+{
+    UINT32 index;
+    UINT32 state = (linkUp == TRUE) ? 1u : 0u;
+
+    if (pIfName == NULL)
+    {
+        return;
+    }
+    for (index = 0u; index < LINK_MONITOR_IF_CNT; index++)
+    {
+        if ((strncmp(linkIfName[index], pIfName, IFNAMSIZ) == 0)
+            && (__atomic_exchange_n(&linkUpState[index], state, __ATOMIC_ACQ_REL) != state))
+        {
+            __atomic_store_n(&linkEventPending, 1u, __ATOMIC_RELEASE);
+            vos_printLog(VOS_LOG_INFO, "Link %s %s\n", pIfName, (linkUp == TRUE) ? "up" : "down");
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/** Re-read the states of the monitored interfaces, called by link monitor backends which lost events
+ */
+void  tau_linkResync (
+    void)
+{
+    const TAU_LINK_MONITOR_T    *pMonitor = __atomic_load_n(&pLinkMonitor, __ATOMIC_ACQUIRE);
+    UINT32                      index;
+    UINT32                      state;
+    BOOL8                       linkUp;
+
+    if (pMonitor == NULL)
+    {
+        return;
+    }
+    for (index = 0u; index < LINK_MONITOR_IF_CNT; index++)
+    {
+        if (pMonitor->pfGetState(linkIfName[index], &linkUp) == TRDP_NO_ERR)
+        {
+            state = (linkUp == TRUE) ? 1u : 0u;
+            if (__atomic_exchange_n(&linkUpState[index], state, __ATOMIC_ACQ_REL) != state)
+            {
+                vos_printLog(VOS_LOG_INFO, "Link %s %s\n", linkIfName[index], (linkUp == TRUE) ? "up" : "down");
+            }
+        }
+    }
+    /* a link may have gone down and up again in between, the user has to check anyway */
+    __atomic_store_n(&linkEventPending, 1u, __ATOMIC_RELEASE);
+}
+
+/**********************************************************************************************************************/
+/** Fetch and clear the link change indication
+ *
+ *  @param[out]     pLinkEvent          TRUE: a link changed since the last call
+ *
+ *  @retval         TRDP_NO_ERR                no error
+ *  @retval         TRDP_NOINIT_ERR            no link monitor, the link state must be polled
+ */
+TRDP_ERR_T  tau_getLinkEvent (
+    BOOL8 *pLinkEvent)
+{
+    if (pLinkEvent == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (__atomic_load_n(&pLinkMonitor, __ATOMIC_ACQUIRE) == NULL)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    *pLinkEvent = (__atomic_exchange_n(&linkEventPending, 0u, __ATOMIC_ACQ_REL) != 0u) ? TRUE : FALSE;
+    return TRDP_NO_ERR;
+}
+
 #endif /* TRDP_OPTION_LADDER */
@@ -17,6 +17,9 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: tau_linkResync for link monitor backends which lost events
+ *      AG 2026-10-18: Event driven link monitor (rtnetlink), configurable interface names
+ *      AG 2026-10-18: Traffic Store read sections
  */
 
 #ifndef TAU_LADDER_H_
@@ -37,6 +40,8 @@ extern "C" {
  * DEFINES
  */
 #define TRAFFIC_STORE_SIZE 65536			/* Traffic Store Size : 64KB */
+#define TRAFFIC_STORE_SLOT_SIZE	64			/* Traffic Store bytes guarded by one sequence counter */
+#define TRAFFIC_STORE_SLOT_CNT	(TRAFFIC_STORE_SIZE / TRAFFIC_STORE_SLOT_SIZE)	/* number of sequence counters */
 #define SUBNET1	0x00000000					/* Sub-network Id1 */
 #define SUBNET2	0x00002000					/* Sub-network Id2 */
 #define NUM_ED_INTERFACES	10				/* number of End Device Interfaces */
@@ -44,6 +49,24 @@ extern "C" {
 /* SubnetId Type */
 #define SUBNETID_TYPE1				1			/* SUBNETID Type1 */
 #define SUBNETID_TYPE2				2			/* SUBNETID Type2 */
+#define LINK_MONITOR_IF_CNT			2			/* monitored interfaces (subnet1, subnet2) */
+
+/***********************************************************************************************************************
+ * TYPEDEFS
+ */
+
+/** Link monitor backend.
+ *  The default backend listens to rtnetlink link messages, tests may install a fake one by tau_setLinkMonitor().
+ *  A backend reports link changes by tau_linkEvent(), lost events by tau_linkResync().
+ */
+typedef struct TAU_LINK_MONITOR
+{
+	TRDP_ERR_T	(*pfOpen)(void);												/**< start the event delivery */
+	INT32		(*pfGetFd)(void);												/**< descriptor readable on pending events, -1 if none */
+	void		(*pfProcess)(void);												/**< read pending events, report them by tau_linkEvent() */
+	TRDP_ERR_T	(*pfGetState)(const CHAR8 *pIfName, BOOL8 *pLinkUp);			/**< current state of an interface */
+	void		(*pfClose)(void);												/**< stop the event delivery */
+} TAU_LINK_MONITOR_T;
 
 /***********************************************************************************************************************
  * GLOBAL VARIABLES
@@ -55,6 +78,7 @@ extern mode_t PERMISSION	;					/* Traffic Store permission is rw-rw-rw- */
 extern UINT8 *pTrafficStoreAddr;			/* pointer to pointer to Traffic Store Address */
 extern VOS_SHRD_T  pTrafficStoreHandle;	/* Pointer to Traffic Store Handle */
 extern UINT16 TRAFFIC_STORE_MUTEX_VALUE_AREA;		/* Traffic Store mutex ID Area */
+extern UINT32 *pTrafficStoreSeq;			/* Sequence counters of the Traffic Store slots (behind the store) */
 
 /* PDComLadderThread */
 extern CHAR8 pdComLadderThreadName[];		/* Thread name is PDComLadder Thread. */
@@ -130,7 +154,9 @@ TRDP_ERR_T  tau_getNetworkContext (
     UINT32          *pSubnetId);
 
 /**********************************************************************************************************************/
-/** Get Traffic Store accessibility.
+/** Get exclusive Traffic Store accessibility.
+ *  Waits for running slot writers and blocks all slot readers and writers until tau_unlockTrafficStore.
+ *  Do not call other Traffic Store functions while the lock is held.
  *
  *  @retval         TRDP_NO_ERR			no error
  *  @retval         TRDP_PARAM_ERR		parameter error
@@ -153,6 +179,95 @@ TRDP_ERR_T  tau_lockTrafficStore (
 TRDP_ERR_T  tau_unlockTrafficStore (
     void);
 
+/**********************************************************************************************************************/
+/** Read a consistent snapshot of a Traffic Store area without locking.
+ *  The copy is repeated if a writer of the same slots was active meanwhile; writers of other slots do not interfere.
+ *
+ *  @param[in]		offset				Traffic Store offset
+ *  @param[out]		pData				buffer for the data
+ *  @param[in]		size				number of bytes to read
+ *
+ *  @retval         TRDP_NO_ERR			no error
+ *  @retval         TRDP_PARAM_ERR		area outside the Traffic Store
+ */
+TRDP_ERR_T  tau_readTrafficStore (
+	UINT16	offset,
+	UINT8	*pData,
+	UINT32	size);
+
+/**********************************************************************************************************************/
+/** Start a lock-free read section of a Traffic Store area, e.g. to marshall from it in place.
+ *  The data read is only consistent if tau_retryReadTrafficStore returns FALSE afterwards.
+ *
+ *  @param[in]		offset				Traffic Store offset
+ *  @param[in]		size				number of bytes to read
+ *  @param[out]		pSeq				sequence to pass to tau_retryReadTrafficStore
+ *
+ *  @retval         TRDP_NO_ERR			no error
+ *  @retval         TRDP_PARAM_ERR		area outside the Traffic Store
+ */
+TRDP_ERR_T  tau_beginReadTrafficStore (
+	UINT16	offset,
+	UINT32	size,
+	UINT64	*pSeq);
+
+/**********************************************************************************************************************/
+/** End a lock-free read section of a Traffic Store area.
+ *
+ *  @param[in]		offset				Traffic Store offset
+ *  @param[in]		size				number of bytes read
+ *  @param[in]		seq					sequence from tau_beginReadTrafficStore
+ *
+ *  @retval         TRUE				the area was written meanwhile, read it again
+ *  @retval         FALSE				the data read is consistent
+ */
+BOOL8  tau_retryReadTrafficStore (
+	UINT16	offset,
+	UINT32	size,
+	UINT64	seq);
+
+/**********************************************************************************************************************/
+/** Write a Traffic Store area.
+ *
+ *  @param[in]		offset				Traffic Store offset
+ *  @param[in]		pData				data to write, NULL to clear the area
+ *  @param[in]		size				number of bytes to write
+ *
+ *  @retval         TRDP_NO_ERR			no error
+ *  @retval         TRDP_PARAM_ERR		area outside the Traffic Store
+ */
+TRDP_ERR_T  tau_writeTrafficStore (
+	UINT16		offset,
+	const UINT8	*pData,
+	UINT32		size);
+
+/**********************************************************************************************************************/
+/** Start writing a Traffic Store area in place (e.g. unmarshalling into it).
+ *  Must be followed by tau_endWriteTrafficStore with the same area.
+ *
+ *  @param[in]		offset				Traffic Store offset
+ *  @param[in]		size				number of bytes to be written
+ *
+ *  @retval         TRDP_NO_ERR			no error
+ *  @retval         TRDP_PARAM_ERR		area outside the Traffic Store
+ */
+TRDP_ERR_T  tau_beginWriteTrafficStore (
+	UINT16	offset,
+	UINT32	size);
+
+/**********************************************************************************************************************/
+/** Finish writing a Traffic Store area.
+ *
+ *  @param[in]		offset				Traffic Store offset
+ *  @param[in]		size				number of bytes written
+ *
+ *  @retval         TRDP_NO_ERR			no error
+ *  @retval         TRDP_PARAM_ERR		area outside the Traffic Store
+ */
+TRDP_ERR_T  tau_endWriteTrafficStore (
+	UINT16	offset,
+	UINT32	size);
+
 /**********************************************************************************************************************/
 /** Check Link up/down
  *
@@ -178,6 +293,97 @@ TRDP_ERR_T  tau_checkLinkUpDown (
 
 TRDP_ERR_T  tau_closeCheckLinkUpDown (void);
 
+/**********************************************************************************************************************/
+/** Set the interface name of a Sub-network (default eth0, eth1)
+ *
+ *  @param[in]		subnetId				Sub-network Id: SUBNET1 or SUBNET2
+ *  @param[in]		pIfName					interface name
+ *
+ *  @retval         TRDP_NO_ERR				no error
+ *  @retval         TRDP_PARAM_ERR			parameter err
+ */
+TRDP_ERR_T  tau_setLinkIfName (
+	UINT32			subnetId,
+	const CHAR8		*pIfName);
+
+/**********************************************************************************************************************/
+/** Get the interface name of a Sub-network
+ *
+ *  @param[in]		subnetId				Sub-network Id: SUBNET1 or SUBNET2
+ *
+ *  @retval         interface name, NULL for an unknown Sub-network
+ */
+const CHAR8 *tau_getLinkIfName (
+	UINT32			subnetId);
+
+/**********************************************************************************************************************/
+/** Select the link monitor backend, must be called while the monitor is closed
+ *
+ *  @param[in]		pMonitor				backend, NULL for the default (rtnetlink)
+ *
+ *  @retval         TRDP_NO_ERR				no error
+ *  @retval         TRDP_STATE_ERR			link monitor is open
+ */
+TRDP_ERR_T  tau_setLinkMonitor (
+	const TAU_LINK_MONITOR_T	*pMonitor);
+
+/**********************************************************************************************************************/
+/** Start the link monitor. Afterwards tau_checkLinkUpDown returns the state kept from the events.
+ *
+ *  @retval         TRDP_NO_ERR				no error
+ *  @retval         TRDP_SOCK_ERR			backend could not be opened, the link state is polled
+ */
+TRDP_ERR_T  tau_openLinkMonitor (
+	void);
+
+/**********************************************************************************************************************/
+/** Stop the link monitor
+ */
+void  tau_closeLinkMonitor (
+	void);
+
+/**********************************************************************************************************************/
+/** Descriptor of the link monitor to select() on
+ *
+ *  @retval         descriptor, -1 if there is none
+ */
+INT32  tau_getLinkMonitorFd (
+	void);
+
+/**********************************************************************************************************************/
+/** Read the pending events of the link monitor, called when its descriptor is readable
+ */
+void  tau_processLinkMonitor (
+	void);
+
+/**********************************************************************************************************************/
+/** Report a link state, called by link monitor backends
+ *
+ *  @param[in]		pIfName					interface name
+ *  @param[in]		linkUp					TRUE: up and running
+ */
+void  tau_linkEvent (
+	const CHAR8		*pIfName,
+	BOOL8			linkUp);
+
+/**********************************************************************************************************************/
+/** Re-read the states of the monitored interfaces by the backend's pfGetState and indicate a link change,
+ *  called by link monitor backends which lost events (e.g. on a receive buffer overrun)
+ */
+void  tau_linkResync (
+	void);
+
+/**********************************************************************************************************************/
+/** Fetch and clear the link change indication
+ *
+ *  @param[out]		pLinkEvent				TRUE: a link changed since the last call
+ *
+ *  @retval         TRDP_NO_ERR				no error
+ *  @retval         TRDP_NOINIT_ERR			no link monitor, the link state must be polled
+ */
+TRDP_ERR_T  tau_getLinkEvent (
+	BOOL8			*pLinkEvent);
+
 
 #ifdef __cplusplus
 }
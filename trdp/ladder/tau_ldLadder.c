@@ -17,6 +17,13 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: PD send time (timeToGo) is in ns
+ *      AG 2026-10-18: Telegram hash sized from the configuration, bucket tails, O(1) delete, PR back-pointer cleared
+ *      AG 2026-10-18: Telegram registries indexed by comId hash, O(1) append, PR back-pointer in pUserRef
+ *      AG 2026-10-18: Both subnet sessions served by one select() and one pass (tlc_processGroup)
+ *      AG 2026-10-18: Subnet switchover driven by link monitor events, interface names from the I/F config
+ *      AG 2026-10-18: Publications serialized from the Traffic Store by a pre-send callback, no tlp_put per cycle
+ *      AG 2026-10-18: Traffic Store accessed per slot (seqlock) instead of the global Traffic Store mutex
  */
 
 #ifdef TRDP_OPTION_LADDER
@@ -50,10 +57,35 @@ static void forceSocketClose (TRDP_APP_SESSION_T);
  * DEFINES
  */
 
+/* Number of hash buckets of the telegram registries (power of 2), at least one bucket per configured telegram */
+#define TAUL_TELEGRAM_HASH_MIN      16u
+#define TAUL_TELEGRAM_HASH_MAX      65536u
+/* Hash bucket of a comId (multiplicative hash, the table size is at most 2^16) */
+#define TAUL_TELEGRAM_HASH(comId)   ((((UINT32)(comId) * 0x9E3779B1u) >> 16u) & (telegramHashSize - 1u))
+
 /*******************************************************************************
  * TYPEDEFS
  */
 
+/* comId hash buckets of the telegram registries, appended at the tail */
+typedef struct
+{
+    PUBLISH_TELEGRAM_T          *pHead;
+    PUBLISH_TELEGRAM_T          *pTail;
+} PUBLISH_TELEGRAM_BUCKET_T;
+
+typedef struct
+{
+    SUBSCRIBE_TELEGRAM_T        *pHead;
+    SUBSCRIBE_TELEGRAM_T        *pTail;
+} SUBSCRIBE_TELEGRAM_BUCKET_T;
+
+typedef struct
+{
+    PD_REQUEST_TELEGRAM_T       *pHead;
+    PD_REQUEST_TELEGRAM_T       *pTail;
+} PD_REQUEST_TELEGRAM_BUCKET_T;
+
 /******************************************************************************
  * TRDP_OPTION_TRAFFIC_SHAPING  Locals
  */
@@ -70,6 +102,14 @@ PD_REQUEST_TELEGRAM_T       *pHeadPdRequestTelegram = NULL;
 VOS_MUTEX_T pPublishTelegramMutex = NULL;                        /* pointer to Mutex for Publish Telegram */
 VOS_MUTEX_T pSubscribeTelegramMutex = NULL;                    /* pointer to Mutex for Subscribe Telegram */
 VOS_MUTEX_T pPdRequestTelegramMutex = NULL;                    /* pointer to Mutex for PD Request Telegram */
+/* Telegram List Tail and comId Hash Index, protected by the list mutex */
+static PUBLISH_TELEGRAM_T       *pTailPublishTelegram = NULL;       /* Last Address of Publish Telegram List */
+static SUBSCRIBE_TELEGRAM_T     *pTailSubscribeTelegram = NULL;     /* Last Address of Subscribe Telegram List */
+static PD_REQUEST_TELEGRAM_T    *pTailPdRequestTelegram = NULL;     /* Last Address of PD Request Telegram List */
+static UINT32                       telegramHashSize = 0u;              /* buckets per registry, 0: not allocated */
+static PUBLISH_TELEGRAM_BUCKET_T    *pHashPublishTelegram = NULL;       /* Publish Telegrams by comId */
+static SUBSCRIBE_TELEGRAM_BUCKET_T  *pHashSubscribeTelegram = NULL;     /* Subscribe Telegrams by comId */
+static PD_REQUEST_TELEGRAM_BUCKET_T *pHashPdRequestTelegram = NULL;     /* PD Request Telegrams by comId */
 
 /*  Marshalling configuration initialized from datasets defined in xml  */
 TRDP_MARSHALL_CONFIG_T      marshallConfig = {&tau_marshall, &tau_unmarshall, NULL};    /** Marshaling/unMarshalling configuration  */
@@ -88,6 +128,105 @@ TRDP_URI_HOST_T         IP_ADDRESS_ZERO = {"0.0.0.0"};  /* IP Address 0.0.0.0 */
 const TRDP_DEST_T       defaultDestination = {0};       /* Destination Parameter (id, SDT, URI) */
 static INT32 ts_buffer[2048/sizeof(INT32)];
 
+/**********************************************************************************************************************/
+/** Number of bytes copied from the Traffic Store into ts_buffer for sending
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *
+ *  @retval         size of ts_buffer, limited by the end of the Traffic Store
+ */
+static UINT32 tau_ldTrafficStoreCopySize (
+    UINT16 offset)
+{
+    return ((TRAFFIC_STORE_SIZE - (UINT32)offset) < sizeof(ts_buffer)) ?
+           (TRAFFIC_STORE_SIZE - (UINT32)offset) : (UINT32)sizeof(ts_buffer);
+}
+
+/**********************************************************************************************************************/
+/** Release the comId hash tables of the telegram registries
+ */
+static void tau_ldTelegramHashFree (void)
+{
+    if (pHashPublishTelegram != NULL)
+    {
+        vos_memFree(pHashPublishTelegram);
+        pHashPublishTelegram = NULL;
+    }
+    if (pHashSubscribeTelegram != NULL)
+    {
+        vos_memFree(pHashSubscribeTelegram);
+        pHashSubscribeTelegram = NULL;
+    }
+    if (pHashPdRequestTelegram != NULL)
+    {
+        vos_memFree(pHashPdRequestTelegram);
+        pHashPdRequestTelegram = NULL;
+    }
+    telegramHashSize = 0u;
+}
+
+/**********************************************************************************************************************/
+/** Allocate the comId hash tables of the telegram registries, the registries must be empty
+ *
+ *  @param[in]      numTelegrams        number of configured telegrams
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_MEM_ERR        out of memory
+ */
+static TRDP_ERR_T tau_ldTelegramHashInit (
+    UINT32 numTelegrams)
+{
+    UINT32 size = TAUL_TELEGRAM_HASH_MIN;
+
+    while ((size < numTelegrams) && (size < TAUL_TELEGRAM_HASH_MAX))
+    {
+        size <<= 1u;
+    }
+    tau_ldTelegramHashFree();
+    pHashPublishTelegram    = (PUBLISH_TELEGRAM_BUCKET_T *)vos_memAlloc(size * sizeof(PUBLISH_TELEGRAM_BUCKET_T));
+    pHashSubscribeTelegram  = (SUBSCRIBE_TELEGRAM_BUCKET_T *)vos_memAlloc(size * sizeof(SUBSCRIBE_TELEGRAM_BUCKET_T));
+    pHashPdRequestTelegram  = (PD_REQUEST_TELEGRAM_BUCKET_T *)vos_memAlloc(size * sizeof(PD_REQUEST_TELEGRAM_BUCKET_T));
+    if ((pHashPublishTelegram == NULL) || (pHashSubscribeTelegram == NULL) || (pHashPdRequestTelegram == NULL))
+    {
+        vos_printLog(VOS_LOG_ERROR, "Telegram hash table (%u buckets) allocation failed\n", size);
+        tau_ldTelegramHashFree();
+        return TRDP_MEM_ERR;
+    }
+    telegramHashSize = size;
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Forget a PD Request Telegram kept in the user reference of the PR elements of the sessions
+ *
+ *  @param[in]      pPdRequestTelegram  PD Request Telegram to be deleted
+ */
+static void tau_ldForgetPdRequestTelegram (
+    const PD_REQUEST_TELEGRAM_T *pPdRequestTelegram)
+{
+    TRDP_APP_SESSION_T  sessions[2];
+    PD_ELE_T            *iterPD;
+    UINT32              i;
+
+    sessions[0] = appHandle;
+    sessions[1] = (appHandle2 != (TRDP_APP_SESSION_T) LADDER_TOPOLOGY_DISABLE) ? appHandle2 : NULL;
+    for (i = 0u; i < 2u; i++)
+    {
+        if ((sessions[i] == NULL) || (vos_mutexLock(sessions[i]->mutex) != VOS_NO_ERR))
+        {
+            continue;
+        }
+        for (iterPD = sessions[i]->pSndQueue; iterPD != NULL; iterPD = iterPD->pNext)
+        {
+            if (iterPD->pUserRef == pPdRequestTelegram)
+            {
+                iterPD->pUserRef = NULL;
+            }
+        }
+        vos_mutexUnlock(sessions[i]->mutex);
+    }
+}
+
 /**********************************************************************************************************************/
 /** TAUL Local Function */
 /**********************************************************************************************************************/
@@ -103,7 +242,7 @@ TRDP_ERR_T appendPublishTelegramList (
         PUBLISH_TELEGRAM_T    * *ppHeadPublishTelegram,
         PUBLISH_TELEGRAM_T    *pNewPublishTelegram)
 {
-    PUBLISH_TELEGRAM_T *iterPublishTelegram;
+    PUBLISH_TELEGRAM_BUCKET_T *pBucket;
     extern VOS_MUTEX_T pPublishTelegramMutex;
     VOS_ERR_T vosErr = VOS_NO_ERR;
 
@@ -122,6 +261,12 @@ TRDP_ERR_T appendPublishTelegramList (
     /* Ensure this List is last! */
     pNewPublishTelegram->pNextPublishTelegram = NULL;
 
+    /* Registered without tau_ldInit: hash table of the minimum size */
+    if ((telegramHashSize == 0u) && (tau_ldTelegramHashInit(0u) != TRDP_NO_ERR))
+    {
+        return TRDP_MEM_ERR;
+    }
+
     /* Check Mutex ? */
     if (pPublishTelegramMutex == NULL)
     {
@@ -154,21 +299,31 @@ TRDP_ERR_T appendPublishTelegramList (
         }
     }
 
-    if (*ppHeadPublishTelegram == NULL)
+    /* Append at the tail of the comId hash bucket, so the first registered telegram is found first */
+    pBucket = &pHashPublishTelegram[TAUL_TELEGRAM_HASH(pNewPublishTelegram->comId)];
+    pNewPublishTelegram->pNextHashPublishTelegram = NULL;
+    pNewPublishTelegram->pPrevHashPublishTelegram = pBucket->pTail;
+    if (pBucket->pTail == NULL)
     {
-        *ppHeadPublishTelegram = pNewPublishTelegram;
-        /* UnLock Publish Telegram by Mutex */
-        vos_mutexUnlock(pPublishTelegramMutex);
-        return TRDP_NO_ERR;
+        pBucket->pHead = pNewPublishTelegram;
+    }
+    else
+    {
+        pBucket->pTail->pNextHashPublishTelegram = pNewPublishTelegram;
     }
+    pBucket->pTail = pNewPublishTelegram;
 
-    for (iterPublishTelegram = *ppHeadPublishTelegram;
-            iterPublishTelegram->pNextPublishTelegram != NULL;
-            iterPublishTelegram = iterPublishTelegram->pNextPublishTelegram)
+    if ((*ppHeadPublishTelegram == NULL) || (pTailPublishTelegram == NULL))
     {
-        ;
+        pNewPublishTelegram->pPrevPublishTelegram = NULL;
+        *ppHeadPublishTelegram = pNewPublishTelegram;
+    }
+    else
+    {
+        pNewPublishTelegram->pPrevPublishTelegram = pTailPublishTelegram;
+        pTailPublishTelegram->pNextPublishTelegram = pNewPublishTelegram;
     }
-    iterPublishTelegram->pNextPublishTelegram = pNewPublishTelegram;
+    pTailPublishTelegram = pNewPublishTelegram;
     /* UnLock Publish Telegram by Mutex */
     vos_mutexUnlock(pPublishTelegramMutex);
     return TRDP_NO_ERR;
@@ -188,7 +343,7 @@ TRDP_ERR_T deletePublishTelegramList (
         PUBLISH_TELEGRAM_T    * *ppHeadPublishTelegram,
         PUBLISH_TELEGRAM_T    *pDeletePublishTelegram)
 {
-    PUBLISH_TELEGRAM_T *iterPublishTelegram;
+    PUBLISH_TELEGRAM_BUCKET_T *pBucket;
     extern VOS_MUTEX_T pPublishTelegramMutex;
     VOS_ERR_T vosErr = VOS_NO_ERR;
 
@@ -214,29 +369,43 @@ TRDP_ERR_T deletePublishTelegramList (
         }
     }
 
-    /* handle removal of first element */
-    if (pDeletePublishTelegram == *ppHeadPublishTelegram)
+    /* Remove from the comId hash bucket */
+    pBucket = &pHashPublishTelegram[TAUL_TELEGRAM_HASH(pDeletePublishTelegram->comId)];
+    if (pDeletePublishTelegram->pPrevHashPublishTelegram == NULL)
     {
-        *ppHeadPublishTelegram = pDeletePublishTelegram->pNextPublishTelegram;
-        vos_memFree(pDeletePublishTelegram);
-        pDeletePublishTelegram = NULL;
-        /* UnLock Publish Telegram by Mutex */
-        vos_mutexUnlock(pPublishTelegramMutex);
-        return TRDP_NO_ERR;
+        pBucket->pHead = pDeletePublishTelegram->pNextHashPublishTelegram;
+    }
+    else
+    {
+        pDeletePublishTelegram->pPrevHashPublishTelegram->pNextHashPublishTelegram = pDeletePublishTelegram->pNextHashPublishTelegram;
+    }
+    if (pDeletePublishTelegram->pNextHashPublishTelegram == NULL)
+    {
+        pBucket->pTail = pDeletePublishTelegram->pPrevHashPublishTelegram;
+    }
+    else
+    {
+        pDeletePublishTelegram->pNextHashPublishTelegram->pPrevHashPublishTelegram = pDeletePublishTelegram->pPrevHashPublishTelegram;
     }
 
-    for (iterPublishTelegram = *ppHeadPublishTelegram;
-            iterPublishTelegram != NULL;
-            iterPublishTelegram = iterPublishTelegram->pNextPublishTelegram)
+    /* Remove from the List */
+    if (pDeletePublishTelegram->pPrevPublishTelegram == NULL)
     {
-        if (iterPublishTelegram->pNextPublishTelegram == pDeletePublishTelegram)
-        {
-            iterPublishTelegram->pNextPublishTelegram = pDeletePublishTelegram->pNextPublishTelegram;
-            vos_memFree(pDeletePublishTelegram);
-            pDeletePublishTelegram = NULL;
-            break;
-        }
+        *ppHeadPublishTelegram = pDeletePublishTelegram->pNextPublishTelegram;
     }
+    else
+    {
+        pDeletePublishTelegram->pPrevPublishTelegram->pNextPublishTelegram = pDeletePublishTelegram->pNextPublishTelegram;
+    }
+    if (pDeletePublishTelegram->pNextPublishTelegram == NULL)
+    {
+        pTailPublishTelegram = pDeletePublishTelegram->pPrevPublishTelegram;
+    }
+    else
+    {
+        pDeletePublishTelegram->pNextPublishTelegram->pPrevPublishTelegram = pDeletePublishTelegram->pPrevPublishTelegram;
+    }
+    vos_memFree(pDeletePublishTelegram);
     /* UnLock Publish Telegram by Mutex */
     vos_mutexUnlock(pPublishTelegramMutex);
     return TRDP_NO_ERR;
@@ -288,10 +457,10 @@ PUBLISH_TELEGRAM_T *searchPublishTelegramList (
         }
     }
 
-    /* Check PublishTelegram List Loop */
-    for (iterPublishTelegram = pHeadPublishTelegram;
+    /* Check Publish Telegrams with the same comId hash */
+    for (iterPublishTelegram = pHashPublishTelegram[TAUL_TELEGRAM_HASH(comId)].pHead;
             iterPublishTelegram != NULL;
-            iterPublishTelegram = iterPublishTelegram->pNextPublishTelegram)
+            iterPublishTelegram = iterPublishTelegram->pNextHashPublishTelegram)
     {
         /* Publish Telegram: We match if src/dst address is zero or matches, and comId */
         if ((iterPublishTelegram->comId == comId)
@@ -325,7 +494,7 @@ TRDP_ERR_T appendSubscribeTelegramList (
         SUBSCRIBE_TELEGRAM_T    * *ppHeadSubscribeTelegram,
         SUBSCRIBE_TELEGRAM_T    *pNewSubscribeTelegram)
 {
-    SUBSCRIBE_TELEGRAM_T *iterSubscribeTelegram;
+    SUBSCRIBE_TELEGRAM_BUCKET_T *pBucket;
     extern VOS_MUTEX_T pSubscribeTelegramMutex;
     VOS_ERR_T vosErr = VOS_NO_ERR;
 
@@ -344,6 +513,12 @@ TRDP_ERR_T appendSubscribeTelegramList (
     /* Ensure this List is last! */
     pNewSubscribeTelegram->pNextSubscribeTelegram = NULL;
 
+    /* Registered without tau_ldInit: hash table of the minimum size */
+    if ((telegramHashSize == 0u) && (tau_ldTelegramHashInit(0u) != TRDP_NO_ERR))
+    {
+        return TRDP_MEM_ERR;
+    }
+
     /* Check Mutex ? */
     if (pSubscribeTelegramMutex == NULL)
     {
@@ -376,21 +551,31 @@ TRDP_ERR_T appendSubscribeTelegramList (
         }
     }
 
-    if (*ppHeadSubscribeTelegram == NULL)
+    /* Append at the tail of the comId hash bucket, so the first registered telegram is found first */
+    pBucket = &pHashSubscribeTelegram[TAUL_TELEGRAM_HASH(pNewSubscribeTelegram->comId)];
+    pNewSubscribeTelegram->pNextHashSubscribeTelegram = NULL;
+    pNewSubscribeTelegram->pPrevHashSubscribeTelegram = pBucket->pTail;
+    if (pBucket->pTail == NULL)
     {
-        *ppHeadSubscribeTelegram = pNewSubscribeTelegram;
-        /* UnLock Subscribe Telegram by Mutex */
-        vos_mutexUnlock(pSubscribeTelegramMutex);
-        return TRDP_NO_ERR;
+        pBucket->pHead = pNewSubscribeTelegram;
+    }
+    else
+    {
+        pBucket->pTail->pNextHashSubscribeTelegram = pNewSubscribeTelegram;
     }
+    pBucket->pTail = pNewSubscribeTelegram;
 
-    for (iterSubscribeTelegram = *ppHeadSubscribeTelegram;
-            iterSubscribeTelegram->pNextSubscribeTelegram != NULL;
-            iterSubscribeTelegram = iterSubscribeTelegram->pNextSubscribeTelegram)
+    if ((*ppHeadSubscribeTelegram == NULL) || (pTailSubscribeTelegram == NULL))
     {
-        ;
+        pNewSubscribeTelegram->pPrevSubscribeTelegram = NULL;
+        *ppHeadSubscribeTelegram = pNewSubscribeTelegram;
+    }
+    else
+    {
+        pNewSubscribeTelegram->pPrevSubscribeTelegram = pTailSubscribeTelegram;
+        pTailSubscribeTelegram->pNextSubscribeTelegram = pNewSubscribeTelegram;
     }
-    iterSubscribeTelegram->pNextSubscribeTelegram = pNewSubscribeTelegram;
+    pTailSubscribeTelegram = pNewSubscribeTelegram;
     /* UnLock Subscribe Telegram by Mutex */
     vos_mutexUnlock(pSubscribeTelegramMutex);
     return TRDP_NO_ERR;
@@ -410,7 +595,7 @@ TRDP_ERR_T deleteSubscribeTelegramList (
         SUBSCRIBE_TELEGRAM_T    * *ppHeadSubscribeTelegram,
         SUBSCRIBE_TELEGRAM_T    *pDeleteSubscribeTelegram)
 {
-    SUBSCRIBE_TELEGRAM_T *iterSubscribeTelegram;
+    SUBSCRIBE_TELEGRAM_BUCKET_T *pBucket;
     extern VOS_MUTEX_T pSubscribeTelegramMutex;
     VOS_ERR_T vosErr = VOS_NO_ERR;
 
@@ -436,29 +621,43 @@ TRDP_ERR_T deleteSubscribeTelegramList (
         }
     }
 
-    /* handle removal of first element */
-    if (pDeleteSubscribeTelegram == *ppHeadSubscribeTelegram)
+    /* Remove from the comId hash bucket */
+    pBucket = &pHashSubscribeTelegram[TAUL_TELEGRAM_HASH(pDeleteSubscribeTelegram->comId)];
+    if (pDeleteSubscribeTelegram->pPrevHashSubscribeTelegram == NULL)
     {
-        *ppHeadSubscribeTelegram = pDeleteSubscribeTelegram->pNextSubscribeTelegram;
-        vos_memFree(pDeleteSubscribeTelegram);
-        pDeleteSubscribeTelegram = NULL;
-        /* UnLock Subscribe Telegram by Mutex */
-        vos_mutexUnlock(pSubscribeTelegramMutex);
-        return TRDP_NO_ERR;
+        pBucket->pHead = pDeleteSubscribeTelegram->pNextHashSubscribeTelegram;
+    }
+    else
+    {
+        pDeleteSubscribeTelegram->pPrevHashSubscribeTelegram->pNextHashSubscribeTelegram = pDeleteSubscribeTelegram->pNextHashSubscribeTelegram;
+    }
+    if (pDeleteSubscribeTelegram->pNextHashSubscribeTelegram == NULL)
+    {
+        pBucket->pTail = pDeleteSubscribeTelegram->pPrevHashSubscribeTelegram;
+    }
+    else
+    {
+        pDeleteSubscribeTelegram->pNextHashSubscribeTelegram->pPrevHashSubscribeTelegram = pDeleteSubscribeTelegram->pPrevHashSubscribeTelegram;
     }
 
-    for (iterSubscribeTelegram = *ppHeadSubscribeTelegram;
-            iterSubscribeTelegram != NULL;
-            iterSubscribeTelegram = iterSubscribeTelegram->pNextSubscribeTelegram)
+    /* Remove from the List */
+    if (pDeleteSubscribeTelegram->pPrevSubscribeTelegram == NULL)
     {
-        if (iterSubscribeTelegram->pNextSubscribeTelegram == pDeleteSubscribeTelegram)
-        {
-            iterSubscribeTelegram->pNextSubscribeTelegram = pDeleteSubscribeTelegram->pNextSubscribeTelegram;
-            vos_memFree(pDeleteSubscribeTelegram);
-            pDeleteSubscribeTelegram = NULL;
-            break;
-        }
+        *ppHeadSubscribeTelegram = pDeleteSubscribeTelegram->pNextSubscribeTelegram;
     }
+    else
+    {
+        pDeleteSubscribeTelegram->pPrevSubscribeTelegram->pNextSubscribeTelegram = pDeleteSubscribeTelegram->pNextSubscribeTelegram;
+    }
+    if (pDeleteSubscribeTelegram->pNextSubscribeTelegram == NULL)
+    {
+        pTailSubscribeTelegram = pDeleteSubscribeTelegram->pPrevSubscribeTelegram;
+    }
+    else
+    {
+        pDeleteSubscribeTelegram->pNextSubscribeTelegram->pPrevSubscribeTelegram = pDeleteSubscribeTelegram->pPrevSubscribeTelegram;
+    }
+    vos_memFree(pDeleteSubscribeTelegram);
     /* UnLock Subscribe Telegram by Mutex */
     vos_mutexUnlock(pSubscribeTelegramMutex);
     return TRDP_NO_ERR;
@@ -508,10 +707,10 @@ SUBSCRIBE_TELEGRAM_T *searchSubscribeTelegramList (
             return NULL;
         }
     }
-    /* Check Subscribe Telegram List Loop */
-    for (iterSubscribeTelegram = pHeadSubscribeTelegram;
+    /* Check Subscribe Telegrams with the same comId hash */
+    for (iterSubscribeTelegram = pHashSubscribeTelegram[TAUL_TELEGRAM_HASH(comId)].pHead;
             iterSubscribeTelegram != NULL;
-            iterSubscribeTelegram = iterSubscribeTelegram->pNextSubscribeTelegram)
+            iterSubscribeTelegram = iterSubscribeTelegram->pNextHashSubscribeTelegram)
     {
         /* Subscribe Telegram: We match if src/dst address is zero or matches, and comId */
         if ((iterSubscribeTelegram->comId == comId)
@@ -565,13 +764,8 @@ SUBSCRIBE_TELEGRAM_T *getTailSubscribeTelegram ()
             return NULL;
         }
     }
-    /* Check Subscribe Telegram List Loop */
-    for (iterSubscribeTelegram = pHeadSubscribeTelegram;
-            iterSubscribeTelegram->pNextSubscribeTelegram != NULL;
-            iterSubscribeTelegram = iterSubscribeTelegram->pNextSubscribeTelegram)
-    {
-        continue;
-    }
+    /* Tail is kept by append/delete */
+    iterSubscribeTelegram = pTailSubscribeTelegram;
     /* UnLock Subscribe Telegram by Mutex */
     vos_mutexUnlock(pSubscribeTelegramMutex);
     return iterSubscribeTelegram;
@@ -590,7 +784,7 @@ TRDP_ERR_T appendPdRequestTelegramList (
         PD_REQUEST_TELEGRAM_T    * *ppHeadPdRequestTelegram,
         PD_REQUEST_TELEGRAM_T    *pNewPdRequestTelegram)
 {
-    PD_REQUEST_TELEGRAM_T *iterPdRequestTelegram;
+    PD_REQUEST_TELEGRAM_BUCKET_T *pBucket;
     extern VOS_MUTEX_T pPdRequestTelegramMutex;
     VOS_ERR_T vosErr = VOS_NO_ERR;
 
@@ -609,6 +803,12 @@ TRDP_ERR_T appendPdRequestTelegramList (
     /* Ensure this List is last! */
     pNewPdRequestTelegram->pNextPdRequestTelegram = NULL;
 
+    /* Registered without tau_ldInit: hash table of the minimum size */
+    if ((telegramHashSize == 0u) && (tau_ldTelegramHashInit(0u) != TRDP_NO_ERR))
+    {
+        return TRDP_MEM_ERR;
+    }
+
     /* Check Mutex ? */
     if (pPdRequestTelegramMutex == NULL)
     {
@@ -641,21 +841,31 @@ TRDP_ERR_T appendPdRequestTelegramList (
         }
     }
 
-    if (*ppHeadPdRequestTelegram == NULL)
+    /* Append at the tail of the comId hash bucket, so the first registered telegram is found first */
+    pBucket = &pHashPdRequestTelegram[TAUL_TELEGRAM_HASH(pNewPdRequestTelegram->comId)];
+    pNewPdRequestTelegram->pNextHashPdRequestTelegram = NULL;
+    pNewPdRequestTelegram->pPrevHashPdRequestTelegram = pBucket->pTail;
+    if (pBucket->pTail == NULL)
     {
-        *ppHeadPdRequestTelegram = pNewPdRequestTelegram;
-        /* UnLock PD Request Telegram by Mutex */
-        vos_mutexUnlock(pPdRequestTelegramMutex);
-        return TRDP_NO_ERR;
+        pBucket->pHead = pNewPdRequestTelegram;
     }
+    else
+    {
+        pBucket->pTail->pNextHashPdRequestTelegram = pNewPdRequestTelegram;
+    }
+    pBucket->pTail = pNewPdRequestTelegram;
 
-    for (iterPdRequestTelegram = *ppHeadPdRequestTelegram;
-            iterPdRequestTelegram->pNextPdRequestTelegram != NULL;
-            iterPdRequestTelegram = iterPdRequestTelegram->pNextPdRequestTelegram)
+    if ((*ppHeadPdRequestTelegram == NULL) || (pTailPdRequestTelegram == NULL))
     {
-        ;
+        pNewPdRequestTelegram->pPrevPdRequestTelegram = NULL;
+        *ppHeadPdRequestTelegram = pNewPdRequestTelegram;
+    }
+    else
+    {
+        pNewPdRequestTelegram->pPrevPdRequestTelegram = pTailPdRequestTelegram;
+        pTailPdRequestTelegram->pNextPdRequestTelegram = pNewPdRequestTelegram;
     }
-    iterPdRequestTelegram->pNextPdRequestTelegram = pNewPdRequestTelegram;
+    pTailPdRequestTelegram = pNewPdRequestTelegram;
     /* UnLock PD Request Telegram by Mutex */
     vos_mutexUnlock(pPdRequestTelegramMutex);
     return TRDP_NO_ERR;
@@ -663,6 +873,9 @@ TRDP_ERR_T appendPdRequestTelegramList (
 
 /**********************************************************************************************************************/
 /** Delete an PD Request Telegram List
+ *
+ *  TAULpdMainThread keeps a pointer to the PD Request Telegram in the user reference of the PR element,
+ *  it is cleared before the telegram is released.
  *
  *  @param[in]      ppHeadPdRequestTelegram         pointer to pointer to head of queue
  *  @param[in]      pDeletePdRequestTelegram            pointer to element to delete
@@ -675,7 +888,7 @@ TRDP_ERR_T deletePdRequestTelegramList (
         PD_REQUEST_TELEGRAM_T    * *ppHeadPdRequestTelegram,
         PD_REQUEST_TELEGRAM_T    *pDeletePdRequestTelegram)
 {
-    PD_REQUEST_TELEGRAM_T *iterPdRequestTelegram;
+    PD_REQUEST_TELEGRAM_BUCKET_T *pBucket;
     extern VOS_MUTEX_T pPdRequestTelegramMutex;
     VOS_ERR_T vosErr = VOS_NO_ERR;
 
@@ -701,31 +914,48 @@ TRDP_ERR_T deletePdRequestTelegramList (
         }
     }
 
-    /* handle removal of first element */
-    if (pDeletePdRequestTelegram == *ppHeadPdRequestTelegram)
+    /* Remove from the comId hash bucket */
+    pBucket = &pHashPdRequestTelegram[TAUL_TELEGRAM_HASH(pDeletePdRequestTelegram->comId)];
+    if (pDeletePdRequestTelegram->pPrevHashPdRequestTelegram == NULL)
     {
-        *ppHeadPdRequestTelegram = pDeletePdRequestTelegram->pNextPdRequestTelegram;
-        vos_memFree(pDeletePdRequestTelegram);
-        pDeletePdRequestTelegram = NULL;
-        /* UnLock PD Request Telegram by Mutex */
-        vos_mutexUnlock(pPdRequestTelegramMutex);
-        return TRDP_NO_ERR;
+        pBucket->pHead = pDeletePdRequestTelegram->pNextHashPdRequestTelegram;
+    }
+    else
+    {
+        pDeletePdRequestTelegram->pPrevHashPdRequestTelegram->pNextHashPdRequestTelegram = pDeletePdRequestTelegram->pNextHashPdRequestTelegram;
+    }
+    if (pDeletePdRequestTelegram->pNextHashPdRequestTelegram == NULL)
+    {
+        pBucket->pTail = pDeletePdRequestTelegram->pPrevHashPdRequestTelegram;
+    }
+    else
+    {
+        pDeletePdRequestTelegram->pNextHashPdRequestTelegram->pPrevHashPdRequestTelegram = pDeletePdRequestTelegram->pPrevHashPdRequestTelegram;
     }
 
-    for (iterPdRequestTelegram = *ppHeadPdRequestTelegram;
-            iterPdRequestTelegram != NULL;
-            iterPdRequestTelegram = iterPdRequestTelegram->pNextPdRequestTelegram)
+    /* Remove from the List */
+    if (pDeletePdRequestTelegram->pPrevPdRequestTelegram == NULL)
     {
-        if (iterPdRequestTelegram->pNextPdRequestTelegram == pDeletePdRequestTelegram)
-        {
-            iterPdRequestTelegram->pNextPdRequestTelegram = pDeletePdRequestTelegram->pNextPdRequestTelegram;
-            vos_memFree(pDeletePdRequestTelegram);
-            pDeletePdRequestTelegram = NULL;
-            break;
-        }
+        *ppHeadPdRequestTelegram = pDeletePdRequestTelegram->pNextPdRequestTelegram;
+    }
+    else
+    {
+        pDeletePdRequestTelegram->pPrevPdRequestTelegram->pNextPdRequestTelegram = pDeletePdRequestTelegram->pNextPdRequestTelegram;
+    }
+    if (pDeletePdRequestTelegram->pNextPdRequestTelegram == NULL)
+    {
+        pTailPdRequestTelegram = pDeletePdRequestTelegram->pPrevPdRequestTelegram;
+    }
+    else
+    {
+        pDeletePdRequestTelegram->pNextPdRequestTelegram->pPrevPdRequestTelegram = pDeletePdRequestTelegram->pPrevPdRequestTelegram;
     }
     /* UnLock PD Request Telegram by Mutex */
     vos_mutexUnlock(pPdRequestTelegramMutex);
+
+    /* Not found by searches any more: drop the pointers kept by TAULpdMainThread, then release it */
+    tau_ldForgetPdRequestTelegram(pDeletePdRequestTelegram);
+    vos_memFree(pDeletePdRequestTelegram);
     return TRDP_NO_ERR;
 }
 
@@ -777,10 +1007,10 @@ PD_REQUEST_TELEGRAM_T *searchPdRequestTelegramList (
             return NULL;
         }
     }
-    /* Check PD Request Telegram List Loop */
-    for (iterPdRequestTelegram = pHeadPdRequestTelegram;
+    /* Check PD Request Telegrams with the same comId hash */
+    for (iterPdRequestTelegram = pHashPdRequestTelegram[TAUL_TELEGRAM_HASH(comId)].pHead;
             iterPdRequestTelegram != NULL;
-            iterPdRequestTelegram = iterPdRequestTelegram->pNextPdRequestTelegram)
+            iterPdRequestTelegram = iterPdRequestTelegram->pNextHashPdRequestTelegram)
     {
         /* PD Request Telegram: We match if src/dst address is zero or matches, and comId */
         if ((iterPdRequestTelegram->comId == comId)
@@ -1337,6 +1567,8 @@ TRDP_ERR_T publishTelegram (
         if (((pExchgPar->pPdPar->flags & TRDP_FLAGS_MARSHALL) == TRDP_FLAGS_MARSHALL)
             || ((arraySessionConfigTAUL[ifIndex].pdConfig.flags & TRDP_FLAGS_MARSHALL) == TRDP_FLAGS_MARSHALL))
         {
+            /* Marshalled from the Traffic Store at send time */
+            pPublishTelegram->marshall = TRUE;
             /* Compute size of marshalled dataset */
             err = tau_calcDatasetSize(
                     marshallConfig.pRefCon,
@@ -1438,6 +1670,8 @@ TRDP_ERR_T publishTelegram (
         err = tlp_publish(
                 pPublishTelegram->appHandle,                                    /* our application identifier */
                 &pPublishTelegram->pubHandle,                                   /* our publish identifier */
+                pPublishTelegram,                                               /* user reference for the pre-send callback */
+                &tau_ldSendPdDs,                                                /* fill the frame from the Traffic Store */
                 pPublishTelegram->comId,                                        /* ComID to send */
                 pPublishTelegram->etbTopoCount,                                 /* ETB topocount to use, 0 if consist local communication */
                 pPublishTelegram->opTrnTopoCount,                               /* operational topocount, != 0 for orientation/direction sensitive communication */
@@ -1460,8 +1694,6 @@ TRDP_ERR_T publishTelegram (
         }
         else
         {
-            /* Set user reference in pSndQueue */
-            pPublishTelegram->pubHandle->pUserRef = &pPublishTelegram->pPdParameter->offset;
             /* Append Publish Telegram */
             err = appendPublishTelegramList(&pHeadPublishTelegram, pPublishTelegram);
             if (err != TRDP_NO_ERR)
@@ -2188,6 +2420,8 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
     UINT32                      replyIpAddrHostByteOrder = 0;
     TRDP_TIME_T             tv_interval = {0};                              /* interval Time :timeval type */
     TRDP_TIME_T             trdp_time_tv_interval = {0};                    /* interval Time :TRDP_TIME_T type for TRDP function */
+    TRDP_APP_SESSION_T      sessions[LADDER_IF_NUMBER];                     /* Subnet1, Subnet2 session */
+    TRDP_SESSION_GROUP_T    sessionGroup;                                   /* sessions served by one select() */
 
     /* Check appHandle */
     while (1)
@@ -2222,10 +2456,9 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
         fd_set  rfds;
         INT32   noOfDesc = 0;
         TRDP_TIME_T  tv = max_tv;
-
-        INT32   noOfDesc2 = 0;
-        TRDP_TIME_T  tv2 = max_tv;
         BOOL8 linkUpDown = TRUE;                        /* Link Up Down information TRUE:Up FALSE:Down */
+        BOOL8 linkEvent = FALSE;                        /* Link Up Down changed */
+        INT32 linkMonitorFd = -1;                       /* Link monitor descriptor */
         UINT32 writeSubnetId;                        /* Using Traffic Store Write Sub-network Id */
 
         /*
@@ -2238,11 +2471,15 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
         This way we can guarantee that PDs are sent in time...
         */
 
-        /* First TRDP instance */
-        tlc_getInterval(appHandle,
-                        (TRDP_TIME_T *) &tv,
-                        (TRDP_FDS_T *) &rfds,
-                        &noOfDesc);
+        /* Both TRDP instances: one descriptor set, one time-out from the earliest job */
+        sessions[0] = appHandle;
+        sessions[1] = appHandle2;
+        sessionGroup.numSessions = (appHandle2 != (TRDP_APP_SESSION_T) LADDER_TOPOLOGY_DISABLE) ? 2u : 1u;
+        sessionGroup.pSession = sessions;
+        tlc_getGroupInterval(&sessionGroup,
+                             (TRDP_TIME_T *) &tv,
+                             (TRDP_FDS_T *) &rfds,
+                             &noOfDesc);
 
         /*
         The wait time for select must consider cycle times and timeouts of
@@ -2250,44 +2487,32 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
         If we need to poll something faster than the lowest PD cycle,
         we need to set the maximum timeout ourselfs
         */
-
         if (vos_cmpTime((TRDP_TIME_T *) &tv, (TRDP_TIME_T *) &max_tv) > 0)
         {
             tv = max_tv;
         }
 
-        /* second TRDP instance */
-        if (appHandle2 != (TRDP_APP_SESSION_T) LADDER_TOPOLOGY_DISABLE)
-        {
-            tlc_getInterval(appHandle2,
-                             (TRDP_TIME_T *) &tv2,
-                             (TRDP_FDS_T *) &rfds,
-                             &noOfDesc2);
-            if (vos_cmpTime((TRDP_TIME_T *) &tv2, (TRDP_TIME_T *) &max_tv) > 0)
-            {
-                tv2 = max_tv;
-            }
-        }
-
         /*
         Select() will wait for ready descriptors or timeout,
         what ever comes first.
         */
-        /* The Number to check descriptor */
-        if (noOfDesc > noOfDesc2)
+        /* Link monitor events wake us up as well */
+        linkMonitorFd = tau_getLinkMonitorFd();
+        if (linkMonitorFd >= 0)
         {
-            noOfDesc = noOfDesc;
-        }
-        else
-        {
-            noOfDesc = noOfDesc2;
+            FD_SET(linkMonitorFd, &rfds);
+            if (linkMonitorFd > noOfDesc)
+            {
+                noOfDesc = linkMonitorFd;
+            }
         }
-
-        if (vos_cmpTime(&tv, &tv2) > 0)
+        rv = vos_select((int)noOfDesc + 1, &rfds, NULL, NULL, (VOS_TIME_T *)&tv);
+        if ((linkMonitorFd >= 0) && (rv > 0) && FD_ISSET(linkMonitorFd, &rfds))
         {
-            tv = tv2;
+            tau_processLinkMonitor();
+            FD_CLR(linkMonitorFd, &rfds);
+            rv--;
         }
-        rv = vos_select((int)noOfDesc + 1, &rfds, NULL, NULL, (VOS_TIME_T *)&tv);
 
         vos_mutexLock(appHandle->mutex);
 
@@ -2301,7 +2526,7 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
             if (iterPD->pFrame->frameHead.msgType == msgTypePrNetworkByteOder)
             {
                 /* Is Now Time send Timing ? */
-                if (vos_cmpTime((TRDP_TIME_T *)&iterPD->timeToGo, (TRDP_TIME_T *)&nowTime) < 0)
+                if (iterPD->timeToGo < VOS_NS_FROM_TIMEVAL(&nowTime))
                 {
                     /* PD Pull (request) ? */
                     if (iterPD->addr.comId != TRDP_GLOBAL_STATISTICS_COMID)
@@ -2309,14 +2534,19 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
                         /* Change Byet Order */
                         replyComIdHostByetOrder = vos_ntohl(iterPD->pFrame->frameHead.replyComId);
                         replyIpAddrHostByteOrder = vos_ntohl(iterPD->pFrame->frameHead.replyIpAddress);
-                        /* Get PD Request Telegram */
-                        pUpdatePdRequestTelegram = searchPdRequestTelegramList(
-                                pHeadPdRequestTelegram,
-                                iterPD->addr.comId,
-                                replyComIdHostByetOrder,
-                                iterPD->addr.srcIpAddr,
-                                iterPD->addr.destIpAddr,
-                                replyIpAddrHostByteOrder);
+                        /* Get PD Request Telegram, searched once and then kept in the request element */
+                        pUpdatePdRequestTelegram = (PD_REQUEST_TELEGRAM_T *) iterPD->pUserRef;
+                        if (pUpdatePdRequestTelegram == NULL)
+                        {
+                            pUpdatePdRequestTelegram = searchPdRequestTelegramList(
+                                    pHeadPdRequestTelegram,
+                                    iterPD->addr.comId,
+                                    replyComIdHostByetOrder,
+                                    iterPD->addr.srcIpAddr,
+                                    iterPD->addr.destIpAddr,
+                                    replyIpAddrHostByteOrder);
+                            iterPD->pUserRef = pUpdatePdRequestTelegram;
+                        }
                         if (pUpdatePdRequestTelegram == NULL)
                         {
                             vos_printLog(VOS_LOG_ERROR, "TAULpdMainThread() Failed. Get PD Request Telegram Err.\n");
@@ -2340,7 +2570,10 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
                             /* Is Now Time send Timing ? */
                             if (vos_cmpTime((TRDP_TIME_T *)&pUpdatePdRequestTelegram->requestSendTime, (TRDP_TIME_T *)&nowTime) < 0)
                             {
-                                /* PD Request */
+                                /* PD Request with a consistent copy of its Traffic Store area */
+                                (void) tau_readTrafficStore((UINT16)pUpdatePdRequestTelegram->pPdParameter->offset,
+                                                            (UINT8 *)ts_buffer,
+                                                            tau_ldTrafficStoreCopySize((UINT16)pUpdatePdRequestTelegram->pPdParameter->offset));
                                 err = tlp_request(
                                         appHandle,
                                         pUpdatePdRequestTelegram->subHandle,
@@ -2352,7 +2585,7 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
                                         pUpdatePdRequestTelegram->pPdParameter->redundant,
                                         pUpdatePdRequestTelegram->pPdParameter->flags,
                                         pUpdatePdRequestTelegram->pSendParam,
-                                        (UINT8 *)((INT32) pTrafficStoreAddr + (UINT16)pUpdatePdRequestTelegram->pPdParameter->offset),
+                                        (UINT8 *)ts_buffer,
                                         pUpdatePdRequestTelegram->datasetNetworkByteSize,
                                         pUpdatePdRequestTelegram->replyComId,
                                         pUpdatePdRequestTelegram->replyIpAddr);
@@ -2375,33 +2608,6 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
                     }
                 }
             }
-            /* Publish Telegram */
-            else
-            {
-                /* Is Now Time send Timing ? */
-                if (vos_cmpTime((TRDP_TIME_T *)&iterPD->timeToGo, (TRDP_TIME_T *)&nowTime) < 0)
-                {
-                    /* Check comId which Publish our statistics packet */
-                    if (iterPD->addr.comId != TRDP_GLOBAL_STATISTICS_COMID)
-                    {
-                        /* Update Publish Dataset */
-                        tau_ldLockTrafficStore();
-                        memcpy((void *)ts_buffer,
-                                 (UINT8 *)((INT32)pTrafficStoreAddr + *(UINT16*)(iterPD->pUserRef)),
-                                 2048);
-                        tau_ldUnlockTrafficStore();
-                        err = tlp_put(
-                                appHandle,
-                                iterPD,
-                                (UINT8 *)ts_buffer,
-                                iterPD->dataSize);
-                        if (err != TRDP_NO_ERR)
-                        {
-                            vos_printLog(VOS_LOG_ERROR, "TAULpdMainThread() Failed. tlp_put() Err: %d\n", err);
-                        }
-                    }
-                }
-            }
         }
         vos_mutexUnlock(appHandle->mutex);
 
@@ -2424,14 +2630,19 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
                         /* Change Byet Order */
                         replyComIdHostByetOrder = vos_ntohl(iterPD->pFrame->frameHead.replyComId);
                         replyIpAddrHostByteOrder = vos_ntohl(iterPD->pFrame->frameHead.replyIpAddress);
-                        /* Get PD Request Telegram */
-                        pUpdatePdRequestTelegram = searchPdRequestTelegramList(
-                                pHeadPdRequestTelegram,
-                                iterPD->addr.comId,
-                                replyComIdHostByetOrder,
-                                iterPD->addr.srcIpAddr,
-                                iterPD->addr.destIpAddr,
-                                replyIpAddrHostByteOrder);
+                        /* Get PD Request Telegram, searched once and then kept in the request element */
+                        pUpdatePdRequestTelegram = (PD_REQUEST_TELEGRAM_T *) iterPD->pUserRef;
+                        if (pUpdatePdRequestTelegram == NULL)
+                        {
+                            pUpdatePdRequestTelegram = searchPdRequestTelegramList(
+                                    pHeadPdRequestTelegram,
+                                    iterPD->addr.comId,
+                                    replyComIdHostByetOrder,
+                                    iterPD->addr.srcIpAddr,
+                                    iterPD->addr.destIpAddr,
+                                    replyIpAddrHostByteOrder);
+                            iterPD->pUserRef = pUpdatePdRequestTelegram;
+                        }
                         if (pUpdatePdRequestTelegram == NULL)
                         {
                             vos_printLog(VOS_LOG_ERROR, "TAULpdMainThread() Failed. Get PD Request Telegram Err.\n");
@@ -2455,7 +2666,10 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
                             /* Is Now Time send Timing ? */
                             if (vos_cmpTime((TRDP_TIME_T *)&pUpdatePdRequestTelegram->requestSendTime, (TRDP_TIME_T *)&nowTime) < 0)
                             {
-                                /* PD Request */
+                                /* PD Request with a consistent copy of its Traffic Store area */
+                                (void) tau_readTrafficStore((UINT16)pUpdatePdRequestTelegram->pPdParameter->offset,
+                                                            (UINT8 *)ts_buffer,
+                                                            tau_ldTrafficStoreCopySize((UINT16)pUpdatePdRequestTelegram->pPdParameter->offset));
                                 err = tlp_request(
                                         appHandle2,
                                         pUpdatePdRequestTelegram->subHandle,
@@ -2467,7 +2681,7 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
                                         pUpdatePdRequestTelegram->pPdParameter->redundant,
                                         pUpdatePdRequestTelegram->pPdParameter->flags,
                                         pUpdatePdRequestTelegram->pSendParam,
-                                        (UINT8 *)((INT32) pTrafficStoreAddr + (UINT16)pUpdatePdRequestTelegram->pPdParameter->offset),
+                                        (UINT8 *)ts_buffer,
                                         pUpdatePdRequestTelegram->datasetNetworkByteSize,
                                         pUpdatePdRequestTelegram->replyComId,
                                         pUpdatePdRequestTelegram->replyIpAddr);
@@ -2489,33 +2703,6 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
                         }
                     }
                 }
-                /* Publish Telegram */
-                else
-                {
-                    /* Is Now Time send Timing ? */
-                    if (vos_cmpTime((TRDP_TIME_T *)&iterPD->timeToGo, (TRDP_TIME_T *)&nowTime) < 0)
-                    {
-                        /* Check comId which Publish our statistics packet */
-                        if (iterPD->addr.comId != TRDP_GLOBAL_STATISTICS_COMID)
-                        {
-                            /* Update Publish Dataset */
-                            tau_ldLockTrafficStore();
-                            memcpy((void *)ts_buffer,
-                                     (UINT8 *)((INT32)pTrafficStoreAddr + *(UINT16*)(iterPD->pUserRef)),
-                                     2048);
-                            tau_ldUnlockTrafficStore();
-                            err = tlp_put(
-                                    appHandle2,
-                                    iterPD,
-                                    (UINT8 *)ts_buffer,
-                                    iterPD->dataSize);
-                            if (err != TRDP_NO_ERR)
-                            {
-                                vos_printLog(VOS_LOG_ERROR, "TAULpdMainThread() Failed. tlp_put() Err: %d\n", err);
-                            }
-                        }
-                    }
-                }
             }
             vos_mutexUnlock(appHandle2->mutex);
         }
@@ -2530,8 +2717,13 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
         function (in it's context and thread)!
         */
 
-        /* Don't Receive ? AND Ladder Topology */
-        if ((rv <= 0) && (appHandle2 != (TRDP_APP_SESSION_T) LADDER_TOPOLOGY_DISABLE))
+        /* Link Up Down changed ? (without link monitor: polled when nothing was received) */
+        if (tau_getLinkEvent(&linkEvent) != TRDP_NO_ERR)
+        {
+            linkEvent = (rv <= 0) ? TRUE : FALSE;
+        }
+        /* Link Up Down changed AND Ladder Topology */
+        if ((linkEvent == TRUE) && (appHandle2 != (TRDP_APP_SESSION_T) LADDER_TOPOLOGY_DISABLE))
         {
             /* Get Write Traffic Store Receive SubnetId */
             err = tau_getNetworkContext(&writeSubnetId);
@@ -2570,16 +2762,9 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
             }
         }
 
-        /* First TRDP instance, calls the call back function to handle1 received data
-        * and copy them into the Traffic Store using offset address from configuration. */
-        tlc_process(appHandle, (TRDP_FDS_T *) &rfds, &rv);
-
-        /* Second TRDP instance, calls the call back function to handle1 received data
-        * and copy them into the Traffic Store using offset address from configuration. */
-        if (appHandle2 != (TRDP_APP_SESSION_T) LADDER_TOPOLOGY_DISABLE)
-        {
-            tlc_process(appHandle2, (TRDP_FDS_T *) &rfds, &rv);
-        }
+        /* Both TRDP instances in one pass, the call back function copies received data
+        * into the Traffic Store using offset address from configuration. */
+        tlc_processGroup(&sessionGroup, (TRDP_FDS_T *) &rfds, &rv);
     }   /*    Bottom of while-loop    */
 }
 
@@ -2611,12 +2796,7 @@ TRDP_ERR_T tau_ldInit (
     UINT32 getNoOfIfaces = NUM_ED_INTERFACES;
     VOS_IF_REC_T ifAddressTable[NUM_ED_INTERFACES];
     TRDP_IP_ADDR_T ownIpAddress = 0;
-#ifdef __linux
-    CHAR8 SUBNETWORK_ID1_IF_NAME[] = "eth0";
-//#elif defined(__APPLE__)
-#else
-    CHAR8 SUBNETWORK_ID1_IF_NAME[] = "en0";
-#endif
+    const CHAR8 *pSubnet1IfName = NULL;
 
     /* Clear application handles */
     appHandle = NULL;
@@ -2626,6 +2806,13 @@ TRDP_ERR_T tau_ldInit (
     pHeadPublishTelegram = NULL;
     pHeadSubscribeTelegram = NULL;
     pHeadPdRequestTelegram = NULL;
+    pTailPublishTelegram = NULL;
+    pTailSubscribeTelegram = NULL;
+    pTailPdRequestTelegram = NULL;
+    pHashPublishTelegram = NULL;
+    pHashSubscribeTelegram = NULL;
+    pHashPdRequestTelegram = NULL;
+    telegramHashSize = 0u;
 
     /* Clear mutex pointers */
     pPublishTelegramMutex = NULL;
@@ -2663,6 +2850,18 @@ TRDP_ERR_T tau_ldInit (
     }
 #endif /* ifdef XML_CONFIG_ENABLE */
 
+    /* Monitored interfaces: names of the configured subnet1/subnet2 interfaces */
+    for (ifIndex = 0; (ifIndex < numIfConfig) && (ifIndex < LADDER_IF_NUMBER); ifIndex++)
+    {
+        if ((pIfConfig[ifIndex].ifName[0] != 0)
+            && (tau_setLinkIfName((ifIndex == IF_INDEX_SUBNET1) ? SUBNET1 : SUBNET2,
+                                  pIfConfig[ifIndex].ifName) != TRDP_NO_ERR))
+        {
+            vos_printLog(VOS_LOG_WARNING, "tau_ldInit() I/F name %s ignored\n", pIfConfig[ifIndex].ifName);
+        }
+    }
+    pSubnet1IfName = tau_getLinkIfName(SUBNET1);
+
     /*  Init the TRDP library  */
     err = tlc_init(pPrintDebugString,            /* debug print function */
                         &memoryConfigTAUL);                /* Use application supplied memory */
@@ -2681,7 +2880,7 @@ TRDP_ERR_T tau_ldInit (
     /* Get All I/F List */
     for (index = 0; index < getNoOfIfaces; index++)
     {
-        if (strncmp(ifAddressTable[index].name, SUBNETWORK_ID1_IF_NAME, sizeof(SUBNETWORK_ID1_IF_NAME)) == 0)
+        if (strncmp(ifAddressTable[index].name, pSubnet1IfName, sizeof(ifAddressTable[index].name)) == 0)
         {
                 /* Get Sub-net Id1 Address */
             subnetId1Address = (TRDP_IP_ADDR_T)(ifAddressTable[index].ipAddr);
@@ -2809,6 +3008,18 @@ TRDP_ERR_T tau_ldInit (
         vos_printLog(VOS_LOG_ERROR, "tau_ldInit() failed. TRDP Ladder Support Initialize failed\n");
         return err;
     }
+    /* Link up/down events for the subnet switchover */
+    if (tau_openLinkMonitor() != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_WARNING, "tau_ldInit() no link monitor, link state is polled\n");
+    }
+    /* comId hash of the telegram registries: one bucket per configured telegram */
+    err = tau_ldTelegramHashInit(numIfConfig * numExchgPar);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "tau_ldInit() failed. tau_ldTelegramHashInit() error.\n");
+        return err;
+    }
     /* Get Telegram Loop */
     for (ifIndex = 0; ifIndex < numIfConfig; ifIndex++)
     {
@@ -3162,6 +3373,9 @@ TRDP_ERR_T tau_ldTerminate (
         appHandle2 = NULL;
     }
 
+    /* Release the comId hash of the telegram registries */
+    tau_ldTelegramHashFree();
+
     /* Delete mutexes */
     if (pPublishTelegramMutex)
         vos_mutexDelete(pPublishTelegramMutex);
@@ -3387,6 +3601,7 @@ void tau_ldRecvPdDs (
     UINT32 subnetId;                            /* Using Sub-network Id */
     UINT32 displaySubnetId;                /* Using Sub-network Id for Display log */
     UINT16 offset;                                        /* Traffic Store Offset Address */
+    UINT32 tsSize;                                        /* Traffic Store area written by unmarshalling */
     extern UINT8 *pTrafficStoreAddr;            /* pointer to pointer to Traffic Store Address */
 
     SUBSCRIBE_TELEGRAM_T *pSubscribeTelegram;
@@ -3442,9 +3657,7 @@ void tau_ldRecvPdDs (
             /* Clear Traffic Store */
             /* Get offset Address */
             offset = (UINT16)pSubscribeTelegram->pPdParameter->offset;
-            tau_ldLockTrafficStore();
-            memset((void *)((INT32)pTrafficStoreAddr + offset), 0, pSubscribeTelegram->dataset.size);
-            tau_ldUnlockTrafficStore();
+            (void) tau_writeTrafficStore(offset, NULL, pSubscribeTelegram->dataset.size);
 
             /* Set sunbetId for display log */
             if( subnetId == SUBNET1)
@@ -3467,8 +3680,9 @@ void tau_ldRecvPdDs (
         /* Check Marshalling Kind : Marshalling Enable */
         if ((pSubscribeTelegram->pPdParameter->flags & TRDP_FLAGS_MARSHALL) == TRDP_FLAGS_MARSHALL)
         {
-            /* unmarshalling */
-            tau_ldLockTrafficStore();
+            /* unmarshalling into the Traffic Store area, readers of it retry meanwhile */
+            tsSize = pSubscribeTelegram->dataset.size;
+            (void) tau_beginWriteTrafficStore(offset, tsSize);
             err = tau_unmarshall(
                         &marshallConfig.pRefCon,                                        /* pointer to user context*/
                         pPDInfo->comId,                                                 /* comId */
@@ -3476,7 +3690,7 @@ void tau_ldRecvPdDs (
                         (UINT8 *)((INT32)pTrafficStoreAddr + (INT32)offset),            /* destination pointer to a buffer for the treated message */
                         &pSubscribeTelegram->dataset.size,                              /* destination Buffer Size */
                         &pSubscribeTelegram->pDatasetDescriptor);                       /* pointer to pointer of cached dataset */
-            tau_ldUnlockTrafficStore();
+            (void) tau_endWriteTrafficStore(offset, tsSize);
             if (err != TRDP_NO_ERR)
             {
                 vos_printLog(VOS_LOG_ERROR, "tau_unmarshall returns error %d\n", err);
@@ -3486,11 +3700,81 @@ void tau_ldRecvPdDs (
         else
         {
             /* Set received PD Data in Traffic Store */
-            tau_ldLockTrafficStore();
-            memcpy((void *)((INT32)pTrafficStoreAddr + offset), pData, dataSize);
-            tau_ldUnlockTrafficStore();
+            if (tau_writeTrafficStore(offset, pData, dataSize) != TRDP_NO_ERR)
+            {
+                vos_printLog(VOS_LOG_ERROR, "comId:%d does not fit into the Traffic Store\n", pPDInfo->comId);
+            }
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/** callback function PD send: fill the outgoing frame from the Traffic Store
+ *
+ *  Called by the stack right before a publication is sent, the dataset is copied (or marshalled)
+ *  from its Traffic Store area straight into the frame.
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      argAppHandle    application handle returned by tlc_openSession
+ *  @param[in]      pPDInfo         pointer to PDInformation, pUserRef is the Publish Telegram
+ *  @param[in]      pData           pointer to the dataset of the frame
+ *  @param[in]      dataSize        dataset size of the frame
+ *
+ */
+void tau_ldSendPdDs (
+    void *pRefCon,
+    TRDP_APP_SESSION_T argAppHandle,
+    const TRDP_PD_INFO_T *pPDInfo,
+    UINT8 *pData,
+    UINT32 dataSize)
+{
+    UINT16 offset;                                        /* Traffic Store Offset Address */
+    UINT32 destSize;                                      /* marshalled size */
+    UINT64 seq;                                           /* Traffic Store read section */
+    extern UINT8 *pTrafficStoreAddr;            /* pointer to pointer to Traffic Store Address */
+
+    PUBLISH_TELEGRAM_T *pPublishTelegram;
+    TRDP_ERR_T err = TRDP_NO_ERR;
+
+    if ((pData == NULL) || (dataSize == 0) || (pPDInfo == NULL)
+        || ((pPublishTelegram = (PUBLISH_TELEGRAM_T *)pPDInfo->pUserRef) == NULL))
+    {
+        return;
+    }
+
+    /* Get offset Address */
+    offset = (UINT16)pPublishTelegram->pPdParameter->offset;
+    /* Check Marshalling Kind : Marshalling Enable */
+    if (pPublishTelegram->marshall == TRUE)
+    {
+        /* marshalling out of the Traffic Store area, again if a writer interfered */
+        do
+        {
+            if (tau_beginReadTrafficStore(offset, pPublishTelegram->dataset.size, &seq) != TRDP_NO_ERR)
+            {
+                return;
+            }
+            destSize = dataSize;
+            err = tau_marshall(
+                        marshallConfig.pRefCon,                                         /* pointer to user context */
+                        pPDInfo->comId,                                                 /* comId */
+                        pTrafficStoreAddr + offset,                                     /* source: Traffic Store area */
+                        pPublishTelegram->dataset.size,                                 /* source size */
+                        pData,                                                          /* destination: frame dataset */
+                        &destSize,                                                      /* destination Buffer Size */
+                        &pPublishTelegram->pDatasetDescriptor);                         /* pointer to pointer of cached dataset */
+        }
+        while (tau_retryReadTrafficStore(offset, pPublishTelegram->dataset.size, seq) == TRUE);
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_ERROR, "comId:%d tau_marshall returns error %d\n", pPDInfo->comId, err);
         }
     }
+    /* Marshalling Disable */
+    else
+    {
+        (void) tau_readTrafficStore(offset, pData, dataSize);
+    }
 }
 
 /**********************************************************************************************************************/
@@ -17,6 +17,9 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Telegram registries doubly linked for O(1) delete
+ *      AG 2026-10-18: Telegram registries chained per comId hash bucket
+ *      AG 2026-10-18: tau_ldSendPdDs, publications sent straight from the Traffic Store
  */
 
 #ifndef TAU_LDLADDER_H_
@@ -127,6 +130,7 @@ typedef struct PUBLISH_TELEGRAM
 	TRDP_PUB_T							pubHandle;						/* returned handle for related unprepare */
 	DATASET_T							dataset;						/* dataset (size, buffer) */
 	UINT32								datasetNetworkByteSize;		/* dataset size by networkByteOrder */
+	BOOL8								marshall;						/* marshalled from the Traffic Store at send time */
 	pTRDP_DATASET_T					pDatasetDescriptor;			/* Dataset Descriptor */
 	TRDP_IF_CONFIG_T					*pIfConfig;					/* pointer to I/F Config */
 	TRDP_PD_PAR_T						*pPdParameter;				/* pointer to PD Parameter */
@@ -137,6 +141,9 @@ typedef struct PUBLISH_TELEGRAM
 	TRDP_IP_ADDR_T					dstIpAddr;						/* where to send the packet to */
 	TRDP_SEND_PARAM_T					*pSendParam;					/* optional pointer to send parameter, NULL - default parameters are used */
 	struct PUBLISH_TELEGRAM			*pNextPublishTelegram;		/* pointer to next Publish Telegram or NULL */
+	struct PUBLISH_TELEGRAM			*pNextHashPublishTelegram;	/* pointer to next Publish Telegram in the same comId hash bucket or NULL */
+	struct PUBLISH_TELEGRAM			*pPrevPublishTelegram;		/* pointer to previous Publish Telegram or NULL */
+	struct PUBLISH_TELEGRAM			*pPrevHashPublishTelegram;	/* pointer to previous Publish Telegram in the same comId hash bucket or NULL */
 } PUBLISH_TELEGRAM_T;
 
 /* Subscribe Telegram */
@@ -156,6 +163,9 @@ typedef struct SUBSCRIBE_TELEGRAM
 	TRDP_IP_ADDR_T					srcIpAddr;					/* IP for source filtering, set 0 if not used */
 	TRDP_IP_ADDR_T					dstIpAddr;						/* IP address to join */
 	struct SUBSCRIBE_TELEGRAM		*pNextSubscribeTelegram;		/* pointer to next Subscribe Telegram or NULL */
+	struct SUBSCRIBE_TELEGRAM		*pNextHashSubscribeTelegram;	/* pointer to next Subscribe Telegram in the same comId hash bucket or NULL */
+	struct SUBSCRIBE_TELEGRAM		*pPrevSubscribeTelegram;		/* pointer to previous Subscribe Telegram or NULL */
+	struct SUBSCRIBE_TELEGRAM		*pPrevHashSubscribeTelegram;	/* pointer to previous Subscribe Telegram in the same comId hash bucket or NULL */
 } SUBSCRIBE_TELEGRAM_T;
 
 /* PD Request Telegram */
@@ -178,6 +188,9 @@ typedef struct PD_REQUEST_TELEGRAM
 	TRDP_SEND_PARAM_T					*pSendParam;					/* optional pointer to send parameter, NULL - default parameters are used */
 	TRDP_TIME_T						requestSendTime;				/* next Request Send Timing */
 	struct PD_REQUEST_TELEGRAM	*pNextPdRequestTelegram;		/* pointer to next PD Request Telegram or NULL */
+	struct PD_REQUEST_TELEGRAM	*pNextHashPdRequestTelegram;	/* pointer to next PD Request Telegram in the same comId hash bucket or NULL */
+	struct PD_REQUEST_TELEGRAM	*pPrevPdRequestTelegram;		/* pointer to previous PD Request Telegram or NULL */
+	struct PD_REQUEST_TELEGRAM	*pPrevHashPdRequestTelegram;	/* pointer to previous PD Request Telegram in the same comId hash bucket or NULL */
 } PD_REQUEST_TELEGRAM_T;
 
 /* comId-IP Address Handle */
@@ -671,6 +684,23 @@ void tau_ldRecvPdDs (
     UINT8 *pData,
     UINT32 dataSize);
 
+/**********************************************************************************************************************/
+/** callback function PD send, fills the frame from the Traffic Store
+ *
+ *  @param[in]		pRefCon			user supplied context pointer
+ *  @param[in]		argAppHandle	application handle returned by tlc_openSession
+ *  @param[in]		pPDInfo			pointer to PDInformation, pUserRef: Publish Telegram
+ *  @param[in]		pData			pointer to the frame dataset
+ *  @param[in]		dataSize		frame dataset size
+ *
+ */
+void tau_ldSendPdDs (
+    void *pRefCon,
+    TRDP_APP_SESSION_T argAppHandle,
+    const TRDP_PD_INFO_T *pPDInfo,
+    UINT8 *pData,
+    UINT32 dataSize);
+
 /**********************************************************************************************************************/
 /** All UnPublish
  *
@@ -18,6 +18,8 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Compiled configuration image (tau_compileXmlConfig, tau_prepareXmlImage, tau_readImage...)
+ *      AG 2026-10-18: tau_prepareXmlMem added
  *      BL 2017-05-08: Compiler warnings, flag enums -> defines
  *      BL 2016-02-11: Ticket #102: Custom XML parser, libxml2 not needed anymore
  */
@@ -173,6 +175,17 @@ typedef struct
     struct XML_HANDLE *pXmlDocument;           /**< XML document context */
 } TRDP_XML_DOC_HANDLE_T;
 
+struct TAU_XML_IMAGE;
+
+/** Compiled configuration image handle
+ */
+typedef struct
+{
+    struct TAU_XML_IMAGE    *pImage;            /**< Mapped (or loaded) image       */
+    UINT32                  imageSize;          /**< Size of the image in bytes     */
+    BOOL8                   mapped;             /**< TRUE if the file is mapped     */
+} TRDP_XML_IMAGE_HANDLE_T;
+
 
 /***********************************************************************************************************************
  * PROTOTYPES
@@ -200,6 +213,26 @@ EXT_DECL TRDP_ERR_T tau_prepareXmlDoc (
     TRDP_XML_DOC_HANDLE_T   *pDocHnd
     );
 
+/**********************************************************************************************************************/
+/**    Prepare an XML configuration held in memory for reading.
+ *      The buffer is not copied, it must stay valid until tau_freeXmlDoc is called.
+ *
+ *
+ *  @param[in]      pBuffer           XML document
+ *  @param[in]      bufSize           Size of the document
+ *  @param[out]     pDocHnd           Handle of the parsed XML document
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error
+ *  @retval         TRDP_MEM_ERR      out of memory
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_prepareXmlMem (
+    const CHAR8             *pBuffer,
+    UINT32                  bufSize,
+    TRDP_XML_DOC_HANDLE_T   *pDocHnd
+    );
+
 /**********************************************************************************************************************/
 /**    Free all the memory allocated by tau_prepareXmlDoc
  *
@@ -319,6 +352,130 @@ EXT_DECL void tau_freeTelegrams (
     UINT32              numExchgPar,
     TRDP_EXCHG_PAR_T    *pExchgPar);
 
+/**********************************************************************************************************************/
+/*    Compiled configuration
+                                                                                                   */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/**    Compile the results of all tau_readXml... functions into a binary configuration image.
+ *
+ *  The image holds the parsed structures in native layout, linked for a preferred load address, with a relocation
+ *  table, a version and a checksum. It is only valid for the platform (pointer size, byte order, structure layout)
+ *  of the compiling program.
+ *
+ *  @param[in]      pDocHnd           Handle of the XML document prepared by tau_prepareXmlDoc
+ *  @param[in]      pImageFileName    Path and filename of the image to write
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error or XML configuration not readable
+ *  @retval         TRDP_MEM_ERR      out of memory
+ *  @retval         TRDP_IO_ERR       image could not be written
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_compileXmlConfig (
+    const TRDP_XML_DOC_HANDLE_T *pDocHnd,
+    const CHAR8                 *pImageFileName);
+
+/**********************************************************************************************************************/
+/**    Map a configuration image compiled by tau_compileXmlConfig.
+ *
+ *  The image is mapped copy-on-write at its preferred address if possible, so pages which are only read are shared
+ *  by all processes using the same image. Otherwise it is relocated after loading.
+ *
+ *  @param[in]      pImageFileName    Path and filename of the image
+ *  @param[out]     pImgHnd           Handle of the mapped image
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error, wrong version, platform or checksum
+ *  @retval         TRDP_IO_ERR       image could not be read
+ *  @retval         TRDP_MEM_ERR      out of memory
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_prepareXmlImage (
+    const CHAR8             *pImageFileName,
+    TRDP_XML_IMAGE_HANDLE_T *pImgHnd);
+
+/**********************************************************************************************************************/
+/**    Unmap a configuration image. All configuration data obtained from the image becomes invalid.
+ *
+ *  @param[in]      pImgHnd           Handle of the mapped image
+ *
+ */
+EXT_DECL void tau_freeXmlImage (
+    TRDP_XML_IMAGE_HANDLE_T *pImgHnd);
+
+/**********************************************************************************************************************/
+/**    Get the device configuration from a configuration image, see tau_readXmlDeviceConfig.
+ *  The arrays are part of the image and must not be freed.
+ *
+ *  @param[in]      pImgHnd           Handle of the mapped image
+ *  @param[out]     pMemConfig        Memory configuration
+ *  @param[out]     pDbgConfig        Debug printout configuration for application use
+ *  @param[out]     pNumComPar        Number of configured com parameters
+ *  @param[out]     ppComPar          Pointer to array of com parameters
+ *  @param[out]     pNumIfConfig      Number of configured interfaces
+ *  @param[out]     ppIfConfig        Pointer to an array of interface parameter sets
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readImageDeviceConfig (
+    const TRDP_XML_IMAGE_HANDLE_T   *pImgHnd,
+    TRDP_MEM_CONFIG_T               *pMemConfig,
+    TRDP_DBG_CONFIG_T               *pDbgConfig,
+    UINT32                          *pNumComPar,
+    TRDP_COM_PAR_T                  * *ppComPar,
+    UINT32                          *pNumIfConfig,
+    TRDP_IF_CONFIG_T                * *ppIfConfig);
+
+/**********************************************************************************************************************/
+/**    Get the telegram configuration of an interface from a configuration image, see tau_readXmlInterfaceConfig.
+ *  The array of telegrams is part of the image and must not be freed.
+ *
+ *  @param[in]      pImgHnd           Handle of the mapped image
+ *  @param[in]      pIfName           Interface name
+ *  @param[out]     pProcessConfig    TRDP process (session) configuration for the interface
+ *  @param[out]     pPdConfig         PD default configuration for the interface
+ *  @param[out]     pMdConfig         MD default configuration for the interface
+ *  @param[out]     pNumExchgPar      Number of configured telegrams
+ *  @param[out]     ppExchgPar        Pointer to array of telegram configurations
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error or interface not configured
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readImageInterfaceConfig (
+    const TRDP_XML_IMAGE_HANDLE_T   *pImgHnd,
+    const CHAR8                     *pIfName,
+    TRDP_PROCESS_CONFIG_T           *pProcessConfig,
+    TRDP_PD_CONFIG_T                *pPdConfig,
+    TRDP_MD_CONFIG_T                *pMdConfig,
+    UINT32                          *pNumExchgPar,
+    TRDP_EXCHG_PAR_T                * *ppExchgPar);
+
+/**********************************************************************************************************************/
+/**    Get the dataset configuration from a configuration image, see tau_readXmlDatasetConfig.
+ *  The map and the datasets are part of the image and must not be freed.
+ *
+ *  @param[in]      pImgHnd           Handle of the mapped image
+ *  @param[out]     pNumComId         Pointer to the number of entries in the ComId DatasetId mapping list
+ *  @param[out]     ppComIdDsIdMap    Pointer to an array of a structures of type TRDP_COMID_DSID_MAP_T
+ *  @param[out]     pNumDataset       Pointer to the number of datasets found in the configuration
+ *  @param[out]     papDataset        Pointer to an array of pointers to a structures of type TRDP_DATASET_T
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readImageDatasetConfig (
+    const TRDP_XML_IMAGE_HANDLE_T   *pImgHnd,
+    UINT32                          *pNumComId,
+    TRDP_COMID_DSID_MAP_T           * *ppComIdDsIdMap,
+    UINT32                          *pNumDataset,
+    papTRDP_DATASET_T               papDataset);
+
 #ifdef __cplusplus
 }
 #endif
@@ -16,6 +16,12 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: tlp_getSources, tlp_getSourceByIndex, tlp_getSourceByAddr (TRDP_FLAGS_MULTI_SRC)
+ *      AG 2026-10-18: tlc_getTrace/tlc_dumpTrace: hot path trace (TRDP_TRACE)
+ *      AG 2026-10-18: tlc_openStatisticsExport/tlc_closeStatisticsExport: statistics in shared memory
+ *      AG 2026-10-18: tlc_getPdTimingStatistics: PD send lateness, inter-arrival and callback runtime histograms
+ *      AG 2026-10-18: tlc_getGroupInterval/tlc_processGroup: several sessions served by one select()
+ *      AG 2026-10-18: tlc_applyConfig: publish and subscribe a whole configuration in one call
  *      BL 2018-03-06: Ticket #101 Optional callback function on PD send
  *      BL 2018-02-03: Ticket #190 Source filtering (IP-range) for PD subscribe
  *      BL 2017-11-28: Ticket #180 Filtering rules for DestinationURI does not follow the standard
@@ -259,6 +265,47 @@ EXT_DECL TRDP_ERR_T tlc_process (
     TRDP_FDS_T          *pRfds,
     INT32               *pCount);
 
+/**********************************************************************************************************************/
+/** Get the lowest time interval for a group of sessions (select-merging helper).
+ *  Like tlc_getInterval, but the descriptors of all sessions are collected into one set and one time-out
+ *  is computed from the earliest job of all sessions, so one select() serves the whole group.
+ *  Each session is still locked and its queues are scanned on their own, as by tlc_getInterval.
+ *  There is no deadline ordering shared by the group.
+ *
+ *  @param[in,out]  pGroup              sessions to check, returns the earliest job in nextJob
+ *  @param[out]     pInterval           pointer to needed interval
+ *  @param[in,out]  pFileDesc           pointer to file descriptor set
+ *  @param[in,out]  pNoDesc             pointer to highest used descriptor (for select())
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_NOINIT_ERR     a handle is invalid, the other sessions are checked
+ */
+EXT_DECL TRDP_ERR_T tlc_getGroupInterval (
+    TRDP_SESSION_GROUP_T    *pGroup,
+    TRDP_TIME_T             *pInterval,
+    TRDP_FDS_T              *pFileDesc,
+    INT32                   *pNoDesc);
+
+/**********************************************************************************************************************/
+/** Work loop of the TRDP handler for a group of sessions (select-merging helper).
+ *  Runs tlc_process for every session after one select(), with one time stamp for the whole group.
+ *  Each session is still locked and its queues are scanned on their own.
+ *
+ *  @param[in]      pGroup              sessions to process
+ *  @param[in]      pRfds               pointer to set of ready descriptors
+ *  @param[in,out]  pCount              pointer to number of ready descriptors
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_NOINIT_ERR     a handle is invalid, the other sessions are processed
+ *  @retval         other               last error of the sessions
+ */
+EXT_DECL TRDP_ERR_T tlc_processGroup (
+    TRDP_SESSION_GROUP_T    *pGroup,
+    TRDP_FDS_T              *pRfds,
+    INT32                   *pCount);
+
 /**********************************************************************************************************************/
 /** Get the interface address
  *
@@ -495,6 +542,33 @@ EXT_DECL TRDP_ERR_T tlp_subscribe (
     TRDP_TO_BEHAVIOR_T  toBehavior);
 
 
+/**********************************************************************************************************************/
+/** Publish and subscribe many telegrams at once.
+ *  Has the same effect as calling tlp_publish and tlp_subscribe for each entry in turn, but the session is locked
+ *  once, duplicates and redundant publishers are found through a temporary comId index, sockets are reused for
+ *  entries with the same parameters, and the queues are built in one pass.
+ *  Entries which fail are skipped; their result is set and their handle is NULL.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      numPub              number of publications
+ *  @param[in,out]  pPub                array of publications, returns handles and results
+ *  @param[in]      numSub              number of subscriptions
+ *  @param[in,out]  pSub                array of subscriptions, returns handles and results
+ *
+ *  @retval         TRDP_NO_ERR         all entries were applied
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        out of memory
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         other               result of the first failed entry
+ */
+EXT_DECL TRDP_ERR_T tlc_applyConfig (
+    TRDP_APP_SESSION_T      appHandle,
+    UINT32                  numPub,
+    TRDP_PUBLISH_PAR_T      *pPub,
+    UINT32                  numSub,
+    TRDP_SUBSCRIBE_PAR_T    *pSub);
+
+
 /**********************************************************************************************************************/
 /** Reprepare for receiving PD messages.
  *  Resubscribe to a specific PD ComID and source IP
@@ -563,6 +637,76 @@ EXT_DECL TRDP_ERR_T tlp_get (
     UINT8               *pData,
     UINT32              *pDataSize);
 
+/**********************************************************************************************************************/
+/** Return the number of senders of a multi source subscription (TRDP_FLAGS_MULTI_SRC).
+ *  Senders are numbered in the order of their first packet, from 0 to *pNumSources - 1.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by subscription
+ *  @param[out]     pNumSources         number of senders received from so far
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error or no multi source subscription
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlp_getSources (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    UINT32              *pNumSources);
+
+/**********************************************************************************************************************/
+/** Get the last valid PD message of one sender of a multi source subscription (TRDP_FLAGS_MULTI_SRC).
+ *  Each sender is supervised with the time out of the subscription on its own.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by subscription
+ *  @param[in]      index               number of the sender (0 ... tlp_getSources - 1)
+ *  @param[in,out]  pPdInfo             pointer to application's info buffer
+ *  @param[in,out]  pData               pointer to application's data buffer
+ *  @param[in,out]  pDataSize           in: size of buffer, out: size of data
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error, no multi source subscription or index out of range
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ *  @retval         TRDP_TIMEOUT_ERR    sender timed out
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_COMID_ERR      ComID not found when marshalling
+ */
+EXT_DECL TRDP_ERR_T tlp_getSourceByIndex (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    UINT32              index,
+    TRDP_PD_INFO_T      *pPdInfo,
+    UINT8               *pData,
+    UINT32              *pDataSize);
+
+/**********************************************************************************************************************/
+/** Get the last valid PD message of a sender of a multi source subscription (TRDP_FLAGS_MULTI_SRC).
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by subscription
+ *  @param[in]      srcIpAddr           source IP address of the sender
+ *  @param[in,out]  pPdInfo             pointer to application's info buffer
+ *  @param[in,out]  pData               pointer to application's data buffer
+ *  @param[in,out]  pDataSize           in: size of buffer, out: size of data
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error or no multi source subscription
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ *  @retval         TRDP_NODATA_ERR     nothing received from this sender
+ *  @retval         TRDP_TIMEOUT_ERR    sender timed out
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_COMID_ERR      ComID not found when marshalling
+ */
+EXT_DECL TRDP_ERR_T tlp_getSourceByAddr (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    TRDP_IP_ADDR_T      srcIpAddr,
+    TRDP_PD_INFO_T      *pPdInfo,
+    UINT8               *pData,
+    UINT32              *pDataSize);
+
 
 
 #if MD_SUPPORT
@@ -621,7 +765,9 @@ EXT_DECL TRDP_ERR_T tlm_notify (
  *  @param[in]      opTrnTopoCnt        operational topocount, != 0 for orientation/direction sensitive communication
  *  @param[in]      srcIpAddr           own IP address, 0 - srcIP will be set by the stack
  *  @param[in]      destIpAddr          where to send the packet to
- *  @param[in]      pktFlags            OPTIONS: TRDP_FLAGS_DEFAULT, TRDP_FLAGS_MARSHALL, TRDP_PLAGS_TCP
+ *  @param[in]      pktFlags            OPTIONS: TRDP_FLAGS_DEFAULT, TRDP_FLAGS_MARSHALL, TRDP_PLAGS_TCP,
+ *                                      TRDP_FLAGS_NOCOPY (pData must stay valid until the session has finished),
+ *                                      TRDP_FLAGS_AGGREGATE (all replies in one callback, see TRDP_MD_REPLY_REC_T)
  *  @param[in]      numReplies          number of expected replies, 0 if unknown
  *  @param[in]      replyTimeout        timeout for reply
  *  @param[in]      pSendParam          Pointer to send parameters, NULL to use default send parameters
@@ -1005,8 +1151,30 @@ EXT_DECL TRDP_ERR_T tlc_getJoinStatistics (
     UINT32              *pIpAddr);
 
 
+/**********************************************************************************************************************/
+/** Return PD timing statistics.
+ *  Memory for statistics information must be provided by the user. Publishers are returned first, then
+ *  subscribers. The histograms are only filled if the session was opened with TRDP_OPTION_PD_TIMING.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in,out]  pNumPd              In: The number of entries requested
+ *                                      Out: Number of entries returned
+ *  @param[out]     pStatistics         Pointer to an array with the timing statistics information
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        there are more publishers/subscribers than requested
+ */
+EXT_DECL TRDP_ERR_T tlc_getPdTimingStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    UINT16                      *pNumPd,
+    TRDP_PD_TIMING_STATISTICS_T *pStatistics);
+
+
 /**********************************************************************************************************************/
 /** Reset statistics.
+ *  Clears the PD timing histograms, too.
  *
  *  @param[in]      appHandle           the handle returned by tlc_openSession
  *
@@ -1017,6 +1185,80 @@ EXT_DECL TRDP_ERR_T tlc_getJoinStatistics (
 EXT_DECL TRDP_ERR_T tlc_resetStatistics (
     TRDP_APP_SESSION_T appHandle);
 
+
+/**********************************************************************************************************************/
+/** Export statistics into shared memory.
+ *  The session statistics, the subscription and the publisher statistics are copied into a shared memory area
+ *  (layout see TRDP_STATS_EXPORT_T) by tlc_process every 'interval'. Other processes may attach to the area with the
+ *  same key and read it at any rate without taking the session lock or using the network.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pKey                name of the shared memory area, e.g. "/trdp_stats_1"
+ *  @param[in]      maxSubs             number of subscriptions to reserve space for
+ *  @param[in]      maxPub              number of publishers to reserve space for
+ *  @param[in]      interval            update interval in us, 0 = on every tlc_process call
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error or export already open
+ *  @retval         TRDP_MEM_ERR        shared memory not available
+ */
+EXT_DECL TRDP_ERR_T tlc_openStatisticsExport (
+    TRDP_APP_SESSION_T  appHandle,
+    const CHAR8         *pKey,
+    UINT16              maxSubs,
+    UINT16              maxPub,
+    UINT32              interval);
+
+
+/**********************************************************************************************************************/
+/** Stop the statistics export and release the shared memory area.
+ *  Called by tlc_closeSession, too.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlc_closeStatisticsExport (
+    TRDP_APP_SESSION_T appHandle);
+
+#ifdef TRDP_TRACE
+/**********************************************************************************************************************/
+/** Return the records of the hot path trace.
+ *  Every thread writes into its own ring of TRDP_TRACE_RING_SIZE records, the oldest records are overwritten.
+ *  The records are returned per thread in chronological order, at most TRDP_TRACE_RING_SIZE - 1 of a full ring
+ *  (the slot of the oldest record is the next one written). Reading does not stop the writers; records
+ *  overwritten while being copied are left out.
+ *
+ *  @param[out]     pRecords            Pointer to an array for the records
+ *  @param[in,out]  pNumRecords         In: The number of records requested
+ *                                      Out: Number of records returned
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        there are more records than requested
+ */
+EXT_DECL TRDP_ERR_T tlc_getTrace (
+    TRDP_TRACE_REC_T    *pRecords,
+    UINT32              *pNumRecords);
+
+
+/**********************************************************************************************************************/
+/** Write the records of the hot path trace into a file (TRDP_TRACE_FILE_T header and records).
+ *  The file can be converted with trdp-trace2json for chrome://tracing or Perfetto.
+ *
+ *  @param[in]      pFileName           name of the file to write
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        out of memory
+ *  @retval         TRDP_IO_ERR         file could not be written
+ */
+EXT_DECL TRDP_ERR_T tlc_dumpTrace (
+    const CHAR8 *pFileName);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
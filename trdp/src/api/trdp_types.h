@@ -15,6 +15,15 @@
  *          Copyright Bombardier Transportation Inc. or its subsidiaries and others, 2015. All rights reserved.
  *
  *
+ *      AG 2026-10-18: TRDP_FLAGS_MULTI_SRC: latest data per sender of a PD subscription
+ *      AG 2026-10-18: TRDP_PD_CONFIG_T.maxNumSources: bound of the per subscription sequence counter table
+ *      AG 2026-10-18: TRDP_TRACE_REC_T and TRDP_TRACE_FILE_T: hot path trace records (TRDP_TRACE)
+ *      AG 2026-10-18: TRDP_SESSION_GROUP_T.nextJob in ns (VOS_TIME_NS_T)
+ *      AG 2026-10-18: TRDP_STATS_EXPORT_T: layout of the shared memory statistics export
+ *      AG 2026-10-18: TRDP_OPTION_PD_TIMING and TRDP_PD_TIMING_STATISTICS_T for tlc_getPdTimingStatistics
+ *      AG 2026-10-18: TRDP_SESSION_GROUP_T for tlc_getGroupInterval/tlc_processGroup
+ *      AG 2026-10-18: TRDP_PUBLISH_PAR_T and TRDP_SUBSCRIBE_PAR_T for tlc_applyConfig
+ *      AG 2026-10-18: TRDP_FLAGS_NOCOPY, TRDP_FLAGS_AGGREGATE and TRDP_MD_REPLY_REC_T added
  *      BL 2018-09-05: Ticket #211 XML handling: Dataset Name should be stored in TRDP_DATASET_ELEMENT_T
  *      BL 2018-05-02: Ticket #188 Typo in the TRDP_VAR_SIZE definition
  *      BL 2017-11-13: Ticket #176 TRDP_LABEL_T breaks field alignment -> TRDP_NET_LABEL_T
@@ -191,6 +200,12 @@ typedef enum
 #define TRDP_FLAGS_CALLBACK     0x04u     /**< Use of callback function                                   */
 #define TRDP_FLAGS_TCP          0x08u     /**< Use TCP for message data                                   */
 #define TRDP_FLAGS_FORCE_CB     0x10u     /**< Force a callback for every received packet                 */
+#define TRDP_FLAGS_NOCOPY       0x20u     /**< MD: send the data buffer in place (no copy, no marshalling),
+                                               it must stay valid until the MD session has finished        */
+#define TRDP_FLAGS_AGGREGATE    0x40u     /**< MD request: collect replies and deliver them in one callback
+                                               (see TRDP_MD_REPLY_REC_T)                                    */
+#define TRDP_FLAGS_MULTI_SRC    0x80u     /**< PD subscription of any source or a source range: keep the latest
+                                               data and time out of each sender (see tlp_getSourceByIndex)  */
 
 #define TRDP_INFINITE_TIMEOUT   0xffffffffu /**< Infinite reply timeout                                      */
 
@@ -276,6 +291,31 @@ typedef struct
     TRDP_ERR_T          resultCode;         /**< error code                                 */
 } TRDP_MD_INFO_T;
 
+/**    One reply of an aggregated reply set (request sent with TRDP_FLAGS_AGGREGATE).
+ *
+ * The callback receives all replies of a session at once (on completion or reply timeout) as a sequence of records,
+ * each followed by dataSize bytes of reply data. Use TRDP_MD_REPLY_REC_SIZE to step to the next record.
+ * Reply queries (Mq) are not aggregated, they are delivered one by one because they must be confirmed.
+ */
+typedef struct
+{
+    TRDP_IP_ADDR_T      srcIpAddr;          /**< source IP address of the replier           */
+    UINT32              comId;              /**< ComID of the reply                         */
+    UINT32              seqCount;           /**< sequence counter                           */
+    TRDP_MSG_T          msgType;            /**< TRDP_MSG_MP or TRDP_MSG_ME                 */
+    UINT16              userStatus;         /**< user status                                */
+    TRDP_REPLY_STATUS_T replyStatus;        /**< reply status                               */
+    UINT32              dataSize;           /**< size of the reply data following           */
+} TRDP_MD_REPLY_REC_T;
+
+/** Size of an aggregated reply record including its data (records are 4 byte aligned)  */
+#define TRDP_MD_REPLY_REC_SIZE(pRec)    (sizeof(TRDP_MD_REPLY_REC_T) + (((pRec)->dataSize + 3u) & ~3u))
+
+/** Upper limit for the size of an aggregated reply set, further replies are dropped    */
+#ifndef TRDP_MAX_MD_AGGR_SIZE
+#define TRDP_MAX_MD_AGGR_SIZE   131072u
+#endif
+
 
 /**    Quality/type of service and time to live    */
 typedef struct
@@ -403,7 +443,7 @@ typedef struct
     UINT32  numNoPub;         /**< number of received PD pull packets without publisher */
     UINT32  numTimeout;       /**< number of PD timeouts */
     UINT32  numSend;          /**< number of sent PD  packets */
-    UINT32  numMissed;        /**< number of packets skipped */
+    UINT32  numMissed;        /**< number of packets skipped by the current subscriptions */
 } TRDP_PD_STATISTICS_T;
 
 
@@ -463,6 +503,30 @@ typedef struct
     UINT32          numMissed;      /**< number of packets skipped for this subscription */
 } TRDP_SUBS_STATISTICS_T;
 
+/** Number of slots of a timing histogram, slot 0: < 1us, slot n: < 2^n us, last slot: all larger values */
+#define TRDP_TIMING_HIST_SIZE   24u
+
+/** Log-scale histogram of a PD timing value (see TRDP_OPTION_PD_TIMING) */
+typedef struct
+{
+    UINT32  count;                          /**< Number of samples */
+    UINT32  max;                            /**< Largest sample in us */
+    UINT32  hist[TRDP_TIMING_HIST_SIZE];    /**< Number of samples per slot */
+} TRDP_TIMING_HIST_T;
+
+/** Timing of a particular PD publisher or subscriber, recorded with TRDP_OPTION_PD_TIMING */
+typedef struct
+{
+    UINT32              comId;          /**< Published or subscribed ComId */
+    TRDP_IP_ADDR_T      srcAddr;        /**< Source (filter) IP address */
+    TRDP_IP_ADDR_T      destAddr;       /**< Destination IP address */
+    UINT32              subscriber;     /**< 0 = publisher, 1 = subscriber */
+    UINT32              interval;       /**< Publisher: cycle in us, subscriber: time-out in us */
+    TRDP_TIMING_HIST_T  sendLateness;   /**< Publisher: delay of the sending behind the scheduled time */
+    TRDP_TIMING_HIST_T  interArrival;   /**< Subscriber: time between two received packets */
+    TRDP_TIMING_HIST_T  cbExecTime;     /**< Runtime of the callback function */
+} TRDP_PD_TIMING_STATISTICS_T;
+
 /** Table containing particular PD publishing information. */
 typedef struct
 {
@@ -496,6 +560,77 @@ typedef struct
 } TRDP_RED_STATISTICS_T;
 
 
+/** Identification and layout version of the shared memory statistics export (tlc_openStatisticsExport) */
+#define TRDP_STATS_EXPORT_MAGIC     0x54525354u     /**< 'TRST' */
+#define TRDP_STATS_EXPORT_VERSION   1u
+
+/** Header of the shared memory statistics export.
+ *  The header is followed by the subscription and the publisher tables at subsOffset and pubOffset.
+ *  The area is written under a sequence count: it is odd while an update is in progress. A reader copies what it
+ *  needs between two reads of an even, unchanged sequence count and retries otherwise.
+ */
+typedef struct
+{
+    UINT32                  magic;          /**< TRDP_STATS_EXPORT_MAGIC, 0 while not yet initialised */
+    UINT32                  version;        /**< TRDP_STATS_EXPORT_VERSION */
+    UINT32                  size;           /**< total size of the area in bytes */
+    UINT32                  sequence;       /**< update sequence count, odd while writing */
+    UINT32                  interval;       /**< update interval in us */
+    UINT32                  maxSubs;        /**< number of entries in the subscription table */
+    UINT32                  maxPub;         /**< number of entries in the publisher table */
+    UINT32                  numSubs;        /**< number of valid subscription entries */
+    UINT32                  numPub;         /**< number of valid publisher entries */
+    UINT32                  subsOffset;     /**< offset of TRDP_SUBS_STATISTICS_T[maxSubs] from the start */
+    UINT32                  pubOffset;      /**< offset of TRDP_PUB_STATISTICS_T[maxPub] from the start */
+    UINT32                  truncated;      /**< 1 if there were more subscriptions/publishers than entries */
+    TRDP_STATISTICS_T       statistics;     /**< session statistics */
+} TRDP_STATS_EXPORT_T;
+
+
+/** Events of the hot path trace (compiled in with TRDP_TRACE) */
+typedef enum
+{
+    TRDP_TRACE_PROCESS      = 1,    /**< tlc_process pass, duration                                  */
+    TRDP_TRACE_PD_SEND      = 2,    /**< PD sent, duration of the socket call, info: msgType         */
+    TRDP_TRACE_PD_RECEIVE   = 3,    /**< PD received and checked, duration from socket read, info: msgType */
+    TRDP_TRACE_PD_CALLBACK  = 4,    /**< PD callback, duration, info: resultCode                     */
+    TRDP_TRACE_PD_TIMEOUT   = 5,    /**< PD subscription timed out                                   */
+    TRDP_TRACE_MD_SEND      = 6,    /**< MD sent, duration of the socket call, info: msgType         */
+    TRDP_TRACE_MD_RECEIVE   = 7,    /**< MD received, info: msgType                                  */
+    TRDP_TRACE_MD_CALLBACK  = 8,    /**< MD callback, duration, info: resultCode                     */
+    TRDP_TRACE_MD_TIMEOUT   = 9,    /**< MD session timed out, info: resultCode                      */
+    TRDP_TRACE_MD_STATE     = 10    /**< MD session state changed, info: new TRDP_MD_ELE_ST_T        */
+} TRDP_TRACE_EVENT_T;
+
+/** One trace record, 32 bytes */
+typedef struct
+{
+    UINT64  time;                   /**< vos_getTimeNs() at the event or at the start of a span        */
+    UINT32  duration;               /**< duration of a span in ns, 0 for instant events                */
+    UINT32  comId;                  /**< ComId, 0 if not applicable                                    */
+    UINT32  seqCnt;                 /**< sequence counter of the telegram, 0 if not applicable         */
+    UINT32  session;                /**< own IP address of the session                                 */
+    UINT16  event;                  /**< TRDP_TRACE_EVENT_T                                            */
+    UINT16  info;                   /**< event specific, see TRDP_TRACE_EVENT_T                        */
+    UINT32  thread;                 /**< number of the writing thread (order of its first event)       */
+} TRDP_TRACE_REC_T;
+
+/** Identification and layout version of a trace dump file (tlc_dumpTrace) */
+#define TRDP_TRACE_FILE_MAGIC       0x54525452u     /**< 'TRTR' */
+#define TRDP_TRACE_FILE_VERSION     1u
+
+/** Header of a trace dump file, followed by numRecords TRDP_TRACE_REC_T in host byte order */
+typedef struct
+{
+    UINT32  magic;                  /**< TRDP_TRACE_FILE_MAGIC                                         */
+    UINT32  version;                /**< TRDP_TRACE_FILE_VERSION                                       */
+    UINT32  recordSize;             /**< sizeof(TRDP_TRACE_REC_T)                                      */
+    UINT32  numRecords;             /**< number of records following                                   */
+    UINT32  numLost;                /**< records not written because all thread rings were taken      */
+    UINT32  reserved;
+} TRDP_TRACE_FILE_T;
+
+
 typedef struct TRDP_SESSION *TRDP_APP_SESSION_T;
 typedef struct PD_ELE *TRDP_PUB_T;
 typedef struct PD_ELE *TRDP_SUB_T;
@@ -617,8 +752,57 @@ typedef struct
     UINT32              timeout;                /**< Default timeout in us                      */
     TRDP_TO_BEHAVIOR_T  toBehavior;             /**< Default timeout behavior                  */
     UINT16              port;                   /**< Port to be used for PD communication       */
+    UINT16              maxNumSources;          /**< Max. number of senders tracked per subscription
+                                                     (duplicate detection, TRDP_FLAGS_MULTI_SRC),
+                                                     0 = default (1024), at most 2048 (largest memory block) */
 } TRDP_PD_CONFIG_T;
 
+/** Publication for tlc_applyConfig, see tlp_publish    */
+typedef struct
+{
+    const void              *pUserRef;          /**< User supplied value returned in the callback     */
+    TRDP_PD_CALLBACK_T      pfCbFunction;       /**< Pre-send callback function, NULL if not used     */
+    UINT32                  comId;              /**< ComId of packet to send                          */
+    UINT32                  etbTopoCnt;         /**< ETB topocount to use                             */
+    UINT32                  opTrnTopoCnt;       /**< Operational topocount                            */
+    TRDP_IP_ADDR_T          srcIpAddr;          /**< Own IP address, 0 - set by the stack             */
+    TRDP_IP_ADDR_T          destIpAddr;         /**< Where to send the packet to                      */
+    UINT32                  interval;           /**< Interval in us, 0 for PD pull                    */
+    UINT32                  redId;              /**< 0 - Non-redundant, > 0 valid redundancy group    */
+    TRDP_FLAGS_T            pktFlags;           /**< Packet flags                                     */
+    const TRDP_SEND_PARAM_T *pSendParam;        /**< Send parameters, NULL - default parameters       */
+    const UINT8             *pData;             /**< Initial data, NULL if sending starts with tlp_put */
+    UINT32                  dataSize;           /**< Size of data packet                              */
+    TRDP_PUB_T              pubHandle;          /**< Out: handle for tlp_put, tlp_unpublish...        */
+    TRDP_ERR_T              result;             /**< Out: result of this publication                  */
+} TRDP_PUBLISH_PAR_T;
+
+/** Subscription for tlc_applyConfig, see tlp_subscribe */
+typedef struct
+{
+    const void              *pUserRef;          /**< User supplied value returned in the callback     */
+    TRDP_PD_CALLBACK_T      pfCbFunction;       /**< Callback function, NULL to use default function  */
+    UINT32                  comId;              /**< ComId of packet to receive                       */
+    UINT32                  etbTopoCnt;         /**< ETB topocount to use                             */
+    UINT32                  opTrnTopoCnt;       /**< Operational topocount                            */
+    TRDP_IP_ADDR_T          srcIpAddr1;         /**< Source IP address or lower address of range      */
+    TRDP_IP_ADDR_T          srcIpAddr2;         /**< Upper address of range, 0 if not used            */
+    TRDP_IP_ADDR_T          destIpAddr;         /**< IP address to join                               */
+    TRDP_FLAGS_T            pktFlags;           /**< Packet flags                                     */
+    UINT32                  timeout;            /**< Timeout in us, 0 - default timeout               */
+    TRDP_TO_BEHAVIOR_T      toBehavior;         /**< Timeout behavior                                 */
+    TRDP_SUB_T              subHandle;          /**< Out: handle for tlp_get, tlp_unsubscribe...      */
+    TRDP_ERR_T              result;             /**< Out: result of this subscription                 */
+} TRDP_SUBSCRIBE_PAR_T;
+
+/** Sessions sharing one select() (e.g. the two subnets of a ladder topology) */
+typedef struct
+{
+    UINT32                  numSessions;        /**< Number of sessions                               */
+    TRDP_APP_SESSION_T      *pSession;          /**< Sessions to process                              */
+    VOS_TIME_NS_T           nextJob;            /**< Out: earliest job of all sessions (absolute ns)  */
+} TRDP_SESSION_GROUP_T;
+
 
 /**********************************************************************************************************************/
 /**    Callback for receiving indications, timeouts, releases, responses.
@@ -686,6 +870,8 @@ typedef struct
                                                   Default: Allow                                            */
 #define TRDP_OPTION_NO_UDP_CHK          0x10u   /**< Suppress UDP CRC generation
                                                   Default: Compute UDP CRC                                  */
+#define TRDP_OPTION_PD_TIMING           0x20u   /**< Record PD timing histograms (tlc_getPdTimingStatistics)
+                                                  Default: OFF                                              */
 typedef UINT8 TRDP_OPTION_T;
 
 /**********************************************************************************************************************/
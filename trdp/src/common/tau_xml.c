@@ -16,6 +16,8 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Compiled configuration image, mapped and used without parsing
+ *      AG 2026-10-18: tau_prepareXmlMem: parse a configuration held in memory
  *      SB 2018-10-29: Ticket #214 Incorrect parsing of <source> and <destination> elements
  *      BL 2018-10-01: Some default attribute values for com-parameter tag were missing
  *      BL 2018-09-05: Ticket #211 XML handling: Dataset Name should be stored in TRDP_DATASET_ELEMENT_T
@@ -37,10 +39,18 @@
 /*******************************************************************************
  * INCLUDES
  */
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#ifdef POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "trdp_types.h"
 #include "trdp_utils.h"
 #include "tau_xml.h"
@@ -68,10 +78,73 @@
 #define TRDP_SDT_DEFAULT_CMTHR  10u                                 /**< Default SDT chan. monitoring threshold */
 #endif
 
+/*  Compiled configuration image    */
+#define TAU_IMAGE_MAGIC     0x43445254u                             /**< 'TRDC'                                 */
+#define TAU_IMAGE_VERSION   1u                                      /**< Incremented on any layout change       */
+#define TAU_IMAGE_ORDER     0x01020304u                             /**< Byte order mark                        */
+#define TAU_IMAGE_ALIGN     8u                                      /**< Alignment of all image objects         */
+#define TAU_IMAGE_BASE      ((sizeof(void *) > 4u) ? 0x7E5000000000ull : 0x5E000000ull) /**< Preferred address */
+#define TAU_IMAGE_LAYOUT    ((UINT32) (sizeof(void *) + 16u * (sizeof(TAU_XML_IMAGE_T) + sizeof(TAU_IMAGE_IF_T) + \
+                                                              sizeof(TRDP_EXCHG_PAR_T) + sizeof(TRDP_DATASET_ELEMENT_T))))
+
+#define IMG_PTR(pBld, offset, type)     ((type *) ((pBld)->pBuf + (offset)))  /* valid until the next imgAlloc */
+
 /*******************************************************************************
  * TYPEDEFS
  */
 
+/*  Telegram configuration of one interface in a configuration image */
+typedef struct
+{
+    TRDP_LABEL_T            ifName;
+    TRDP_ERR_T              result;
+    TRDP_PROCESS_CONFIG_T   processConfig;
+    TRDP_PD_CONFIG_T        pdConfig;
+    TRDP_MD_CONFIG_T        mdConfig;
+    UINT32                  numExchgPar;
+    TRDP_EXCHG_PAR_T        *pExchgPar;
+} TAU_IMAGE_IF_T;
+
+/*  Configuration image header, followed by the configuration data and the relocation table.
+    All pointers are linked for the address 'base', the relocation table holds the offsets of all non-NULL pointers */
+typedef struct TAU_XML_IMAGE
+{
+    UINT32                  magic;
+    UINT32                  version;
+    UINT32                  byteOrder;
+    UINT32                  layout;
+    UINT32                  imageSize;
+    UINT32                  crc;            /* over all bytes following this member */
+    UINT64                  base;
+    UINT32                  relocOffset;
+    UINT32                  numReloc;
+    TRDP_ERR_T              devResult;
+    TRDP_MEM_CONFIG_T       memConfig;
+    TRDP_DBG_CONFIG_T       dbgConfig;
+    UINT32                  numComPar;
+    TRDP_COM_PAR_T          *pComPar;
+    UINT32                  numIfConfig;
+    TRDP_IF_CONFIG_T        *pIfConfig;
+    TAU_IMAGE_IF_T          *pIf;
+    TRDP_ERR_T              dsResult;
+    UINT32                  numComId;
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap;
+    UINT32                  numDataset;
+    TRDP_DATASET_T          * *apDataset;
+} TAU_XML_IMAGE_T;
+
+/*  Configuration image under construction  */
+typedef struct
+{
+    UINT8       *pBuf;
+    UINT32      size;
+    UINT32      capacity;
+    UINT32      *pReloc;
+    UINT32      numReloc;
+    UINT32      maxReloc;
+    TRDP_ERR_T  err;
+} TAU_IMAGE_BUILD_T;
+
 
 /******************************************************************************
  *   Locals
@@ -887,6 +960,310 @@ static TRDP_ERR_T readXmlDatasets (
     return TRDP_NO_ERR;
 }
 
+/*
+ * Reserve zeroed, aligned space in the image, returns its offset
+ */
+static UINT32 imgAlloc (
+    TAU_IMAGE_BUILD_T   *pBld,
+    UINT32              size)
+{
+    UINT32 offset = (pBld->size + TAU_IMAGE_ALIGN - 1u) & ~(TAU_IMAGE_ALIGN - 1u);
+
+    if (pBld->err != TRDP_NO_ERR)
+    {
+        return 0u;
+    }
+    if ((offset + size) > pBld->capacity)
+    {
+        UINT32  capacity = (pBld->capacity == 0u) ? 0x10000u : pBld->capacity;
+        UINT8   *pNew;
+
+        while ((offset + size) > capacity)
+        {
+            capacity *= 2u;
+        }
+        pNew = (UINT8 *) realloc(pBld->pBuf, capacity);
+        if (pNew == NULL)
+        {
+            pBld->err = TRDP_MEM_ERR;
+            return 0u;
+        }
+        memset(pNew + pBld->capacity, 0, capacity - pBld->capacity);
+        pBld->pBuf      = pNew;
+        pBld->capacity  = capacity;
+    }
+    pBld->size = offset + size;
+    return offset;
+}
+
+/*
+ * Copy an object into the image, returns its offset
+ */
+static UINT32 imgCopy (
+    TAU_IMAGE_BUILD_T   *pBld,
+    const void          *pSrc,
+    UINT32              size)
+{
+    UINT32 offset = imgAlloc(pBld, size);
+
+    if (pBld->err == TRDP_NO_ERR)
+    {
+        memcpy(pBld->pBuf + offset, pSrc, size);
+    }
+    return offset;
+}
+
+/*
+ * Let the pointer at fieldOffset point to the object at targetOffset and remember it for relocation
+ */
+static void imgLink (
+    TAU_IMAGE_BUILD_T   *pBld,
+    UINT32              fieldOffset,
+    UINT32              targetOffset)
+{
+    void *ptr = (void *) (size_t) (TAU_IMAGE_BASE + targetOffset);
+
+    if (pBld->err != TRDP_NO_ERR)
+    {
+        return;
+    }
+    if (pBld->numReloc == pBld->maxReloc)
+    {
+        UINT32  maxReloc    = (pBld->maxReloc == 0u) ? 1024u : 2u * pBld->maxReloc;
+        UINT32  *pNew       = (UINT32 *) realloc(pBld->pReloc, maxReloc * sizeof(UINT32));
+
+        if (pNew == NULL)
+        {
+            pBld->err = TRDP_MEM_ERR;
+            return;
+        }
+        pBld->pReloc    = pNew;
+        pBld->maxReloc  = maxReloc;
+    }
+    memcpy(pBld->pBuf + fieldOffset, &ptr, sizeof(void *));
+    pBld->pReloc[pBld->numReloc++] = fieldOffset;
+}
+
+/*
+ * Copy a string into a buffer of at least minSize bytes and link it
+ */
+static void imgLinkString (
+    TAU_IMAGE_BUILD_T   *pBld,
+    UINT32              fieldOffset,
+    const CHAR8         *pStr,
+    UINT32              minSize)
+{
+    UINT32  len = (UINT32) strlen(pStr) + 1u;
+    UINT32  offset;
+
+    offset = imgAlloc(pBld, (len > minSize) ? len : minSize);
+    if (pBld->err == TRDP_NO_ERR)
+    {
+        memcpy(pBld->pBuf + offset, pStr, len);
+        imgLink(pBld, fieldOffset, offset);
+    }
+}
+
+/*
+ * Copy the telegram configurations of an interface into the image, returns the offset of the array
+ */
+static UINT32 imgTelegrams (
+    TAU_IMAGE_BUILD_T       *pBld,
+    UINT32                  numExchgPar,
+    const TRDP_EXCHG_PAR_T  *pExchgPar)
+{
+    UINT32  arrayOffset = imgCopy(pBld, pExchgPar, numExchgPar * (UINT32) sizeof(TRDP_EXCHG_PAR_T));
+    UINT32  i;
+    UINT32  j;
+
+    for (i = 0u; (i < numExchgPar) && (pBld->err == TRDP_NO_ERR); i++)
+    {
+        const TRDP_EXCHG_PAR_T  *pPar   = &pExchgPar[i];
+        UINT32                  offset  = arrayOffset + i * (UINT32) sizeof(TRDP_EXCHG_PAR_T);
+        TRDP_EXCHG_PAR_T        *pImg   = IMG_PTR(pBld, offset, TRDP_EXCHG_PAR_T);
+
+        pImg->pMdPar    = NULL;
+        pImg->pPdPar    = NULL;
+        pImg->pDest     = NULL;
+        pImg->pSrc      = NULL;
+
+        if (pPar->pMdPar != NULL)
+        {
+            imgLink(pBld, offset + offsetof(TRDP_EXCHG_PAR_T, pMdPar),
+                    imgCopy(pBld, pPar->pMdPar, sizeof(TRDP_MD_PAR_T)));
+        }
+        if (pPar->pPdPar != NULL)
+        {
+            imgLink(pBld, offset + offsetof(TRDP_EXCHG_PAR_T, pPdPar),
+                    imgCopy(pBld, pPar->pPdPar, sizeof(TRDP_PD_PAR_T)));
+        }
+        if ((pPar->destCnt > 0u) && (pPar->pDest != NULL))
+        {
+            UINT32 destOffset = imgCopy(pBld, pPar->pDest, pPar->destCnt * (UINT32) sizeof(TRDP_DEST_T));
+
+            imgLink(pBld, offset + offsetof(TRDP_EXCHG_PAR_T, pDest), destOffset);
+            for (j = 0u; (j < pPar->destCnt) && (pBld->err == TRDP_NO_ERR); j++)
+            {
+                const TRDP_DEST_T   *pDest  = &pPar->pDest[j];
+                UINT32              dest    = destOffset + j * (UINT32) sizeof(TRDP_DEST_T);
+
+                IMG_PTR(pBld, dest, TRDP_DEST_T)->pSdtPar   = NULL;
+                IMG_PTR(pBld, dest, TRDP_DEST_T)->pUriUser  = NULL;
+                IMG_PTR(pBld, dest, TRDP_DEST_T)->pUriHost  = NULL;
+                if (pDest->pSdtPar != NULL)
+                {
+                    imgLink(pBld, dest + offsetof(TRDP_DEST_T, pSdtPar),
+                            imgCopy(pBld, pDest->pSdtPar, sizeof(TRDP_SDT_PAR_T)));
+                }
+                if (pDest->pUriUser != NULL)
+                {
+                    imgLinkString(pBld, dest + offsetof(TRDP_DEST_T, pUriUser),
+                                  *pDest->pUriUser, sizeof(TRDP_URI_USER_T));
+                }
+                if (pDest->pUriHost != NULL)
+                {
+                    imgLinkString(pBld, dest + offsetof(TRDP_DEST_T, pUriHost),
+                                  *pDest->pUriHost, sizeof(TRDP_URI_HOST_T));
+                }
+            }
+        }
+        if ((pPar->srcCnt > 0u) && (pPar->pSrc != NULL))
+        {
+            UINT32 srcOffset = imgCopy(pBld, pPar->pSrc, pPar->srcCnt * (UINT32) sizeof(TRDP_SRC_T));
+
+            imgLink(pBld, offset + offsetof(TRDP_EXCHG_PAR_T, pSrc), srcOffset);
+            for (j = 0u; (j < pPar->srcCnt) && (pBld->err == TRDP_NO_ERR); j++)
+            {
+                const TRDP_SRC_T    *pSrc   = &pPar->pSrc[j];
+                UINT32              src     = srcOffset + j * (UINT32) sizeof(TRDP_SRC_T);
+
+                IMG_PTR(pBld, src, TRDP_SRC_T)->pSdtPar     = NULL;
+                IMG_PTR(pBld, src, TRDP_SRC_T)->pUriUser    = NULL;
+                IMG_PTR(pBld, src, TRDP_SRC_T)->pUriHost1   = NULL;
+                IMG_PTR(pBld, src, TRDP_SRC_T)->pUriHost2   = NULL;
+                if (pSrc->pSdtPar != NULL)
+                {
+                    imgLink(pBld, src + offsetof(TRDP_SRC_T, pSdtPar),
+                            imgCopy(pBld, pSrc->pSdtPar, sizeof(TRDP_SDT_PAR_T)));
+                }
+                if (pSrc->pUriUser != NULL)
+                {
+                    imgLinkString(pBld, src + offsetof(TRDP_SRC_T, pUriUser),
+                                  *pSrc->pUriUser, sizeof(TRDP_URI_USER_T));
+                }
+                if (pSrc->pUriHost1 != NULL)
+                {
+                    imgLinkString(pBld, src + offsetof(TRDP_SRC_T, pUriHost1),
+                                  *pSrc->pUriHost1, sizeof(TRDP_URI_HOST_T));
+                }
+                if (pSrc->pUriHost2 != NULL)
+                {
+                    imgLinkString(pBld, src + offsetof(TRDP_SRC_T, pUriHost2),
+                                  *pSrc->pUriHost2, sizeof(TRDP_URI_HOST_T));
+                }
+            }
+        }
+    }
+    return arrayOffset;
+}
+
+/*
+ * Copy the datasets into the image, returns the offset of the array of dataset pointers
+ */
+static UINT32 imgDatasets (
+    TAU_IMAGE_BUILD_T   *pBld,
+    UINT32              numDataset,
+    TRDP_DATASET_T      * *apDataset)
+{
+    UINT32  arrayOffset = imgAlloc(pBld, numDataset * (UINT32) sizeof(TRDP_DATASET_T *));
+    UINT32  i;
+    UINT32  j;
+
+    for (i = 0u; (i < numDataset) && (pBld->err == TRDP_NO_ERR); i++)
+    {
+        const TRDP_DATASET_T    *pDataset   = apDataset[i];
+        UINT32                  offset      = imgCopy(pBld, pDataset, (UINT32) (sizeof(TRDP_DATASET_T) +
+                                                                                 pDataset->numElement *
+                                                                                 sizeof(TRDP_DATASET_ELEMENT_T)));
+
+        imgLink(pBld, arrayOffset + i * (UINT32) sizeof(TRDP_DATASET_T *), offset);
+        for (j = 0u; (j < pDataset->numElement) && (pBld->err == TRDP_NO_ERR); j++)
+        {
+            UINT32 element = offset + (UINT32) offsetof(TRDP_DATASET_T, pElement) +
+                j * (UINT32) sizeof(TRDP_DATASET_ELEMENT_T);
+
+            IMG_PTR(pBld, element, TRDP_DATASET_ELEMENT_T)->name        = NULL;
+            IMG_PTR(pBld, element, TRDP_DATASET_ELEMENT_T)->unit        = NULL;
+            IMG_PTR(pBld, element, TRDP_DATASET_ELEMENT_T)->pCachedDS   = NULL;
+            if (pDataset->pElement[j].name != NULL)
+            {
+                imgLinkString(pBld, element + offsetof(TRDP_DATASET_ELEMENT_T, name), pDataset->pElement[j].name, 0u);
+            }
+            if (pDataset->pElement[j].unit != NULL)
+            {
+                imgLinkString(pBld, element + offsetof(TRDP_DATASET_ELEMENT_T, unit), pDataset->pElement[j].unit, 0u);
+            }
+        }
+    }
+    return arrayOffset;
+}
+
+/*
+ * Check a loaded image and relocate it, if it is not at its preferred address
+ */
+static TRDP_ERR_T imgRelocate (
+    UINT8   *pImage,
+    UINT32  size)
+{
+    TAU_XML_IMAGE_T *pHdr = (TAU_XML_IMAGE_T *) pImage;
+    const UINT32    crcStart = (UINT32) (offsetof(TAU_XML_IMAGE_T, crc) + sizeof(UINT32));
+    const UINT32    *pReloc;
+    UINT32          i;
+
+    if ((size < sizeof(TAU_XML_IMAGE_T))
+        || (pHdr->magic != TAU_IMAGE_MAGIC)
+        || (pHdr->version != TAU_IMAGE_VERSION)
+        || (pHdr->byteOrder != TAU_IMAGE_ORDER)
+        || (pHdr->layout != TAU_IMAGE_LAYOUT)
+        || (pHdr->imageSize != size)
+        || (pHdr->relocOffset > size)
+        || (pHdr->numReloc > ((size - pHdr->relocOffset) / sizeof(UINT32))))
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "Configuration image: wrong format, version or platform\n");
+        return TRDP_PARAM_ERR;
+    }
+    if (vos_crc32(0xFFFFFFFFu, pImage + crcStart, size - crcStart) != pHdr->crc)
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "Configuration image: checksum error\n");
+        return TRDP_PARAM_ERR;
+    }
+    if ((size_t) pImage == (size_t) pHdr->base)
+    {
+        return TRDP_NO_ERR;
+    }
+
+    pReloc = (const UINT32 *) (pImage + pHdr->relocOffset);
+    for (i = 0u; i < pHdr->numReloc; i++)
+    {
+        UINT8   *ptr;
+        size_t  target;
+
+        if (pReloc[i] > (size - sizeof(void *)))
+        {
+            return TRDP_PARAM_ERR;
+        }
+        memcpy(&ptr, pImage + pReloc[i], sizeof(void *));
+        target = (size_t) ptr - (size_t) pHdr->base;
+        if (target >= size)
+        {
+            return TRDP_PARAM_ERR;
+        }
+        ptr = pImage + target;
+        memcpy(pImage + pReloc[i], &ptr, sizeof(void *));
+    }
+    return TRDP_NO_ERR;
+}
+
 /******************************************************************************
  *   Globals
  */
@@ -938,6 +1315,54 @@ EXT_DECL TRDP_ERR_T tau_prepareXmlDoc (
     return TRDP_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/**    Prepare an XML configuration held in memory (e.g. embedded or received) for reading.
+ *      The buffer is not copied, it must stay valid until tau_freeXmlDoc is called.
+ *
+ *
+ *  @param[in]      pBuffer           XML document
+ *  @param[in]      bufSize           Size of the document
+ *  @param[out]     pDocHnd           Handle of the parsed XML document
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error
+ *  @retval         TRDP_MEM_ERR      out of memory
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_prepareXmlMem (
+    const CHAR8             *pBuffer,
+    UINT32                  bufSize,
+    TRDP_XML_DOC_HANDLE_T   *pDocHnd
+    )
+{
+    TRDP_ERR_T err;
+
+    /* Check parameters */
+    if ((pBuffer == NULL) || (bufSize == 0u) || (pDocHnd == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /*  Set handle pointers to NULL */
+    memset(pDocHnd, 0, sizeof(TRDP_XML_DOC_HANDLE_T));
+
+    pDocHnd->pXmlDocument = (XML_HANDLE_T *) vos_memAlloc(sizeof(XML_HANDLE_T));
+    if (pDocHnd->pXmlDocument == NULL)
+    {
+        return TRDP_MEM_ERR;
+    }
+
+    err = trdp_XMLOpenBuffer(pDocHnd->pXmlDocument, pBuffer, bufSize);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "Prepare XML doc: failed to index XML buffer\n");
+        vos_memFree(pDocHnd->pXmlDocument);
+        pDocHnd->pXmlDocument = NULL;
+    }
+
+    return err;
+}
+
 /**********************************************************************************************************************/
 /**    Free all the memory allocated by tau_prepareXmlDoc
  *
@@ -949,7 +1374,7 @@ EXT_DECL void tau_freeXmlDoc (
     TRDP_XML_DOC_HANDLE_T *pDocHnd)
 {
     /*  Check parameter */
-    if (!pDocHnd)
+    if ((pDocHnd == NULL) || (pDocHnd->pXmlDocument == NULL))
     {
         return;
     }
@@ -1671,3 +2096,422 @@ EXT_DECL void tau_freeXmlDatasetConfig (
         ppDataset = NULL;
     }
 }
+
+/**********************************************************************************************************************/
+/**    Compile the results of all tau_readXml... functions into a binary configuration image.
+ *
+ *
+ *  @param[in]      pDocHnd           Handle of the XML document prepared by tau_prepareXmlDoc
+ *  @param[in]      pImageFileName    Path and filename of the image to write
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error or XML configuration not readable
+ *  @retval         TRDP_MEM_ERR      out of memory
+ *  @retval         TRDP_IO_ERR       image could not be written
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_compileXmlConfig (
+    const TRDP_XML_DOC_HANDLE_T *pDocHnd,
+    const CHAR8                 *pImageFileName)
+{
+    TAU_IMAGE_BUILD_T       bld;
+    TRDP_ERR_T              result;
+    TRDP_MEM_CONFIG_T       memConfig;
+    TRDP_DBG_CONFIG_T       dbgConfig;
+    UINT32                  numComPar       = 0u;
+    TRDP_COM_PAR_T          *pComPar        = NULL;
+    UINT32                  numIfConfig     = 0u;
+    TRDP_IF_CONFIG_T        *pIfConfig      = NULL;
+    UINT32                  numComId        = 0u;
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap  = NULL;
+    UINT32                  numDataset      = 0u;
+    apTRDP_DATASET_T        apDataset       = NULL;
+    UINT32                  ifOffset;
+    UINT32                  relocOffset;
+    UINT32                  i;
+    TAU_XML_IMAGE_T         *pHdr;
+    FILE                    *pFile;
+
+    if ((pDocHnd == NULL) || (pDocHnd->pXmlDocument == NULL) || (pImageFileName == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    result = tau_readXmlDeviceConfig(pDocHnd, &memConfig, &dbgConfig, &numComPar, &pComPar, &numIfConfig, &pIfConfig);
+    if (result != TRDP_NO_ERR)
+    {
+        return result;
+    }
+
+    memset(&bld, 0, sizeof(bld));
+    (void) imgAlloc(&bld, sizeof(TAU_XML_IMAGE_T));
+
+    /*  Device configuration    */
+    if (bld.err == TRDP_NO_ERR)
+    {
+        pHdr = IMG_PTR(&bld, 0u, TAU_XML_IMAGE_T);
+        pHdr->devResult     = result;
+        pHdr->memConfig     = memConfig;
+        pHdr->dbgConfig     = dbgConfig;
+        pHdr->numComPar     = numComPar;
+        pHdr->numIfConfig   = numIfConfig;
+    }
+    if (numComPar > 0u)
+    {
+        imgLink(&bld, offsetof(TAU_XML_IMAGE_T, pComPar),
+                imgCopy(&bld, pComPar, numComPar * (UINT32) sizeof(TRDP_COM_PAR_T)));
+    }
+    if (numIfConfig > 0u)
+    {
+        imgLink(&bld, offsetof(TAU_XML_IMAGE_T, pIfConfig),
+                imgCopy(&bld, pIfConfig, numIfConfig * (UINT32) sizeof(TRDP_IF_CONFIG_T)));
+        ifOffset = imgAlloc(&bld, numIfConfig * (UINT32) sizeof(TAU_IMAGE_IF_T));
+        imgLink(&bld, offsetof(TAU_XML_IMAGE_T, pIf), ifOffset);
+
+        /*  Telegrams of each interface */
+        for (i = 0u; (i < numIfConfig) && (bld.err == TRDP_NO_ERR); i++)
+        {
+            TAU_IMAGE_IF_T      ifConfig;
+            TRDP_EXCHG_PAR_T    *pExchgPar  = NULL;
+            UINT32              offset      = ifOffset + i * (UINT32) sizeof(TAU_IMAGE_IF_T);
+
+            memset(&ifConfig, 0, sizeof(ifConfig));
+            vos_strncpy(ifConfig.ifName, pIfConfig[i].ifName, TRDP_MAX_LABEL_LEN);
+            ifConfig.result = tau_readXmlInterfaceConfig(pDocHnd, pIfConfig[i].ifName, &ifConfig.processConfig,
+                                                         &ifConfig.pdConfig, &ifConfig.mdConfig,
+                                                         &ifConfig.numExchgPar, &pExchgPar);
+            if (ifConfig.result != TRDP_NO_ERR)
+            {
+                ifConfig.numExchgPar = 0u;
+            }
+            *IMG_PTR(&bld, offset, TAU_IMAGE_IF_T) = ifConfig;
+            if ((ifConfig.numExchgPar > 0u) && (pExchgPar != NULL))
+            {
+                imgLink(&bld, offset + offsetof(TAU_IMAGE_IF_T, pExchgPar),
+                        imgTelegrams(&bld, ifConfig.numExchgPar, pExchgPar));
+            }
+            tau_freeTelegrams(ifConfig.numExchgPar, pExchgPar);
+        }
+    }
+    if (pComPar != NULL)
+    {
+        vos_memFree(pComPar);
+    }
+    if (pIfConfig != NULL)
+    {
+        vos_memFree(pIfConfig);
+    }
+
+    /*  Datasets    */
+    result = tau_readXmlDatasetConfig(pDocHnd, &numComId, &pComIdDsIdMap, &numDataset, &apDataset);
+    if (result != TRDP_NO_ERR)
+    {
+        numComId    = 0u;
+        numDataset  = 0u;
+    }
+    if (bld.err == TRDP_NO_ERR)
+    {
+        pHdr = IMG_PTR(&bld, 0u, TAU_XML_IMAGE_T);
+        pHdr->dsResult      = result;
+        pHdr->numComId      = numComId;
+        pHdr->numDataset    = numDataset;
+    }
+    if (numComId > 0u)
+    {
+        imgLink(&bld, offsetof(TAU_XML_IMAGE_T, pComIdDsIdMap),
+                imgCopy(&bld, pComIdDsIdMap, numComId * (UINT32) sizeof(TRDP_COMID_DSID_MAP_T)));
+    }
+    if (numDataset > 0u)
+    {
+        imgLink(&bld, offsetof(TAU_XML_IMAGE_T, apDataset), imgDatasets(&bld, numDataset, apDataset));
+    }
+    tau_freeXmlDatasetConfig(numComId, pComIdDsIdMap, numDataset, apDataset);
+
+    /*  Relocation table and header */
+    relocOffset = imgCopy(&bld, bld.pReloc, bld.numReloc * (UINT32) sizeof(UINT32));
+    result      = bld.err;
+    if (result == TRDP_NO_ERR)
+    {
+        const UINT32 crcStart = (UINT32) (offsetof(TAU_XML_IMAGE_T, crc) + sizeof(UINT32));
+
+        pHdr = IMG_PTR(&bld, 0u, TAU_XML_IMAGE_T);
+        pHdr->magic         = TAU_IMAGE_MAGIC;
+        pHdr->version       = TAU_IMAGE_VERSION;
+        pHdr->byteOrder     = TAU_IMAGE_ORDER;
+        pHdr->layout        = TAU_IMAGE_LAYOUT;
+        pHdr->imageSize     = bld.size;
+        pHdr->base          = TAU_IMAGE_BASE;
+        pHdr->relocOffset   = relocOffset;
+        pHdr->numReloc      = bld.numReloc;
+        pHdr->crc           = vos_crc32(0xFFFFFFFFu, bld.pBuf + crcStart, bld.size - crcStart);
+
+        pFile = fopen(pImageFileName, "wb");
+        if ((pFile == NULL) || (fwrite(bld.pBuf, 1u, bld.size, pFile) != bld.size))
+        {
+            vos_printLogStr(VOS_LOG_ERROR, "Compile XML config: failed to write image\n");
+            result = TRDP_IO_ERR;
+        }
+        if ((pFile != NULL) && (fclose(pFile) != 0))
+        {
+            result = TRDP_IO_ERR;
+        }
+    }
+    free(bld.pBuf);
+    free(bld.pReloc);
+    return result;
+}
+
+/**********************************************************************************************************************/
+/**    Map a configuration image compiled by tau_compileXmlConfig.
+ *
+ *
+ *  @param[in]      pImageFileName    Path and filename of the image
+ *  @param[out]     pImgHnd           Handle of the mapped image
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error, wrong version, platform or checksum
+ *  @retval         TRDP_IO_ERR       image could not be read
+ *  @retval         TRDP_MEM_ERR      out of memory
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_prepareXmlImage (
+    const CHAR8             *pImageFileName,
+    TRDP_XML_IMAGE_HANDLE_T *pImgHnd)
+{
+    TRDP_ERR_T  result;
+    UINT8       *pImage = NULL;
+    UINT32      size    = 0u;
+
+    if ((pImageFileName == NULL) || (pImgHnd == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    memset(pImgHnd, 0, sizeof(TRDP_XML_IMAGE_HANDLE_T));
+
+#ifdef POSIX
+    {
+        struct stat fileStat;
+        int         fd = open(pImageFileName, O_RDONLY);
+
+        if (fd == -1)
+        {
+            return TRDP_IO_ERR;
+        }
+        if ((fstat(fd, &fileStat) == -1) || (fileStat.st_size < (off_t) sizeof(TAU_XML_IMAGE_T)))
+        {
+            (void) close(fd);
+            return TRDP_IO_ERR;
+        }
+        size = (UINT32) fileStat.st_size;
+
+        /*  Private mapping at the linked address: pages not written stay shared with other processes */
+        pImage = (UINT8 *) mmap((void *) (size_t) TAU_IMAGE_BASE, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        (void) close(fd);
+        if ((void *) pImage == MAP_FAILED)
+        {
+            return TRDP_IO_ERR;
+        }
+        pImgHnd->mapped = TRUE;
+    }
+#else
+    {
+        FILE    *pFile = fopen(pImageFileName, "rb");
+        long    fileSize;
+
+        if (pFile == NULL)
+        {
+            return TRDP_IO_ERR;
+        }
+        if ((fseek(pFile, 0, SEEK_END) != 0) || ((fileSize = ftell(pFile)) < (long) sizeof(TAU_XML_IMAGE_T))
+            || (fseek(pFile, 0, SEEK_SET) != 0))
+        {
+            fclose(pFile);
+            return TRDP_IO_ERR;
+        }
+        size    = (UINT32) fileSize;
+        pImage  = (UINT8 *) malloc(size);
+        if (pImage == NULL)
+        {
+            fclose(pFile);
+            return TRDP_MEM_ERR;
+        }
+        if (fread(pImage, 1u, size, pFile) != size)
+        {
+            free(pImage);
+            fclose(pFile);
+            return TRDP_IO_ERR;
+        }
+        fclose(pFile);
+    }
+#endif
+
+    pImgHnd->pImage     = (TAU_XML_IMAGE_T *) pImage;
+    pImgHnd->imageSize  = size;
+
+    result = imgRelocate(pImage, size);
+    if (result != TRDP_NO_ERR)
+    {
+        tau_freeXmlImage(pImgHnd);
+    }
+    return result;
+}
+
+/**********************************************************************************************************************/
+/**    Unmap a configuration image.
+ *
+ *
+ *  @param[in]      pImgHnd           Handle of the mapped image
+ *
+ */
+EXT_DECL void tau_freeXmlImage (
+    TRDP_XML_IMAGE_HANDLE_T *pImgHnd)
+{
+    if ((pImgHnd == NULL) || (pImgHnd->pImage == NULL))
+    {
+        return;
+    }
+#ifdef POSIX
+    if (pImgHnd->mapped == TRUE)
+    {
+        (void) munmap(pImgHnd->pImage, pImgHnd->imageSize);
+    }
+    else
+#endif
+    {
+        free(pImgHnd->pImage);
+    }
+    pImgHnd->pImage     = NULL;
+    pImgHnd->imageSize  = 0u;
+}
+
+/**********************************************************************************************************************/
+/**    Get the device configuration from a configuration image.
+ *
+ *
+ *  @param[in]      pImgHnd           Handle of the mapped image
+ *  @param[out]     pMemConfig        Memory configuration
+ *  @param[out]     pDbgConfig        Debug printout configuration for application use
+ *  @param[out]     pNumComPar        Number of configured com parameters
+ *  @param[out]     ppComPar          Pointer to array of com parameters
+ *  @param[out]     pNumIfConfig      Number of configured interfaces
+ *  @param[out]     ppIfConfig        Pointer to an array of interface parameter sets
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readImageDeviceConfig (
+    const TRDP_XML_IMAGE_HANDLE_T   *pImgHnd,
+    TRDP_MEM_CONFIG_T               *pMemConfig,
+    TRDP_DBG_CONFIG_T               *pDbgConfig,
+    UINT32                          *pNumComPar,
+    TRDP_COM_PAR_T                  * *ppComPar,
+    UINT32                          *pNumIfConfig,
+    TRDP_IF_CONFIG_T                * *ppIfConfig)
+{
+    const TAU_XML_IMAGE_T *pImage;
+
+    if ((pImgHnd == NULL) || (pImgHnd->pImage == NULL) || (pMemConfig == NULL) || (pDbgConfig == NULL)
+        || (pNumComPar == NULL) || (ppComPar == NULL) || (pNumIfConfig == NULL) || (ppIfConfig == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    pImage          = pImgHnd->pImage;
+    *pMemConfig     = pImage->memConfig;
+    *pDbgConfig     = pImage->dbgConfig;
+    *pNumComPar     = pImage->numComPar;
+    *ppComPar       = pImage->pComPar;
+    *pNumIfConfig   = pImage->numIfConfig;
+    *ppIfConfig     = pImage->pIfConfig;
+    return pImage->devResult;
+}
+
+/**********************************************************************************************************************/
+/**    Get the telegram configuration of an interface from a configuration image.
+ *
+ *
+ *  @param[in]      pImgHnd           Handle of the mapped image
+ *  @param[in]      pIfName           Interface name
+ *  @param[out]     pProcessConfig    TRDP process (session) configuration for the interface
+ *  @param[out]     pPdConfig         PD default configuration for the interface
+ *  @param[out]     pMdConfig         MD default configuration for the interface
+ *  @param[out]     pNumExchgPar      Number of configured telegrams
+ *  @param[out]     ppExchgPar        Pointer to array of telegram configurations
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error or interface not configured
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readImageInterfaceConfig (
+    const TRDP_XML_IMAGE_HANDLE_T   *pImgHnd,
+    const CHAR8                     *pIfName,
+    TRDP_PROCESS_CONFIG_T           *pProcessConfig,
+    TRDP_PD_CONFIG_T                *pPdConfig,
+    TRDP_MD_CONFIG_T                *pMdConfig,
+    UINT32                          *pNumExchgPar,
+    TRDP_EXCHG_PAR_T                * *ppExchgPar)
+{
+    const TAU_XML_IMAGE_T   *pImage;
+    UINT32                  i;
+
+    if ((pImgHnd == NULL) || (pImgHnd->pImage == NULL) || (pIfName == NULL) || (pPdConfig == NULL)
+        || (pMdConfig == NULL) || (pNumExchgPar == NULL) || (ppExchgPar == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    pImage = pImgHnd->pImage;
+    for (i = 0u; i < pImage->numIfConfig; i++)
+    {
+        const TAU_IMAGE_IF_T *pIf = &pImage->pIf[i];
+
+        if (vos_strnicmp(pIf->ifName, pIfName, TRDP_MAX_LABEL_LEN) == 0)
+        {
+            if (pProcessConfig != NULL)
+            {
+                *pProcessConfig = pIf->processConfig;
+            }
+            *pPdConfig      = pIf->pdConfig;
+            *pMdConfig      = pIf->mdConfig;
+            *pNumExchgPar   = pIf->numExchgPar;
+            *ppExchgPar     = pIf->pExchgPar;
+            return pIf->result;
+        }
+    }
+    return TRDP_PARAM_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    Get the dataset configuration from a configuration image.
+ *
+ *
+ *  @param[in]      pImgHnd           Handle of the mapped image
+ *  @param[out]     pNumComId         Pointer to the number of entries in the ComId DatasetId mapping list
+ *  @param[out]     ppComIdDsIdMap    Pointer to an array of a structures of type TRDP_COMID_DSID_MAP_T
+ *  @param[out]     pNumDataset       Pointer to the number of datasets found in the configuration
+ *  @param[out]     papDataset        Pointer to an array of pointers to a structures of type TRDP_DATASET_T
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readImageDatasetConfig (
+    const TRDP_XML_IMAGE_HANDLE_T   *pImgHnd,
+    UINT32                          *pNumComId,
+    TRDP_COMID_DSID_MAP_T           * *ppComIdDsIdMap,
+    UINT32                          *pNumDataset,
+    papTRDP_DATASET_T               papDataset)
+{
+    const TAU_XML_IMAGE_T *pImage;
+
+    if ((pImgHnd == NULL) || (pImgHnd->pImage == NULL) || (pNumComId == NULL) || (ppComIdDsIdMap == NULL)
+        || (pNumDataset == NULL) || (papDataset == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    pImage          = pImgHnd->pImage;
+    *pNumComId      = pImage->numComId;
+    *ppComIdDsIdMap = pImage->pComIdDsIdMap;
+    *pNumDataset    = pImage->numDataset;
+    *papDataset     = pImage->apDataset;
+    return pImage->dsResult;
+}
@@ -16,6 +16,15 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: tlp_getSources, tlp_getSourceByIndex, tlp_getSourceByAddr (TRDP_FLAGS_MULTI_SRC)
+ *      AG 2026-10-18: pdDefault.maxNumSources capped by trdp_maxNumSources
+ *      AG 2026-10-18: pdDefault.maxNumSources (senders tracked per subscription)
+ *      AG 2026-10-18: Trace of each tlc_process pass (TRDP_TRACE)
+ *      AG 2026-10-18: Shared memory statistics export updated by tlc_process, released by tlc_closeSession
+ *      AG 2026-10-18: numPub/numSubs maintained on (un)publish/(un)subscribe, join counter for the socket pool
+ *      AG 2026-10-18: PD scheduling in ns, one time stamp per tlc_process/tlc_processGroup pass
+ *      AG 2026-10-18: tlc_getGroupInterval/tlc_processGroup, common session pending/process helpers
+ *      AG 2026-10-18: tlc_applyConfig: bulk publish/subscribe with one lock and temporary comId indexes
  *      BL 2018-10-09: Ticket #213 ComId 31 subscription removed (<-- undone!)
  *      BL 2018-06-29: Default settings handling / compiler warnings
  *      SW 2018-06-26: Ticket #205 tlm_addListener() does not acknowledge TRDP_FLAGS_DEFAULT flag
@@ -78,6 +87,7 @@
 #include "trdp_utils.h"
 #include "trdp_pdcom.h"
 #include "trdp_stats.h"
+#include "trdp_trace.h"
 #include "vos_sock.h"
 #include "vos_mem.h"
 #include "vos_utils.h"
@@ -94,6 +104,21 @@ extern "C" {
  * TYPEDEFS
  */
 
+/** State of tlc_applyConfig: temporary indexes of the PD queues and the last requested socket   */
+typedef struct
+{
+    TRDP_PD_INDEX_T before;         /**< send queues of the sessions in front of this one   */
+    TRDP_PD_INDEX_T own;            /**< send queue of this session                         */
+    TRDP_PD_INDEX_T after;          /**< send queues of the following sessions              */
+    TRDP_PD_INDEX_T rcv;            /**< receive queue of this session                      */
+    INT32           sockIdx;        /**< last requested socket, -1 if none                  */
+    UINT8           sockQos;        /**< parameters of the last requested socket            */
+    UINT8           sockTtl;
+    TRDP_IP_ADDR_T  sockSrcIp;
+    TRDP_IP_ADDR_T  sockMcGroup;
+    BOOL8           sockRcvMostly;
+} TRDP_BULK_T;
+
 /***********************************************************************************************************************
  * LOCALS
  */
@@ -326,6 +351,7 @@ EXT_DECL TRDP_ERR_T tlc_openSession (
     pSession->pdDefault.port            = TRDP_PD_UDP_PORT;
     pSession->pdDefault.sendParam.qos   = TRDP_PD_DEFAULT_QOS;
     pSession->pdDefault.sendParam.ttl   = TRDP_PD_DEFAULT_TTL;
+    pSession->pdDefault.maxNumSources   = TRDP_PD_MAX_NUM_SOURCES;
 
 #if MD_SUPPORT
     pSession->mdDefault.pfCbFunction    = NULL;
@@ -360,15 +386,16 @@ EXT_DECL TRDP_ERR_T tlc_openSession (
         return ret;
     }
 
-    vos_clearTime(&pSession->nextJob);
+    pSession->nextJob   = 0u;
+    pSession->now       = vos_getTimeNs();
     vos_getTime(&pSession->initTime);
 
     /*    Clear the socket pool    */
-    trdp_initSockets(pSession->iface);
+    trdp_initSockets(pSession->iface, &pSession->stats.numJoin);
 
 #if MD_SUPPORT
-    /* Initialize pointers to Null in the incomplete message structure */
-    trdp_initUncompletedTCP(pSession);
+    /* No TCP stream data buffered yet */
+    trdp_initTCPRcvBuffers(pSession);
 #endif
 
     /*    Clear the statistics for this session */
@@ -557,6 +584,22 @@ EXT_DECL TRDP_ERR_T tlc_configSession (
         {
             pSession->pdDefault.sendParam.ttl = pPdDefault->sendParam.ttl;
         }
+
+        if ((pSession->pdDefault.maxNumSources == TRDP_PD_MAX_NUM_SOURCES) &&
+            (pPdDefault->maxNumSources != 0u))
+        {
+            UINT32 limit = trdp_maxNumSources();
+
+            if (pPdDefault->maxNumSources > limit)
+            {
+                vos_printLog(VOS_LOG_WARNING, "maxNumSources %u reduced to %u\n", pPdDefault->maxNumSources, limit);
+                pSession->pdDefault.maxNumSources = (UINT16) limit;
+            }
+            else
+            {
+                pSession->pdDefault.maxNumSources = pPdDefault->maxNumSources;
+            }
+        }
     }
 
 #if MD_SUPPORT
@@ -729,12 +772,14 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
             else
             {
 
+                trdp_statsExportClose(pSession);
+
                 /*    Release all allocated sockets and memory    */
                 vos_memFree(pSession->pNewFrame);
 
                 while (pSession->pSndQueue != NULL)
                 {
-                    PD_ELE_T *pNext = pSession->pSndQueue->pNext;
+                    PD_ELE_T *pDelete = pSession->pSndQueue;
 
                     /*  UnPublish our packets   */
                     trdp_releaseSocket(appHandle->iface, pSession->pSndQueue->socketIdx, 0, FALSE, VOS_INADDR_ANY);
@@ -748,13 +793,13 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     /*    Only close socket if not used anymore    */
                     trdp_releaseSocket(pSession->iface, pSession->pSndQueue->socketIdx, 0, FALSE, VOS_INADDR_ANY);
 
-                    vos_memFree(pSession->pSndQueue);
-                    pSession->pSndQueue = pNext;
+                    trdp_queueDelElement(&pSession->pSndQueue, pDelete);
+                    vos_memFree(pDelete);
                 }
 
                 while (pSession->pRcvQueue != NULL)
                 {
-                    PD_ELE_T *pNext = pSession->pRcvQueue->pNext;
+                    PD_ELE_T *pDelete = pSession->pRcvQueue;
 
                     /*  UnPublish our statistics packet   */
                     /*    Only close socket if not used anymore    */
@@ -763,12 +808,15 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     {
                         vos_memFree(pSession->pRcvQueue->pSeqCntList);
                     }
+                    trdp_pdFreeSources(pSession->pRcvQueue);
                     if (pSession->pRcvQueue->pFrame != NULL)
                     {
                         vos_memFree(pSession->pRcvQueue->pFrame);
                     }
-                    vos_memFree(pSession->pRcvQueue);
-                    pSession->pRcvQueue = pNext;
+                    trdp_queueDelElement(&pSession->pRcvQueue, pDelete);
+                    TRDP_STATS_DEC(pSession->stats.pd.numSubs);
+                    TRDP_STATS_SUB(pSession->stats.pd.numMissed, pDelete->numMissed);
+                    vos_memFree(pDelete);
                 }
 
 #if MD_SUPPORT
@@ -782,10 +830,13 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     pSession->pMDRcvEle = NULL;
                 }
 
+                /*    Discard any partially received TCP messages    */
+                trdp_freeTCPRcvBuffer(pSession, TRDP_INVALID_SOCKET_INDEX);
+
                 /*    Release all allocated sockets and memory    */
                 while (pSession->pMDSndQueue != NULL)
                 {
-                    MD_ELE_T *pNext = pSession->pMDSndQueue->pNext;
+                    MD_ELE_T *pDelete = pSession->pMDSndQueue;
 
                     /*    Only close socket if not used anymore    */
                     trdp_releaseSocket(pSession->iface,
@@ -793,13 +844,13 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                                        pSession->mdDefault.connectTimeout,
                                        FALSE,
                                        VOS_INADDR_ANY);
-                    trdp_mdFreeSession(pSession->pMDSndQueue);
-                    pSession->pMDSndQueue = pNext;
+                    trdp_MDqueueDelElement(&pSession->pMDSndQueue, pDelete);
+                    trdp_mdFreeSession(pDelete);
                 }
                 /*    Release all allocated sockets and memory    */
                 while (pSession->pMDRcvQueue != NULL)
                 {
-                    MD_ELE_T *pNext = pSession->pMDRcvQueue->pNext;
+                    MD_ELE_T *pDelete = pSession->pMDRcvQueue;
 
                     /*    Only close socket if not used anymore    */
                     trdp_releaseSocket(pSession->iface,
@@ -807,9 +858,10 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                                        pSession->mdDefault.connectTimeout,
                                        FALSE,
                                        VOS_INADDR_ANY);
-                    trdp_mdFreeSession(pSession->pMDRcvQueue);
-                    pSession->pMDRcvQueue = pNext;
+                    trdp_MDqueueDelElement(&pSession->pMDRcvQueue, pDelete);
+                    trdp_mdFreeSession(pDelete);
                 }
+                trdp_mdFreeDupTable(pSession);
                 /*    Release all allocated sockets and memory    */
                 while (pSession->pMDListenQueue != NULL)
                 {
@@ -1226,6 +1278,352 @@ EXT_DECL UINT32 tlc_getOpTrainTopoCount (
     return 0u;
 }
 
+/**********************************************************************************************************************/
+/** Look for an existing publication with the same addressing.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pBulk               state of tlc_applyConfig, NULL for a single call
+ *  @param[in]      pAddr               addressing of the new publication
+ *
+ *  @retval         TRUE                already published
+ */
+static BOOL8 trdp_isPublished (
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_BULK_T       *pBulk,
+    TRDP_ADDRESSES_T        *pAddr)
+{
+    PD_ELE_T    *iterPD;
+    UINT32      iter = 0u;
+
+    if (pBulk == NULL)
+    {
+        return (trdp_queueFindPubAddr(appHandle->pSndQueue, pAddr) != NULL) ? TRUE : FALSE;
+    }
+
+    /*  Same match as trdp_queueFindPubAddr */
+    while ((iterPD = trdp_pdIndexNext(&pBulk->own, pAddr->comId, &iter)) != NULL)
+    {
+        if (((iterPD->addr.srcIpAddr == 0u) || (iterPD->addr.srcIpAddr == pAddr->srcIpAddr))
+            && ((iterPD->addr.destIpAddr == 0u) || (iterPD->addr.destIpAddr == pAddr->destIpAddr))
+            && ((iterPD->addr.mcGroup == 0u) || (iterPD->addr.mcGroup == pAddr->mcGroup)))
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**********************************************************************************************************************/
+/** Look for an existing subscription with the same addressing.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pBulk               state of tlc_applyConfig, NULL for a single call
+ *  @param[in]      pAddr               addressing of the new subscription
+ *
+ *  @retval         TRUE                already subscribed
+ */
+static BOOL8 trdp_isSubscribed (
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_BULK_T       *pBulk,
+    TRDP_ADDRESSES_T        *pAddr)
+{
+    PD_ELE_T    *iterPD;
+    UINT32      iter = 0u;
+
+    if (pBulk == NULL)
+    {
+        return (trdp_queueFindSubAddr(appHandle->pRcvQueue, pAddr) != NULL) ? TRUE : FALSE;
+    }
+
+    /*  Same match as trdp_queueFindSubAddr */
+    while ((iterPD = trdp_pdIndexNext(&pBulk->rcv, pAddr->comId, &iter)) != NULL)
+    {
+        if ((iterPD->addr.srcIpAddr == VOS_INADDR_ANY)
+            || (iterPD->addr.srcIpAddr == pAddr->srcIpAddr)
+            || ((iterPD->addr.srcIpAddr2 != VOS_INADDR_ANY)
+                && (pAddr->srcIpAddr >= iterPD->addr.srcIpAddr)
+                && (pAddr->srcIpAddr <= iterPD->addr.srcIpAddr2)))
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**********************************************************************************************************************/
+/** Get the last sent sequence counter of a comId, see trdp_getSeqCnt.
+ *
+ *  @param[in]      pBulk               state of tlc_applyConfig, NULL for a single call
+ *  @param[in]      comId               comId to look for
+ *  @param[in]      msgType             PD or PP
+ *  @param[in]      srcIpAddr           source IP address
+ *
+ *  @retval         sequence counter
+ */
+static UINT32 trdp_bulkSeqCnt (
+    const TRDP_BULK_T   *pBulk,
+    UINT32              comId,
+    TRDP_MSG_T          msgType,
+    TRDP_IP_ADDR_T      srcIpAddr)
+{
+    const TRDP_PD_INDEX_T   *pIndex[3];
+    PD_ELE_T                *iterPD;
+    UINT32                  iter;
+    UINT32                  i;
+
+    if (pBulk == NULL)
+    {
+        return trdp_getSeqCnt(comId, msgType, srcIpAddr);
+    }
+    if (comId == 0u)
+    {
+        return 0u;
+    }
+
+    /*  Same order as the session queue: sessions in front, this session, following sessions  */
+    pIndex[0]   = &pBulk->before;
+    pIndex[1]   = &pBulk->own;
+    pIndex[2]   = &pBulk->after;
+    for (i = 0u; i < 3u; i++)
+    {
+        iter = 0u;
+        while ((iterPD = trdp_pdIndexNext(pIndex[i], comId, &iter)) != NULL)
+        {
+            if ((srcIpAddr == 0u) || (iterPD->addr.srcIpAddr == srcIpAddr))
+            {
+                return iterPD->curSeqCnt;
+            }
+        }
+    }
+    return 0u;
+}
+
+/**********************************************************************************************************************/
+/** Request a PD socket; tlc_applyConfig reuses the socket of the previous entry if the parameters are the same.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pBulk               state of tlc_applyConfig, NULL for a single call
+ *  @param[in]      pSendParam          send parameters
+ *  @param[in]      srcIpAddr           own IP address
+ *  @param[in]      mcGroup             multicast group to join, 0 if none
+ *  @param[in]      rcvMostly           TRUE for subscriptions
+ *  @param[out]     pIndex              socket index
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         other               see trdp_requestSocket
+ */
+static TRDP_ERR_T trdp_pdRequestSocket (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_BULK_T             *pBulk,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    TRDP_IP_ADDR_T          mcGroup,
+    BOOL8                   rcvMostly,
+    INT32                   *pIndex)
+{
+    TRDP_ERR_T ret;
+
+    if ((pBulk != NULL)
+        && (pBulk->sockIdx >= 0)
+        && (appHandle->iface[pBulk->sockIdx].sock != VOS_INVALID_SOCKET)
+        && (pBulk->sockQos == pSendParam->qos)
+        && (pBulk->sockTtl == pSendParam->ttl)
+        && (pBulk->sockSrcIp == srcIpAddr)
+        && (pBulk->sockMcGroup == mcGroup)
+        && (pBulk->sockRcvMostly == rcvMostly))
+    {
+        /*  trdp_requestSocket would find the same socket, already joined    */
+        appHandle->iface[pBulk->sockIdx].usage++;
+        *pIndex = pBulk->sockIdx;
+        return TRDP_NO_ERR;
+    }
+
+    ret = trdp_requestSocket(appHandle->iface,
+                             appHandle->pdDefault.port,
+                             pSendParam,
+                             srcIpAddr,
+                             mcGroup,
+                             TRDP_SOCK_PD,
+                             appHandle->option,
+                             rcvMostly,
+                             -1,
+                             pIndex,
+                             0u);
+
+    if (pBulk != NULL)
+    {
+        pBulk->sockIdx = (ret == TRDP_NO_ERR) ? *pIndex : -1;
+        pBulk->sockQos          = pSendParam->qos;
+        pBulk->sockTtl          = pSendParam->ttl;
+        pBulk->sockSrcIp        = srcIpAddr;
+        pBulk->sockMcGroup      = mcGroup;
+        pBulk->sockRcvMostly    = rcvMostly;
+    }
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Publish one telegram, the session must be locked.
+ *  Common part of tlp_publish and tlc_applyConfig.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in,out]  pPar                publication, returns handle
+ *  @param[in]      pBulk               state of tlc_applyConfig, NULL for a single call
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_MEM_ERR        could not insert (out of memory)
+ *  @retval         TRDP_NOPUB_ERR      already published
+ */
+static TRDP_ERR_T trdp_pdPublish (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_PUBLISH_PAR_T  *pPar,
+    TRDP_BULK_T         *pBulk)
+{
+    PD_ELE_T            *pNewElement = NULL;
+    TRDP_ADDRESSES_T    pubHandle;
+    TRDP_IP_ADDR_T      srcIpAddr   = pPar->srcIpAddr;
+    TRDP_ERR_T          ret         = TRDP_NO_ERR;
+
+    pPar->pubHandle = NULL;
+
+    /* Ticket #171: srcIP should be set if there are more than one interface */
+    if (srcIpAddr == VOS_INADDR_ANY)
+    {
+        srcIpAddr = appHandle->realIP;
+    }
+
+    /* initialize pubHandle */
+    memset(&pubHandle, 0, sizeof(pubHandle));
+    pubHandle.comId         = pPar->comId;
+    pubHandle.destIpAddr    = pPar->destIpAddr;
+    pubHandle.mcGroup       = vos_isMulticast(pPar->destIpAddr) ? pPar->destIpAddr : 0u;
+    pubHandle.srcIpAddr     = srcIpAddr;
+
+    /*    Look for existing element    */
+    if (trdp_isPublished(appHandle, pBulk, &pubHandle) == TRUE)
+    {
+        /*  Already published! */
+        return TRDP_NOPUB_ERR;
+    }
+
+    pNewElement = (PD_ELE_T *) vos_memAlloc(sizeof(PD_ELE_T));
+    if (pNewElement == NULL)
+    {
+        return TRDP_MEM_ERR;
+    }
+
+    /*
+     Compute the overal packet size
+     */
+
+    /* mark data as invalid, data will be set valid with tlp_put */
+    pNewElement->privFlags |= TRDP_INVALID_DATA;
+
+    pNewElement->dataSize   = pPar->dataSize;
+    pNewElement->grossSize  = trdp_packetSizePD(pPar->dataSize);
+
+    /*  Alloc the corresponding data buffer  */
+    pNewElement->pFrame = (PD_PACKET_T *) vos_memAlloc(pNewElement->grossSize);
+    if (pNewElement->pFrame == NULL)
+    {
+        vos_memFree(pNewElement);
+        return TRDP_MEM_ERR;
+    }
+
+    /*    Get a socket    */
+    ret = trdp_pdRequestSocket(appHandle,
+                               pBulk,
+                               (pPar->pSendParam != NULL) ? pPar->pSendParam : &appHandle->pdDefault.sendParam,
+                               srcIpAddr,
+                               0u,
+                               FALSE,
+                               &pNewElement->socketIdx);
+    if (ret != TRDP_NO_ERR)
+    {
+        vos_memFree(pNewElement->pFrame);
+        vos_memFree(pNewElement);
+        return ret;
+    }
+
+    /*    Get the current time and compute the next time this packet should be sent.    */
+    /* PD PULL?    Packet will be sent on request only    */
+    if (0u == pPar->interval)
+    {
+        pNewElement->interval   = 0u;
+        pNewElement->timeToGo   = 0u;
+    }
+    else
+    {
+        pNewElement->interval   = VOS_NS_FROM_USEC(pPar->interval);
+        pNewElement->timeToGo   = vos_getTimeNs() + pNewElement->interval;
+    }
+
+    /*    Update the internal data */
+    pNewElement->addr       = pubHandle;
+    pNewElement->pktFlags   = (pPar->pktFlags == TRDP_FLAGS_DEFAULT) ? appHandle->pdDefault.flags : pPar->pktFlags;
+    /* pNewElement->privFlags      = TRDP_PRIV_NONE; */
+    pNewElement->pullIpAddress  = 0u;
+    pNewElement->redId          = pPar->redId;
+    pNewElement->pCachedDS      = NULL;
+    pNewElement->magic          = TRDP_MAGIC_PUB_HNDL_VALUE;
+    pNewElement->pUserRef       = pPar->pUserRef;
+
+    /* if default flags supplied and no callback func supplied, take default one */
+    if ((pPar->pktFlags == TRDP_FLAGS_DEFAULT) &&
+        (pPar->pfCbFunction == NULL))
+    {
+        pNewElement->pfCbFunction = appHandle->pdDefault.pfCbFunction;
+    }
+    else
+    {
+        pNewElement->pfCbFunction = pPar->pfCbFunction;
+    }
+
+    /*  Find a possible redundant entry in one of the other sessions and sync the sequence counter!
+     curSeqCnt holds the last sent sequence counter, therefore set the value initially to -1,
+     it will be incremented when sending...    */
+
+    pNewElement->curSeqCnt = trdp_bulkSeqCnt(pBulk, pNewElement->addr.comId, TRDP_MSG_PD,
+                                             pNewElement->addr.srcIpAddr) - 1;
+
+    /*  Get a second sequence counter in case this packet is requested as PULL. This way we will not
+     disturb the monotonic sequence for PDs  */
+    pNewElement->curSeqCnt4Pull = trdp_bulkSeqCnt(pBulk, pNewElement->addr.comId, TRDP_MSG_PP,
+                                                  pNewElement->addr.srcIpAddr) - 1;
+
+    /*    Check if the redundancy group is already set as follower; if set, we need to mark this one also!
+     This will only happen, if publish() is called while we are in redundant mode */
+    if (0u != pPar->redId)
+    {
+        BOOL8 isLeader = TRUE;
+
+        ret = tlp_getRedundant(appHandle, pPar->redId, &isLeader);
+        if (ret == TRDP_NO_ERR && FALSE == isLeader)
+        {
+            pNewElement->privFlags |= TRDP_REDUNDANT;
+        }
+    }
+
+    /*    Compute the header fields */
+    trdp_pdInit(pNewElement, TRDP_MSG_PD, pPar->etbTopoCnt, pPar->opTrnTopoCnt, 0u, 0u);
+
+    /*    Insert at front    */
+    trdp_queueInsFirst(&appHandle->pSndQueue, pNewElement);
+    TRDP_STATS_INC(appHandle->stats.pd.numPub);
+    if (pBulk != NULL)
+    {
+        trdp_pdIndexAdd(&pBulk->own, pNewElement, TRUE);
+    }
+
+    pPar->pubHandle = (TRDP_PUB_T) pNewElement;
+
+    if (pPar->dataSize != 0u)
+    {
+        ret = tlp_put(appHandle, pPar->pubHandle, pPar->pData, pPar->dataSize);
+    }
+    return ret;
+}
+
 /**********************************************************************************************************************/
 /** Prepare for sending PD messages.
  *  Queue a PD message, it will be send when tlc_publish has been called
@@ -1269,10 +1667,8 @@ EXT_DECL TRDP_ERR_T tlp_publish (
     const UINT8             *pData,
     UINT32                  dataSize)
 {
-    PD_ELE_T    *pNewElement = NULL;
-    TRDP_TIME_T nextTime;
-    TRDP_TIME_T tv_interval;
-    TRDP_ERR_T  ret = TRDP_NO_ERR;
+    TRDP_PUBLISH_PAR_T  par;
+    TRDP_ERR_T          ret = TRDP_NO_ERR;
 
     /*    Check params    */
     if ((interval != 0u && interval < TRDP_TIMER_GRANULARITY)
@@ -1290,155 +1686,26 @@ EXT_DECL TRDP_ERR_T tlp_publish (
     ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutex);
     if (ret == TRDP_NO_ERR)
     {
-        TRDP_ADDRESSES_T pubHandle;
-
-        /* Ticket #171: srcIP should be set if there are more than one interface */
-        if (srcIpAddr == VOS_INADDR_ANY)
-        {
-            srcIpAddr = appHandle->realIP;
-        }
-
-        /* initialize pubHandle */
-        pubHandle.comId         = comId;
-        pubHandle.destIpAddr    = destIpAddr;
-        pubHandle.mcGroup       = vos_isMulticast(destIpAddr) ? destIpAddr : 0u;
-        pubHandle.srcIpAddr     = srcIpAddr;
-
-        /*    Look for existing element    */
-        if (trdp_queueFindPubAddr(appHandle->pSndQueue, &pubHandle) != NULL)
-        {
-            /*  Already published! */
-            ret = TRDP_NOPUB_ERR;
-        }
-        else
-        {
-            pNewElement = (PD_ELE_T *) vos_memAlloc(sizeof(PD_ELE_T));
-            if (pNewElement == NULL)
-            {
-                ret = TRDP_MEM_ERR;
-            }
-            else
-            {
-                /*
-                 Compute the overal packet size
-                 */
-
-                /* mark data as invalid, data will be set valid with tlp_put */
-                pNewElement->privFlags |= TRDP_INVALID_DATA;
-
-                pNewElement->dataSize   = dataSize;
-                pNewElement->grossSize  = trdp_packetSizePD(dataSize);
-
-                /*    Get a socket    */
-                ret = trdp_requestSocket(
-                        appHandle->iface,
-                        appHandle->pdDefault.port,
-                        (pSendParam != NULL) ? pSendParam : &appHandle->pdDefault.sendParam,
-                        srcIpAddr,
-                        0u,
-                        TRDP_SOCK_PD,
-                        appHandle->option,
-                        FALSE,
-                        -1,
-                        &pNewElement->socketIdx,
-                        0u);
-
-                if (ret != TRDP_NO_ERR)
-                {
-                    vos_memFree(pNewElement);
-                    pNewElement = NULL;
-                }
-                else
-                {
-                    /*  Alloc the corresponding data buffer  */
-                    pNewElement->pFrame = (PD_PACKET_T *) vos_memAlloc(pNewElement->grossSize);
-                    if (pNewElement->pFrame == NULL)
-                    {
-                        vos_memFree(pNewElement);
-                        pNewElement = NULL;
-                    }
-                }
-            }
-        }
-
-        /*    Get the current time and compute the next time this packet should be sent.    */
-        if ((ret == TRDP_NO_ERR)
-            && (pNewElement != NULL))
+        par.pUserRef        = pUserRef;
+        par.pfCbFunction    = pfCbFunction;
+        par.comId           = comId;
+        par.etbTopoCnt      = etbTopoCnt;
+        par.opTrnTopoCnt    = opTrnTopoCnt;
+        par.srcIpAddr       = srcIpAddr;
+        par.destIpAddr      = destIpAddr;
+        par.interval        = interval;
+        par.redId           = redId;
+        par.pktFlags        = pktFlags;
+        par.pSendParam      = pSendParam;
+        par.pData           = pData;
+        par.dataSize        = dataSize;
+
+        ret = trdp_pdPublish(appHandle, &par, NULL);
+
+        if (par.pubHandle != NULL)
         {
-            /* PD PULL?    Packet will be sent on request only    */
-            if (0 == interval)
-            {
-                vos_clearTime(&pNewElement->interval);
-                vos_clearTime(&pNewElement->timeToGo);
-            }
-            else
-            {
-                vos_getTime(&nextTime);
-                tv_interval.tv_sec  = interval / 1000000u;
-                tv_interval.tv_usec = interval % 1000000;
-                vos_addTime(&nextTime, &tv_interval);
-                pNewElement->interval   = tv_interval;
-                pNewElement->timeToGo   = nextTime;
-            }
-
-            /*    Update the internal data */
-            pNewElement->addr       = pubHandle;
-            pNewElement->pktFlags   = (pktFlags == TRDP_FLAGS_DEFAULT) ? appHandle->pdDefault.flags : pktFlags;
-            /* pNewElement->privFlags      = TRDP_PRIV_NONE; */
-            pNewElement->pullIpAddress  = 0u;
-            pNewElement->redId          = redId;
-            pNewElement->pCachedDS      = NULL;
-            pNewElement->magic          = TRDP_MAGIC_PUB_HNDL_VALUE;
-            pNewElement->pUserRef       = pUserRef;
-
-            /* if default flags supplied and no callback func supplied, take default one */
-            if ((pktFlags == TRDP_FLAGS_DEFAULT) &&
-                (pfCbFunction == NULL))
-            {
-                pNewElement->pfCbFunction = appHandle->pdDefault.pfCbFunction;
-            }
-            else
-            {
-                pNewElement->pfCbFunction = pfCbFunction;
-            }
-
-            /*  Find a possible redundant entry in one of the other sessions and sync the sequence counter!
-             curSeqCnt holds the last sent sequence counter, therefore set the value initially to -1,
-             it will be incremented when sending...    */
-
-            pNewElement->curSeqCnt = trdp_getSeqCnt(pNewElement->addr.comId, TRDP_MSG_PD,
-                                                    pNewElement->addr.srcIpAddr) - 1;
+            *pPubHandle = par.pubHandle;
 
-            /*  Get a second sequence counter in case this packet is requested as PULL. This way we will not
-             disturb the monotonic sequence for PDs  */
-            pNewElement->curSeqCnt4Pull = trdp_getSeqCnt(pNewElement->addr.comId, TRDP_MSG_PP,
-                                                         pNewElement->addr.srcIpAddr) - 1;
-
-            /*    Check if the redundancy group is already set as follower; if set, we need to mark this one also!
-             This will only happen, if publish() is called while we are in redundant mode */
-            if (0 != redId)
-            {
-                BOOL8 isLeader = TRUE;
-
-                ret = tlp_getRedundant(appHandle, redId, &isLeader);
-                if (ret == TRDP_NO_ERR && FALSE == isLeader)
-                {
-                    pNewElement->privFlags |= TRDP_REDUNDANT;
-                }
-            }
-
-            /*    Compute the header fields */
-            trdp_pdInit(pNewElement, TRDP_MSG_PD, etbTopoCnt, opTrnTopoCnt, 0u, 0u);
-
-            /*    Insert at front    */
-            trdp_queueInsFirst(&appHandle->pSndQueue, pNewElement);
-
-            *pPubHandle = (TRDP_PUB_T) pNewElement;
-
-            if (dataSize != 0u)
-            {
-                ret = tlp_put(appHandle, *pPubHandle, pData, dataSize);
-            }
             if ((ret == TRDP_NO_ERR) && (appHandle->option & TRDP_OPTION_TRAFFIC_SHAPING))
             {
                 ret = trdp_pdDistribute(appHandle->pSndQueue);
@@ -1563,6 +1830,7 @@ TRDP_ERR_T  tlp_unpublish (
     {
         /*    Remove from queue?    */
         trdp_queueDelElement(&appHandle->pSndQueue, pElement);
+        TRDP_STATS_DEC(appHandle->stats.pd.numPub);
         trdp_releaseSocket(appHandle->iface, pElement->socketIdx, 0u, FALSE, VOS_INADDR_ANY);
         pElement->magic = 0u;
         if (pElement->pSeqCntList != NULL)
@@ -1647,35 +1915,182 @@ TRDP_ERR_T tlp_put (
 }
 
 /**********************************************************************************************************************/
-/** Get the lowest time interval for PDs.
- *  Return the maximum time interval suitable for 'select()' so that we
- *    can send due PD packets in time.
- *    If the PD send queue is empty, return zero time
+/** Time until the next job, suitable for select()
  *
- *  @param[in]      appHandle          The handle returned by tlc_openSession
+ *  @param[in]      nextJob            absolute time of the next job (ns), zero if none
+ *  @param[in]      now                current time (ns)
  *  @param[out]     pInterval          pointer to needed interval
- *  @param[in,out]  pFileDesc          pointer to file descriptor set
- *  @param[out]     pNoDesc            pointer to put no of highest used descriptors (for select())
+ */
+static void trdp_jobInterval (
+    VOS_TIME_NS_T   nextJob,
+    VOS_TIME_NS_T   now,
+    TRDP_TIME_T     *pInterval)
+{
+    /*    if next job time is known, return the time-out value to the caller   */
+    if ((nextJob != 0u) &&
+        (now < nextJob))
+    {
+        VOS_NS_TO_TIMEVAL(pInterval, nextJob - now);
+    }
+    else if (nextJob != 0u)
+    {
+        pInterval->tv_sec   = 0u;                               /* 0ms if time is over (were we delayed?) */
+        pInterval->tv_usec  = 0;                                /* Application should limit this    */
+    }
+    else    /* if no timeout set, set maximum time to 1000sec   */
+    {
+        pInterval->tv_sec   = 1000u;                            /* 1000s if no timeout is set      */
+        pInterval->tv_usec  = 0;                                /* Application should limit this    */
+    }
+}
+
+/**********************************************************************************************************************/
+/** Collect the descriptors and the next job of a session, the session must be locked
  *
- *  @retval         TRDP_NO_ERR        no error
- *  @retval         TRDP_NOINIT_ERR    handle invalid
+ *  @param[in]      appHandle          The handle returned by tlc_openSession
+ *  @param[in]      now                current time (ns)
+ *  @param[in,out]  pFileDesc          pointer to file descriptor set
+ *  @param[in,out]  pNoDesc            pointer to highest used descriptor
  */
-EXT_DECL TRDP_ERR_T tlc_getInterval (
+static void trdp_sessionPending (
     TRDP_APP_SESSION_T  appHandle,
-    TRDP_TIME_T         *pInterval,
+    VOS_TIME_NS_T       now,
     TRDP_FDS_T          *pFileDesc,
     INT32               *pNoDesc)
 {
-    TRDP_TIME_T now;
-    TRDP_ERR_T  ret = TRDP_NOINIT_ERR;
+    appHandle->now      = now;
+    appHandle->nextJob  = 0u;
 
-    if (trdp_isValidSession(appHandle))
+    trdp_pdCheckPending(appHandle, pFileDesc, pNoDesc);
+
+#if MD_SUPPORT
+    trdp_mdCheckPending(appHandle, pFileDesc, pNoDesc);
+#endif
+
+    /*  Wake up for a periodic statistics export, too  */
+    if ((appHandle->pStatsExport != NULL) && (appHandle->statsExportInterval != 0u) &&
+        ((appHandle->nextJob == 0u) || (appHandle->statsExportNext < appHandle->nextJob)))
     {
-        if ((pInterval == NULL)
-            || (pFileDesc == NULL)
-            || (pNoDesc == NULL))
-        {
-            ret = TRDP_PARAM_ERR;
+        appHandle->nextJob = appHandle->statsExportNext;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Send, receive and supervise the telegrams of a session, the session must be locked
+ *  The time is taken once by the caller and used for all PD scheduling decisions of this pass.
+ *
+ *  @param[in]      appHandle          The handle returned by tlc_openSession
+ *  @param[in]      now                current time (ns)
+ *  @param[in]      pRfds              pointer to set of ready descriptors
+ *  @param[in,out]  pCount             pointer to number of ready descriptors
+ *
+ *  @retval         TRDP_NO_ERR        no error
+ *  @retval         other              last error
+ */
+static TRDP_ERR_T trdp_sessionProcess (
+    TRDP_APP_SESSION_T  appHandle,
+    VOS_TIME_NS_T       now,
+    TRDP_FDS_T          *pRfds,
+    INT32               *pCount)
+{
+    TRDP_ERR_T  result = TRDP_NO_ERR;
+    TRDP_ERR_T  err;
+
+    appHandle->now      = now;
+    appHandle->nextJob  = 0u;
+
+    /******************************************************
+     Find and send the packets which have to be sent next:
+     ******************************************************/
+
+    err = trdp_pdSendQueued(appHandle);
+
+    if (err != TRDP_NO_ERR)
+    {
+        /*  We do not break here, only report error */
+        result = err;
+        /* vos_printLog(VOS_LOG_ERROR, "trdp_pdSendQueued failed (Err: %d)\n", err);*/
+    }
+
+    /******************************************************
+     Find packets which are pending/overdue
+     ******************************************************/
+    trdp_pdHandleTimeOuts(appHandle);
+
+#if MD_SUPPORT
+
+    err = trdp_mdSend(appHandle);
+    if (err != TRDP_NO_ERR)
+    {
+        if (err == TRDP_IO_ERR)
+        {
+            vos_printLogStr(VOS_LOG_INFO, "trdp_mdSend() incomplete \n");
+
+        }
+        else
+        {
+            result = err;
+            vos_printLog(VOS_LOG_ERROR, "trdp_mdSend() failed (Err: %d)\n", err);
+        }
+    }
+
+#endif
+
+    /******************************************************
+     Find packets which are to be received
+     ******************************************************/
+    err = trdp_pdCheckListenSocks(appHandle, pRfds, pCount);
+    if (err != TRDP_NO_ERR)
+    {
+        /*  We do not break here */
+        result = err;
+    }
+
+#if MD_SUPPORT
+
+    trdp_mdCheckListenSocks(appHandle, pRfds, pCount);
+
+    trdp_mdCheckTimeouts(appHandle);
+
+#endif
+
+    trdp_statsExport(appHandle);
+
+    TRDP_TRACE_SPAN(appHandle, TRDP_TRACE_PROCESS, 0u, 0u, 0u, now);
+
+    return result;
+}
+
+/**********************************************************************************************************************/
+/** Get the lowest time interval for PDs.
+ *  Return the maximum time interval suitable for 'select()' so that we
+ *    can send due PD packets in time.
+ *    If the PD send queue is empty, return zero time
+ *
+ *  @param[in]      appHandle          The handle returned by tlc_openSession
+ *  @param[out]     pInterval          pointer to needed interval
+ *  @param[in,out]  pFileDesc          pointer to file descriptor set
+ *  @param[out]     pNoDesc            pointer to put no of highest used descriptors (for select())
+ *
+ *  @retval         TRDP_NO_ERR        no error
+ *  @retval         TRDP_NOINIT_ERR    handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlc_getInterval (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_TIME_T         *pInterval,
+    TRDP_FDS_T          *pFileDesc,
+    INT32               *pNoDesc)
+{
+    VOS_TIME_NS_T   now;
+    TRDP_ERR_T      ret = TRDP_NOINIT_ERR;
+
+    if (trdp_isValidSession(appHandle))
+    {
+        if ((pInterval == NULL)
+            || (pFileDesc == NULL)
+            || (pNoDesc == NULL))
+        {
+            ret = TRDP_PARAM_ERR;
         }
         else
         {
@@ -1688,32 +2103,10 @@ EXT_DECL TRDP_ERR_T tlc_getInterval (
             else
             {
                 /*    Get the current time    */
-                vos_getTime(&now);
-                vos_clearTime(&appHandle->nextJob);
-
-                trdp_pdCheckPending(appHandle, pFileDesc, pNoDesc);
-
-#if MD_SUPPORT
-                trdp_mdCheckPending(appHandle, pFileDesc, pNoDesc);
-#endif
+                now = vos_getTimeNs();
 
-                /*    if next job time is known, return the time-out value to the caller   */
-                if (timerisset(&appHandle->nextJob) &&
-                    timercmp(&now, &appHandle->nextJob, <))
-                {
-                    vos_subTime(&appHandle->nextJob, &now);
-                    *pInterval = appHandle->nextJob;
-                }
-                else if (timerisset(&appHandle->nextJob))
-                {
-                    pInterval->tv_sec   = 0u;                               /* 0ms if time is over (were we delayed?) */
-                    pInterval->tv_usec  = 0;                                /* Application should limit this    */
-                }
-                else    /* if no timeout set, set maximum time to 1000sec   */
-                {
-                    pInterval->tv_sec   = 1000u;                            /* 1000s if no timeout is set      */
-                    pInterval->tv_usec  = 0;                                /* Application should limit this    */
-                }
+                trdp_sessionPending(appHandle, now, pFileDesc, pNoDesc);
+                trdp_jobInterval(appHandle->nextJob, now, pInterval);
 
                 if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
                 {
@@ -1743,8 +2136,7 @@ EXT_DECL TRDP_ERR_T tlc_process (
     TRDP_FDS_T          *pRfds,
     INT32               *pCount)
 {
-    TRDP_ERR_T  result = TRDP_NO_ERR;
-    TRDP_ERR_T  err;
+    TRDP_ERR_T result;
 
     if (!trdp_isValidSession(appHandle))
     {
@@ -1755,64 +2147,129 @@ EXT_DECL TRDP_ERR_T tlc_process (
     {
         return TRDP_NOINIT_ERR;
     }
-    else
+
+    result = trdp_sessionProcess(appHandle, vos_getTimeNs(), pRfds, pCount);
+
+    if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
     {
-        vos_clearTime(&appHandle->nextJob);
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
 
-        /******************************************************
-         Find and send the packets which have to be sent next:
-         ******************************************************/
+    return result;
+}
 
-        err = trdp_pdSendQueued(appHandle);
+/**********************************************************************************************************************/
+/** Get the lowest time interval for a group of sessions.
+ *  The descriptors of all sessions go into one set, the time-out is taken from the earliest job of all sessions.
+ *  The sessions are scanned one after the other, there is no deadline structure shared by the group.
+ *
+ *  @param[in,out]  pGroup             sessions to check, returns the earliest job in nextJob
+ *  @param[out]     pInterval          pointer to needed interval
+ *  @param[in,out]  pFileDesc          pointer to file descriptor set
+ *  @param[in,out]  pNoDesc            pointer to highest used descriptor (for select())
+ *
+ *  @retval         TRDP_NO_ERR        no error
+ *  @retval         TRDP_PARAM_ERR     parameter error
+ *  @retval         TRDP_NOINIT_ERR    a handle is invalid
+ */
+EXT_DECL TRDP_ERR_T tlc_getGroupInterval (
+    TRDP_SESSION_GROUP_T    *pGroup,
+    TRDP_TIME_T             *pInterval,
+    TRDP_FDS_T              *pFileDesc,
+    INT32                   *pNoDesc)
+{
+    TRDP_APP_SESSION_T  appHandle;
+    VOS_TIME_NS_T       now;
+    TRDP_ERR_T          ret = TRDP_NO_ERR;
+    UINT32              i;
 
-        if (err != TRDP_NO_ERR)
+    if ((pGroup == NULL)
+        || (pGroup->pSession == NULL)
+        || (pInterval == NULL)
+        || (pFileDesc == NULL)
+        || (pNoDesc == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /*    One time base for the whole group    */
+    now             = vos_getTimeNs();
+    pGroup->nextJob = 0u;
+
+    for (i = 0u; i < pGroup->numSessions; i++)
+    {
+        appHandle = pGroup->pSession[i];
+        if (!trdp_isValidSession(appHandle)
+            || (vos_mutexLock(appHandle->mutex) != VOS_NO_ERR))
         {
-            /*  We do not break here, only report error */
-            result = err;
-            /* vos_printLog(VOS_LOG_ERROR, "trdp_pdSendQueued failed (Err: %d)\n", err);*/
+            ret = TRDP_NOINIT_ERR;
+            continue;
         }
 
-        /******************************************************
-         Find packets which are pending/overdue
-         ******************************************************/
-        trdp_pdHandleTimeOuts(appHandle);
-
-#if MD_SUPPORT
+        trdp_sessionPending(appHandle, now, pFileDesc, pNoDesc);
 
-        err = trdp_mdSend(appHandle);
-        if (err != TRDP_NO_ERR)
+        if ((appHandle->nextJob != 0u) &&
+            ((pGroup->nextJob == 0u) || (appHandle->nextJob < pGroup->nextJob)))
         {
-            if (err == TRDP_IO_ERR)
-            {
-                vos_printLogStr(VOS_LOG_INFO, "trdp_mdSend() incomplete \n");
-
-            }
-            else
-            {
-                result = err;
-                vos_printLog(VOS_LOG_ERROR, "trdp_mdSend() failed (Err: %d)\n", err);
-            }
+            pGroup->nextJob = appHandle->nextJob;
         }
 
-#endif
-
-        /******************************************************
-         Find packets which are to be received
-         ******************************************************/
-        err = trdp_pdCheckListenSocks(appHandle, pRfds, pCount);
-        if (err != TRDP_NO_ERR)
+        if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
         {
-            /*  We do not break here */
-            result = err;
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
         }
+    }
 
-#if MD_SUPPORT
+    trdp_jobInterval(pGroup->nextJob, now, pInterval);
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Work loop of the TRDP handler for a group of sessions.
+ *  Processes every session like tlc_process, only the time stamp and the ready set are shared.
+ *
+ *  @param[in]      pGroup             sessions to process
+ *  @param[in]      pRfds              pointer to set of ready descriptors
+ *  @param[in,out]  pCount             pointer to number of ready descriptors
+ *
+ *  @retval         TRDP_NO_ERR        no error
+ *  @retval         TRDP_PARAM_ERR     parameter error
+ *  @retval         TRDP_NOINIT_ERR    a handle is invalid
+ */
+EXT_DECL TRDP_ERR_T tlc_processGroup (
+    TRDP_SESSION_GROUP_T    *pGroup,
+    TRDP_FDS_T              *pRfds,
+    INT32                   *pCount)
+{
+    TRDP_APP_SESSION_T  appHandle;
+    TRDP_ERR_T          result = TRDP_NO_ERR;
+    TRDP_ERR_T          err;
+    VOS_TIME_NS_T       now;
+    UINT32              i;
 
-        trdp_mdCheckListenSocks(appHandle, pRfds, pCount);
+    if ((pGroup == NULL) || (pGroup->pSession == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
 
-        trdp_mdCheckTimeouts(appHandle);
+    /*    One time base for the whole group    */
+    now = vos_getTimeNs();
 
-#endif
+    for (i = 0u; i < pGroup->numSessions; i++)
+    {
+        appHandle = pGroup->pSession[i];
+        if (!trdp_isValidSession(appHandle)
+            || (vos_mutexLock(appHandle->mutex) != VOS_NO_ERR))
+        {
+            result = TRDP_NOINIT_ERR;
+            continue;
+        }
+
+        err = trdp_sessionProcess(appHandle, now, pRfds, pCount);
+        if (err != TRDP_NO_ERR)
+        {
+            result = err;
+        }
 
         if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
         {
@@ -1963,8 +2420,8 @@ EXT_DECL TRDP_ERR_T tlp_request (
                 else
                 {
                     /*  Mark this element as a PD PULL Request.  Request will be sent on tlc_process time.    */
-                    vos_clearTime(&pReqElement->interval);
-                    vos_clearTime(&pReqElement->timeToGo);
+                    pReqElement->interval   = 0u;
+                    pReqElement->timeToGo   = 0u;
 
                     /*  Update the internal data */
                     pReqElement->addr.comId         = comId;
@@ -1983,6 +2440,7 @@ EXT_DECL TRDP_ERR_T tlp_request (
                                                             TRDP_MSG_PR, pReqElement->addr.srcIpAddr) - 1;
                     /*    Enter this request into the send queue.    */
                     trdp_queueInsFirst(&appHandle->pSndQueue, pReqElement);
+                    TRDP_STATS_INC(appHandle->stats.pd.numPub);
                 }
             }
         }
@@ -2011,10 +2469,9 @@ EXT_DECL TRDP_ERR_T tlp_request (
             pReqElement->privFlags |= TRDP_REQ_2B_SENT;
 
             /*    Set the current time and start time out of subscribed packet  */
-            if (timerisset(&pSubPD->interval))
+            if (pSubPD->interval != 0u)
             {
-                vos_getTime(&pSubPD->timeToGo);
-                vos_addTime(&pSubPD->timeToGo, &pSubPD->interval);
+                pSubPD->timeToGo = vos_getTimeNs() + pSubPD->interval;
                 pSubPD->privFlags &= (unsigned)~TRDP_TIMED_OUT;   /* Reset time out flag (#151) */
             }
         }
@@ -2029,59 +2486,28 @@ EXT_DECL TRDP_ERR_T tlp_request (
 }
 
 /**********************************************************************************************************************/
-/** Prepare for receiving PD messages.
- *  Subscribe to a specific PD ComID and source IP.
+/** Subscribe to one telegram, the session must be locked.
+ *  Common part of tlp_subscribe and tlc_applyConfig.
  *
  *  @param[in]      appHandle           the handle returned by tlc_openSession
- *  @param[out]     pSubHandle          return a handle for this subscription
- *  @param[in]      pUserRef            user supplied value returned within the info structure
- *  @param[in]      pfCbFunction        Pointer to subscriber specific callback function, NULL to use default function
- *  @param[in]      comId               comId of packet to receive
- *  @param[in]      etbTopoCnt          ETB topocount to use, 0 if consist local communication
- *  @param[in]      opTrnTopoCnt        operational topocount, != 0 for orientation/direction sensitive communication
- *  @param[in]      srcIpAddr1          Source IP address, lower address in case of address range, set to 0 if not used
- *  @param[in]      srcIpAddr2          upper address in case of address range, set to 0 if not used
- *  @param[in]      pktFlags            OPTION:
- *                                      TRDP_FLAGS_DEFAULT, TRDP_FLAGS_NONE, TRDP_FLAGS_MARSHALL, TRDP_FLAGS_CALLBACK
- *  @param[in]      destIpAddr          IP address to join
- *  @param[in]      timeout             timeout (>= 10ms) in usec
- *  @param[in]      toBehavior          timeout behavior
+ *  @param[in,out]  pPar                subscription, returns handle
+ *  @param[in]      pBulk               state of tlc_applyConfig, NULL for a single call
  *
  *  @retval         TRDP_NO_ERR         no error
- *  @retval         TRDP_PARAM_ERR      parameter error
  *  @retval         TRDP_MEM_ERR        could not reserve memory (out of memory)
- *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_NOSUB_ERR      already subscribed
  */
-EXT_DECL TRDP_ERR_T tlp_subscribe (
-    TRDP_APP_SESSION_T  appHandle,
-    TRDP_SUB_T          *pSubHandle,
-    const void          *pUserRef,
-    TRDP_PD_CALLBACK_T  pfCbFunction,
-    UINT32              comId,
-    UINT32              etbTopoCnt,
-    UINT32              opTrnTopoCnt,
-    TRDP_IP_ADDR_T      srcIpAddr1,
-    TRDP_IP_ADDR_T      srcIpAddr2,
-    TRDP_IP_ADDR_T      destIpAddr,
-    TRDP_FLAGS_T        pktFlags,
-    UINT32              timeout,
-    TRDP_TO_BEHAVIOR_T  toBehavior)
+static TRDP_ERR_T trdp_pdSubscribe (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_SUBSCRIBE_PAR_T    *pPar,
+    TRDP_BULK_T             *pBulk)
 {
-    TRDP_TIME_T         now;
-    TRDP_ERR_T          ret = TRDP_NO_ERR;
+    TRDP_ERR_T          ret     = TRDP_NO_ERR;
+    UINT32              timeout = pPar->timeout;
     TRDP_ADDRESSES_T    subHandle;
     INT32 lIndex;
 
-    /*    Check params    */
-    if (pSubHandle == NULL)
-    {
-        return TRDP_PARAM_ERR;
-    }
-
-    if (!trdp_isValidSession(appHandle))
-    {
-        return TRDP_NOINIT_ERR;
-    }
+    pPar->subHandle = NULL;
 
     if (timeout == 0u)
     {
@@ -2092,54 +2518,42 @@ EXT_DECL TRDP_ERR_T tlp_subscribe (
         timeout = TRDP_TIMER_GRANULARITY;
     }
 
-    /*    Reserve mutual access    */
-    if (vos_mutexLock(appHandle->mutex) != VOS_NO_ERR)
-    {
-        return TRDP_NOINIT_ERR;
-    }
-
     /*  Create an addressing item   */
-    subHandle.comId         = comId;
-    subHandle.srcIpAddr     = srcIpAddr1;
-    subHandle.srcIpAddr2    = srcIpAddr2;
-    subHandle.destIpAddr    = destIpAddr;
+    memset(&subHandle, 0, sizeof(subHandle));
+    subHandle.comId         = pPar->comId;
+    subHandle.srcIpAddr     = pPar->srcIpAddr1;
+    subHandle.srcIpAddr2    = pPar->srcIpAddr2;
+    subHandle.destIpAddr    = pPar->destIpAddr;
     subHandle.opTrnTopoCnt  = 0u;            /* Do not compare topocounts  */
     subHandle.etbTopoCnt    = 0u;
 
-    if (vos_isMulticast(destIpAddr))
+    if (vos_isMulticast(pPar->destIpAddr))
     {
-        subHandle.mcGroup = destIpAddr;
+        subHandle.mcGroup = pPar->destIpAddr;
     }
     else
     {
         subHandle.mcGroup = 0u;
     }
 
-    /*    Get the current time    */
-    vos_getTime(&now);
-
     /*    Look for existing element    */
-    if (trdp_queueFindSubAddr(appHandle->pRcvQueue, &subHandle) != NULL)
+    if (trdp_isSubscribed(appHandle, pBulk, &subHandle) == TRUE)
     {
         ret = TRDP_NOSUB_ERR;
     }
     else
     {
-        subHandle.opTrnTopoCnt  = opTrnTopoCnt; /* Set topocounts now  */
-        subHandle.etbTopoCnt    = etbTopoCnt;
+        subHandle.opTrnTopoCnt  = pPar->opTrnTopoCnt; /* Set topocounts now  */
+        subHandle.etbTopoCnt    = pPar->etbTopoCnt;
 
         /*    Find a (new) socket    */
-        ret = trdp_requestSocket(appHandle->iface,
-                                 appHandle->pdDefault.port,
-                                 &appHandle->pdDefault.sendParam,
-                                 appHandle->realIP,
-                                 subHandle.mcGroup,
-                                 TRDP_SOCK_PD,
-                                 appHandle->option,
-                                 TRUE,
-                                 -1,
-                                 &lIndex,
-                                 0u);
+        ret = trdp_pdRequestSocket(appHandle,
+                                   pBulk,
+                                   &appHandle->pdDefault.sendParam,
+                                   appHandle->realIP,
+                                   subHandle.mcGroup,
+                                   TRUE,
+                                   &lIndex);
 
         if (ret == TRDP_NO_ERR)
         {
@@ -2164,13 +2578,14 @@ EXT_DECL TRDP_ERR_T tlp_subscribe (
                     vos_memFree(newPD);
                     newPD   = NULL;
                     ret     = TRDP_MEM_ERR;
+                    trdp_releaseSocket(appHandle->iface, lIndex, 0u, FALSE, VOS_INADDR_ANY);
                 }
                 else
                 {
                     /*    Initialize some fields    */
-                    if (vos_isMulticast(destIpAddr))
+                    if (vos_isMulticast(pPar->destIpAddr))
                     {
-                        newPD->addr.mcGroup = destIpAddr;
+                        newPD->addr.mcGroup = pPar->destIpAddr;
                         newPD->privFlags    |= TRDP_MC_JOINT;
                     }
                     else
@@ -2178,76 +2593,334 @@ EXT_DECL TRDP_ERR_T tlp_subscribe (
                         newPD->addr.mcGroup = 0u;
                     }
 
-                    newPD->addr.comId       = comId;
-                    newPD->addr.srcIpAddr   = srcIpAddr1;
-                    newPD->addr.srcIpAddr2  = srcIpAddr2;
-                    newPD->addr.destIpAddr  = destIpAddr;
-                    newPD->interval.tv_sec  = timeout / 1000000u;
-                    newPD->interval.tv_usec = timeout % 1000000u;
+                    newPD->addr.comId       = pPar->comId;
+                    newPD->addr.srcIpAddr   = pPar->srcIpAddr1;
+                    newPD->addr.srcIpAddr2  = pPar->srcIpAddr2;
+                    newPD->addr.destIpAddr  = pPar->destIpAddr;
+                    newPD->interval         = VOS_NS_FROM_USEC(timeout);
                     newPD->toBehavior       =
-                        (toBehavior == TRDP_TO_DEFAULT) ? appHandle->pdDefault.toBehavior : toBehavior;
+                        (pPar->toBehavior == TRDP_TO_DEFAULT) ? appHandle->pdDefault.toBehavior : pPar->toBehavior;
                     newPD->grossSize    = TRDP_MAX_PD_PACKET_SIZE;
-                    newPD->pUserRef     = pUserRef;
+                    newPD->pUserRef     = pPar->pUserRef;
                     newPD->socketIdx    = lIndex;
                     newPD->privFlags    |= TRDP_INVALID_DATA;
                     newPD->pktFlags     =
-                        (pktFlags == TRDP_FLAGS_DEFAULT) ? appHandle->pdDefault.flags : pktFlags;
+                        (pPar->pktFlags == TRDP_FLAGS_DEFAULT) ? appHandle->pdDefault.flags : pPar->pktFlags;
                     newPD->pfCbFunction =
-                        (pfCbFunction == NULL) ? appHandle->pdDefault.pfCbFunction : pfCbFunction;
+                        (pPar->pfCbFunction == NULL) ? appHandle->pdDefault.pfCbFunction : pPar->pfCbFunction;
                     newPD->pCachedDS    = NULL;
                     newPD->magic        = TRDP_MAGIC_SUB_HNDL_VALUE;
 
                     if (timeout == TRDP_TIMER_FOREVER)
                     {
-                        vos_clearTime(&newPD->timeToGo);
-                        vos_clearTime(&newPD->interval);
+                        newPD->timeToGo = 0u;
+                        newPD->interval = 0u;
                     }
                     else
                     {
-                        vos_getTime(&newPD->timeToGo);
-                        vos_addTime(&newPD->timeToGo, &newPD->interval);
+                        newPD->timeToGo = vos_getTimeNs() + newPD->interval;
                     }
 
                     /*  append this subscription to our receive queue */
                     trdp_queueAppLast(&appHandle->pRcvQueue, newPD);
+                    TRDP_STATS_INC(appHandle->stats.pd.numSubs);
+                    if (pBulk != NULL)
+                    {
+                        trdp_pdIndexAdd(&pBulk->rcv, newPD, FALSE);
+                    }
 
-                    *pSubHandle = (TRDP_SUB_T) newPD;
+                    pPar->subHandle = (TRDP_SUB_T) newPD;
                 }
             }
         } /*lint !e438 unused newPD */
     }
 
-    if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
-    {
-        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
-    }
-
     return ret;
 }
 
-
 /**********************************************************************************************************************/
-/** Stop receiving PD messages.
- *  Unsubscribe to a specific PD ComID
+/** Prepare for receiving PD messages.
+ *  Subscribe to a specific PD ComID and source IP.
  *
- *  @param[in]      appHandle            the handle returned by tlc_openSession
- *  @param[in]      subHandle            the handle for this subscription
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[out]     pSubHandle          return a handle for this subscription
+ *  @param[in]      pUserRef            user supplied value returned within the info structure
+ *  @param[in]      pfCbFunction        Pointer to subscriber specific callback function, NULL to use default function
+ *  @param[in]      comId               comId of packet to receive
+ *  @param[in]      etbTopoCnt          ETB topocount to use, 0 if consist local communication
+ *  @param[in]      opTrnTopoCnt        operational topocount, != 0 for orientation/direction sensitive communication
+ *  @param[in]      srcIpAddr1          Source IP address, lower address in case of address range, set to 0 if not used
+ *  @param[in]      srcIpAddr2          upper address in case of address range, set to 0 if not used
+ *  @param[in]      pktFlags            OPTION:
+ *                                      TRDP_FLAGS_DEFAULT, TRDP_FLAGS_NONE, TRDP_FLAGS_MARSHALL, TRDP_FLAGS_CALLBACK
+ *  @param[in]      destIpAddr          IP address to join
+ *  @param[in]      timeout             timeout (>= 10ms) in usec
+ *  @param[in]      toBehavior          timeout behavior
  *
- *  @retval         TRDP_NO_ERR          no error
- *  @retval         TRDP_PARAM_ERR       parameter error
- *  @retval         TRDP_NOSUB_ERR       not subscribed
- *  @retval         TRDP_NOINIT_ERR      handle invalid
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        could not reserve memory (out of memory)
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
  */
-EXT_DECL TRDP_ERR_T tlp_unsubscribe (
+EXT_DECL TRDP_ERR_T tlp_subscribe (
     TRDP_APP_SESSION_T  appHandle,
-    TRDP_SUB_T          subHandle)
-{
-    PD_ELE_T    *pElement = (PD_ELE_T *) subHandle;
-    TRDP_ERR_T  ret;
-
-    if (pElement == NULL )
-    {
-        return TRDP_PARAM_ERR;
+    TRDP_SUB_T          *pSubHandle,
+    const void          *pUserRef,
+    TRDP_PD_CALLBACK_T  pfCbFunction,
+    UINT32              comId,
+    UINT32              etbTopoCnt,
+    UINT32              opTrnTopoCnt,
+    TRDP_IP_ADDR_T      srcIpAddr1,
+    TRDP_IP_ADDR_T      srcIpAddr2,
+    TRDP_IP_ADDR_T      destIpAddr,
+    TRDP_FLAGS_T        pktFlags,
+    UINT32              timeout,
+    TRDP_TO_BEHAVIOR_T  toBehavior)
+{
+    TRDP_SUBSCRIBE_PAR_T    par;
+    TRDP_ERR_T ret = TRDP_NO_ERR;
+
+    /*    Check params    */
+    if (pSubHandle == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    /*    Reserve mutual access    */
+    if (vos_mutexLock(appHandle->mutex) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    par.pUserRef        = pUserRef;
+    par.pfCbFunction    = pfCbFunction;
+    par.comId           = comId;
+    par.etbTopoCnt      = etbTopoCnt;
+    par.opTrnTopoCnt    = opTrnTopoCnt;
+    par.srcIpAddr1      = srcIpAddr1;
+    par.srcIpAddr2      = srcIpAddr2;
+    par.destIpAddr      = destIpAddr;
+    par.pktFlags        = pktFlags;
+    par.timeout         = timeout;
+    par.toBehavior      = toBehavior;
+
+    ret = trdp_pdSubscribe(appHandle, &par, NULL);
+    if (par.subHandle != NULL)
+    {
+        *pSubHandle = par.subHandle;
+    }
+
+    if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Publish and subscribe many telegrams at once.
+ *  Has the same effect as calling tlp_publish and tlp_subscribe for each entry in turn, but the session is locked
+ *  once, duplicates and redundant publishers are found through a temporary comId index, sockets are reused for
+ *  entries with the same parameters, and the queues are built in one pass.
+ *  Entries which fail are skipped; their result is set and their handle is NULL.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      numPub              number of publications
+ *  @param[in,out]  pPub                array of publications, returns handles and results
+ *  @param[in]      numSub              number of subscriptions
+ *  @param[in,out]  pSub                array of subscriptions, returns handles and results
+ *
+ *  @retval         TRDP_NO_ERR         all entries were applied
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        out of memory
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         other               result of the first failed entry
+ */
+EXT_DECL TRDP_ERR_T tlc_applyConfig (
+    TRDP_APP_SESSION_T      appHandle,
+    UINT32                  numPub,
+    TRDP_PUBLISH_PAR_T      *pPub,
+    UINT32                  numSub,
+    TRDP_SUBSCRIBE_PAR_T    *pSub)
+{
+    TRDP_BULK_T     bulk;
+    TRDP_SESSION_PT pSession;
+    PD_ELE_T        *iterPD;
+    UINT32          numBefore   = 0u;
+    UINT32          numOwn      = 0u;
+    UINT32          numAfter    = 0u;
+    UINT32          numRcv      = 0u;
+    BOOL8           isAfter     = FALSE;
+    UINT32          i;
+    TRDP_ERR_T      ret = TRDP_NO_ERR;
+
+    /*    Check params    */
+    if (((numPub != 0u) && (pPub == NULL))
+        || ((numSub != 0u) && (pSub == NULL)))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    /*    Reserve mutual access    */
+    if (vos_mutexLock(appHandle->mutex) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    /*  Size the indexes: the send queues in session order (for the sequence counters) and our own queues  */
+    for (pSession = sSession; pSession != NULL; pSession = pSession->pNext)
+    {
+        for (iterPD = pSession->pSndQueue; iterPD != NULL; iterPD = iterPD->pNext)
+        {
+            if (pSession == (TRDP_SESSION_PT) appHandle)
+            {
+                numOwn++;
+            }
+            else if (isAfter == TRUE)
+            {
+                numAfter++;
+            }
+            else
+            {
+                numBefore++;
+            }
+        }
+        if (pSession == (TRDP_SESSION_PT) appHandle)
+        {
+            isAfter = TRUE;
+        }
+    }
+    for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
+    {
+        numRcv++;
+    }
+
+    memset(&bulk, 0, sizeof(bulk));
+    bulk.sockIdx = -1;
+    if ((trdp_pdIndexInit(&bulk.before, numBefore) != TRDP_NO_ERR)
+        || (trdp_pdIndexInit(&bulk.own, numOwn + numPub) != TRDP_NO_ERR)
+        || (trdp_pdIndexInit(&bulk.after, numAfter) != TRDP_NO_ERR)
+        || (trdp_pdIndexInit(&bulk.rcv, numRcv + numSub) != TRDP_NO_ERR))
+    {
+        ret = TRDP_MEM_ERR;
+        for (i = 0u; i < numPub; i++)
+        {
+            pPub[i].pubHandle   = NULL;
+            pPub[i].result      = TRDP_MEM_ERR;
+        }
+        for (i = 0u; i < numSub; i++)
+        {
+            pSub[i].subHandle   = NULL;
+            pSub[i].result      = TRDP_MEM_ERR;
+        }
+    }
+    else
+    {
+        /*  Fill the indexes in queue order    */
+        isAfter = FALSE;
+        for (pSession = sSession; pSession != NULL; pSession = pSession->pNext)
+        {
+            for (iterPD = pSession->pSndQueue; iterPD != NULL; iterPD = iterPD->pNext)
+            {
+                trdp_pdIndexAdd((pSession == (TRDP_SESSION_PT) appHandle) ? &bulk.own
+                                : ((isAfter == TRUE) ? &bulk.after : &bulk.before),
+                                iterPD, FALSE);
+            }
+            if (pSession == (TRDP_SESSION_PT) appHandle)
+            {
+                isAfter = TRUE;
+            }
+        }
+        for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
+        {
+            trdp_pdIndexAdd(&bulk.rcv, iterPD, FALSE);
+        }
+
+        for (i = 0u; i < numPub; i++)
+        {
+            if ((pPub[i].interval != 0u) && (pPub[i].interval < TRDP_TIMER_GRANULARITY))
+            {
+                pPub[i].pubHandle   = NULL;
+                pPub[i].result      = TRDP_PARAM_ERR;
+            }
+            else
+            {
+                pPub[i].result = trdp_pdPublish(appHandle, &pPub[i], &bulk);
+            }
+            if ((pPub[i].result != TRDP_NO_ERR) && (ret == TRDP_NO_ERR))
+            {
+                ret = pPub[i].result;
+            }
+        }
+
+        for (i = 0u; i < numSub; i++)
+        {
+            pSub[i].result = trdp_pdSubscribe(appHandle, &pSub[i], &bulk);
+            if ((pSub[i].result != TRDP_NO_ERR) && (ret == TRDP_NO_ERR))
+            {
+                ret = pSub[i].result;
+            }
+        }
+
+        /*  Distribute the send times once for all new publications  */
+        if ((numPub != 0u) && (appHandle->option & TRDP_OPTION_TRAFFIC_SHAPING))
+        {
+            TRDP_ERR_T err = trdp_pdDistribute(appHandle->pSndQueue);
+
+            if (ret == TRDP_NO_ERR)
+            {
+                ret = err;
+            }
+        }
+    }
+
+    trdp_pdIndexFree(&bulk.before);
+    trdp_pdIndexFree(&bulk.own);
+    trdp_pdIndexFree(&bulk.after);
+    trdp_pdIndexFree(&bulk.rcv);
+
+    if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+
+    return ret;
+}
+
+
+/**********************************************************************************************************************/
+/** Stop receiving PD messages.
+ *  Unsubscribe to a specific PD ComID
+ *
+ *  @param[in]      appHandle            the handle returned by tlc_openSession
+ *  @param[in]      subHandle            the handle for this subscription
+ *
+ *  @retval         TRDP_NO_ERR          no error
+ *  @retval         TRDP_PARAM_ERR       parameter error
+ *  @retval         TRDP_NOSUB_ERR       not subscribed
+ *  @retval         TRDP_NOINIT_ERR      handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlp_unsubscribe (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle)
+{
+    PD_ELE_T    *pElement = (PD_ELE_T *) subHandle;
+    TRDP_ERR_T  ret;
+
+    if (pElement == NULL )
+    {
+        return TRDP_PARAM_ERR;
     }
 
     if (pElement->magic != TRDP_MAGIC_SUB_HNDL_VALUE)
@@ -2267,6 +2940,8 @@ EXT_DECL TRDP_ERR_T tlp_unsubscribe (
         TRDP_IP_ADDR_T mcGroup = pElement->addr.mcGroup;
         /*    Remove from queue?    */
         trdp_queueDelElement(&appHandle->pRcvQueue, pElement);
+        TRDP_STATS_DEC(appHandle->stats.pd.numSubs);
+        TRDP_STATS_SUB(appHandle->stats.pd.numMissed, pElement->numMissed);
         /*    if we subscribed to an MC-group, check if anyone else did too: */
         if (mcGroup != VOS_INADDR_ANY)
         {
@@ -2282,6 +2957,7 @@ EXT_DECL TRDP_ERR_T tlp_unsubscribe (
         {
             vos_memFree(pElement->pSeqCntList);
         }
+        trdp_pdFreeSources(pElement);
         vos_memFree(pElement);
         ret = TRDP_NO_ERR;
         if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
@@ -2424,7 +3100,6 @@ EXT_DECL TRDP_ERR_T tlp_get (
 {
     PD_ELE_T    *pElement   = (PD_ELE_T *) subHandle;
     TRDP_ERR_T  ret         = TRDP_NOSUB_ERR;
-    TRDP_TIME_T now;
 
     if (pElement == NULL)
     {
@@ -2445,6 +3120,9 @@ EXT_DECL TRDP_ERR_T tlp_get (
     ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutex);
     if (ret == TRDP_NO_ERR)
     {
+        /*    Get the current time, also used by the receive function outside of tlc_process    */
+        appHandle->now = vos_getTimeNs();
+
         /*    Call the receive function if we are in non blocking mode    */
         if (!(appHandle->option & TRDP_OPTION_BLOCK))
         {
@@ -2454,12 +3132,9 @@ EXT_DECL TRDP_ERR_T tlp_get (
             while (trdp_pdReceive(appHandle, appHandle->iface[pElement->socketIdx].sock) == TRDP_NO_ERR);
         }
 
-        /*    Get the current time    */
-        vos_getTime(&now);
-
         /*    Check time out    */
-        if (timerisset(&pElement->interval) &&
-            timercmp(&pElement->timeToGo, &now, <))
+        if ((pElement->interval != 0u) &&
+            (pElement->timeToGo < appHandle->now))
         {
             /*    Packet is late    */
             if (pElement->toBehavior == TRDP_TO_SET_TO_ZERO &&
@@ -2507,6 +3182,189 @@ EXT_DECL TRDP_ERR_T tlp_get (
     return ret;
 }
 
+/**********************************************************************************************************************/
+/** Get the last valid PD message of one sender of a multi source subscription, by index or by source address.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by subscription
+ *  @param[in]      index               number of the sender, if srcIpAddr is 0
+ *  @param[in]      srcIpAddr           source IP address of the sender or 0
+ *  @param[in,out]  pPdInfo             pointer to application's info buffer
+ *  @param[in,out]  pData               pointer to application's data buffer
+ *  @param[in,out]  pDataSize           in: size of buffer, out: size of data
+ *
+ *  @retval         see tlp_getSourceByIndex, tlp_getSourceByAddr
+ */
+static TRDP_ERR_T trdp_getSource (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    UINT32              index,
+    TRDP_IP_ADDR_T      srcIpAddr,
+    TRDP_PD_INFO_T      *pPdInfo,
+    UINT8               *pData,
+    UINT32              *pDataSize)
+{
+    PD_ELE_T    *pElement   = (PD_ELE_T *) subHandle;
+    TRDP_ERR_T  ret         = TRDP_NOSUB_ERR;
+
+    if (pElement == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (pElement->magic != TRDP_MAGIC_SUB_HNDL_VALUE)
+    {
+        return TRDP_NOSUB_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    /*    Reserve mutual access    */
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutex);
+    if (ret == TRDP_NO_ERR)
+    {
+        appHandle->now = vos_getTimeNs();
+
+        /*    Call the receive function if we are in non blocking mode    */
+        if (!(appHandle->option & TRDP_OPTION_BLOCK))
+        {
+            /* read all you can get, return value is not interesting */
+            do
+            {}
+            while (trdp_pdReceive(appHandle, appHandle->iface[pElement->socketIdx].sock) == TRDP_NO_ERR);
+        }
+
+        ret = trdp_pdGetSource(appHandle, pElement, index, srcIpAddr, pPdInfo, pData, pDataSize);
+
+        if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
+        {
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        }
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Return the number of senders of a multi source subscription (TRDP_FLAGS_MULTI_SRC).
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by subscription
+ *  @param[out]     pNumSources         number of senders received from so far
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error or no multi source subscription
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlp_getSources (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    UINT32              *pNumSources)
+{
+    PD_ELE_T    *pElement   = (PD_ELE_T *) subHandle;
+    TRDP_ERR_T  ret         = TRDP_NOSUB_ERR;
+
+    if ((pElement == NULL) || (pNumSources == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (pElement->magic != TRDP_MAGIC_SUB_HNDL_VALUE)
+    {
+        return TRDP_NOSUB_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if (!(pElement->pktFlags & TRDP_FLAGS_MULTI_SRC))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /*    Reserve mutual access    */
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutex);
+    if (ret == TRDP_NO_ERR)
+    {
+        *pNumSources = (pElement->pSrcList != NULL) ? pElement->pSrcList->numSrc : 0u;
+
+        if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
+        {
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        }
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Get the last valid PD message of one sender of a multi source subscription (TRDP_FLAGS_MULTI_SRC).
+ *  Each sender is supervised with the time out of the subscription on its own.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by subscription
+ *  @param[in]      index               number of the sender (0 ... tlp_getSources - 1)
+ *  @param[in,out]  pPdInfo             pointer to application's info buffer
+ *  @param[in,out]  pData               pointer to application's data buffer
+ *  @param[in,out]  pDataSize           in: size of buffer, out: size of data
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error, no multi source subscription or index out of range
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ *  @retval         TRDP_TIMEOUT_ERR    sender timed out
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_COMID_ERR      ComID not found when marshalling
+ */
+EXT_DECL TRDP_ERR_T tlp_getSourceByIndex (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    UINT32              index,
+    TRDP_PD_INFO_T      *pPdInfo,
+    UINT8               *pData,
+    UINT32              *pDataSize)
+{
+    return trdp_getSource(appHandle, subHandle, index, VOS_INADDR_ANY, pPdInfo, pData, pDataSize);
+}
+
+/**********************************************************************************************************************/
+/** Get the last valid PD message of a sender of a multi source subscription (TRDP_FLAGS_MULTI_SRC).
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by subscription
+ *  @param[in]      srcIpAddr           source IP address of the sender
+ *  @param[in,out]  pPdInfo             pointer to application's info buffer
+ *  @param[in,out]  pData               pointer to application's data buffer
+ *  @param[in,out]  pDataSize           in: size of buffer, out: size of data
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error or no multi source subscription
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ *  @retval         TRDP_NODATA_ERR     nothing received from this sender
+ *  @retval         TRDP_TIMEOUT_ERR    sender timed out
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_COMID_ERR      ComID not found when marshalling
+ */
+EXT_DECL TRDP_ERR_T tlp_getSourceByAddr (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    TRDP_IP_ADDR_T      srcIpAddr,
+    TRDP_PD_INFO_T      *pPdInfo,
+    UINT8               *pData,
+    UINT32              *pDataSize)
+{
+    if (srcIpAddr == VOS_INADDR_ANY)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    return trdp_getSource(appHandle, subHandle, 0u, srcIpAddr, pPdInfo, pData, pDataSize);
+}
+
 #if MD_SUPPORT
 /**********************************************************************************************************************/
 /** Initiate sending MD notification message.
@@ -2838,11 +3696,11 @@ EXT_DECL TRDP_ERR_T  tlm_addListener (
                     /* Statistics */
                     if ((pNewElement->pktFlags & TRDP_FLAGS_TCP) != 0)
                     {
-                        appHandle->stats.tcpMd.numList++;
+                        TRDP_STATS_INC(appHandle->stats.tcpMd.numList);
                     }
                     else
                     {
-                        appHandle->stats.udpMd.numList++;
+                        TRDP_STATS_INC(appHandle->stats.udpMd.numList);
                     }
                 }
             }
@@ -2950,11 +3808,11 @@ TRDP_ERR_T tlm_delListener (
     /* Statistics */
     if ((appHandle->mdDefault.flags & TRDP_FLAGS_TCP) != 0 )
     {
-        appHandle->stats.tcpMd.numList--;
+        TRDP_STATS_DEC(appHandle->stats.tcpMd.numList);
     }
     else
     {
-        appHandle->stats.udpMd.numList--;
+        TRDP_STATS_DEC(appHandle->stats.udpMd.numList);
     }
 
     /* Release mutex */
@@ -19,6 +19,15 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Hot path trace points (TRDP_TRACE): send, receive, callbacks, timeouts, state changes
+ *      AG 2026-10-18: Statistics counters via TRDP_STATS_INC (atomic)
+ *      AG 2026-10-18: MD time-outs are merged into the session's nextJob (ns)
+ *      AG 2026-10-18: trdp_mdCloseSessions continues behind a freed session instead of rescanning the queue
+ *      AG 2026-10-18: Repeated requests detected by a sessionID hash with sequence counter window
+ *      AG 2026-10-18: TCP MD pipelining: a blocked send on a shared connection is resumed, not aborted
+ *      AG 2026-10-18: Aggregated reply mode for MD requests (TRDP_FLAGS_AGGREGATE)
+ *      AG 2026-10-18: Vectored MD send: header and caller's data as separate buffers (TRDP_FLAGS_NOCOPY)
+ *      AG 2026-10-18: TCP MD receive: per connection stream buffer, several frames per read
  *      BL 2018-11-07: Ticket #185 MD reply: Infinite timeout wrong handled
  *      BL 2018-11-07: Ticket #220 Message Data - Different behaviour UDP & TCP
  *      BL 2018-11-06: for-loops limited to sCurrentMaxSocketCnt instead VOS_MAX_SOCKET_CNT
@@ -65,6 +74,8 @@
 #include "trdp_if.h"
 #include "trdp_utils.h"
 #include "trdp_mdcom.h"
+#include "trdp_stats.h"
+#include "trdp_trace.h"
 
 
 /***********************************************************************************************************************
@@ -73,6 +84,10 @@
 #define CHECK_HEADER_ONLY   TRUE
 #define CHECK_DATA_TOO      FALSE
 
+/** Trace the new state of an MD session */
+#define TRDP_TRACE_MD_NEW_STATE(appHandle, pEle) \
+    TRDP_TRACE_EVENT((appHandle), TRDP_TRACE_MD_STATE, (pEle)->addr.comId, 0u, (UINT16) (pEle)->stateEle)
+
 /***********************************************************************************************************************
  * TYPEDEFS
  */
@@ -83,8 +98,12 @@
  */
 
 static const UINT32 cMinimumMDSize = 1480u;                            /**< Initial size for message data received */
+static const UINT32 cTCPRcvBufferSize = 4u * 1480u;                    /**< Initial size of a TCP stream buffer    */
 static const UINT8  cEmptySession[TRDP_SESS_ID_SIZE];                  /**< Empty sessionID to compare             */
 static const TRDP_MD_INFO_T cTrdp_md_info_default;
+static const UINT8  cPadding[3];                                       /**< Zero bytes to pad in place data        */
+static const UINT32 cMDDupMinTableSize = 16u;                          /**< Initial size of the duplicate table    */
+static const UINT32 cMDDupWindowSize = 32u;                            /**< Sequence counters remembered per sess. */
 
 /***********************************************************************************************************************
  *   Local Functions
@@ -100,6 +119,17 @@ static TRDP_ERR_T   trdp_mdLookupElement (MD_ELE_T                  *pinitialMdE
                                           const TRDP_UUID_T         pSessionId,
                                           MD_ELE_T                  * *pretrievedMdElement);
 
+static void trdp_mdAggregateReply (MD_ELE_T *pElement);
+static UINT32               trdp_mdDupHash (const UINT8 *pSessionId);
+static TRDP_MD_DUP_ENTRY_T  *trdp_mdDupLookup (TRDP_SESSION_PT  appHandle,
+                                               const UINT8      *pSessionId);
+static TRDP_ERR_T           trdp_mdDupInsert (TRDP_SESSION_PT   appHandle,
+                                              MD_ELE_T          *pSession,
+                                              UINT32            seqCnt);
+static void                 trdp_mdDupRemove (TRDP_SESSION_PT   appHandle,
+                                              const MD_ELE_T    *pSession);
+static BOOL8                trdp_mdDupSeqReceived (TRDP_MD_DUP_ENTRY_T  *pEntry,
+                                                   UINT32               seqCnt);
 static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
                                    const TRDP_SESSION_PT    appHandle,
                                    const TRDP_ERR_T         resultCode);
@@ -121,21 +151,34 @@ static void trdp_mdCloseSessions (TRDP_SESSION_PT   appHandle,
                                   SOCKET            newSocket,
                                   BOOL8             checkAllSockets);
 static void trdp_mdSetSessionTimeout (MD_ELE_T *pMDSession);
+static void trdp_mdNextJob (TRDP_SESSION_PT     appHandle,
+                            const MD_ELE_T      *pElement);
 static TRDP_ERR_T   trdp_mdCheck (TRDP_SESSION_PT   appHandle,
                                   MD_HEADER_T       *pPacket,
                                   UINT32            packetSize,
                                   BOOL8             checkHeaderOnly);
+static BOOL8        trdp_mdSendInPlace (TRDP_SESSION_PT appHandle,
+                                        TRDP_FLAGS_T    pktFlags,
+                                        const UINT8     *pData);
+static UINT32       trdp_mdSetupIov (const MD_ELE_T *pElement,
+                                     UINT32         offset,
+                                     VOS_IOVEC_T    iov[]);
 static TRDP_ERR_T   trdp_mdSendPacket (SOCKET   mdSock,
                                        UINT16   port,
                                        MD_ELE_T *pElement);
+static TRDP_ERR_T   trdp_mdTCPFrameSize (TRDP_SESSION_PT            appHandle,
+                                         const TRDP_TCP_RCV_BUF_T   *pBuf,
+                                         UINT32                     *pFrameSize);
+static BOOL8        trdp_mdTCPFramePending (TRDP_SESSION_PT appHandle,
+                                            UINT32          sockIndex);
 static TRDP_ERR_T   trdp_mdRecvTCPPacket (TRDP_SESSION_PT   appHandle,
-                                          SOCKET            mdSock,
+                                          UINT32            sockIndex,
                                           MD_ELE_T          *pElement);
 static TRDP_ERR_T   trdp_mdRecvUDPPacket (TRDP_SESSION_PT   appHandle,
                                           SOCKET            mdSock,
                                           MD_ELE_T          *pElement);
 static TRDP_ERR_T   trdp_mdRecvPacket (TRDP_SESSION_PT  appHandle,
-                                       SOCKET           mdSock,
+                                       UINT32           sockIndex,
                                        MD_ELE_T         *pElement);
 static TRDP_ERR_T   trdp_mdRecv (TRDP_SESSION_PT    appHandle,
                                  UINT32             sockIndex);
@@ -291,6 +334,288 @@ static TRDP_ERR_T trdp_mdLookupElement (MD_ELE_T                *pinitialMdEleme
     return errv;
 }
 
+/**********************************************************************************************************************/
+/** Append the reply just received to the aggregated reply set of a caller session
+ *  The set grows by doubling (few allocations for many replies) up to TRDP_MAX_MD_AGGR_SIZE.
+ *
+ *  @param[in,out]  pElement        caller session, pPacket holds the received reply
+ */
+static void trdp_mdAggregateReply (MD_ELE_T *pElement)
+{
+    const MD_HEADER_T   *pH         = &pElement->pPacket->frameHead;
+    UINT32              dataSize    = vos_ntohl(pH->datasetLength);
+    UINT32              recSize     = sizeof(TRDP_MD_REPLY_REC_T) + ((dataSize + 3u) & ~3u);
+    INT32               replyStatus = (INT32) vos_ntohl((UINT32)pH->replyStatus);
+    TRDP_MD_REPLY_REC_T *pRec;
+
+    if ((pElement->aggrFill + recSize) > pElement->aggrSize)
+    {
+        UINT32  newSize = (pElement->aggrSize == 0u) ? cMinimumMDSize : pElement->aggrSize;
+        UINT8   *pNewSet;
+
+        if ((pElement->aggrFill + recSize) > TRDP_MAX_MD_AGGR_SIZE)
+        {
+            vos_printLog(VOS_LOG_WARNING, "Aggregated reply set full, reply from %s dropped\n",
+                         vos_ipDotted(pElement->addr.srcIpAddr));
+            return;
+        }
+        while (newSize < (pElement->aggrFill + recSize))
+        {
+            newSize *= 2u;
+        }
+        if (newSize > TRDP_MAX_MD_AGGR_SIZE)
+        {
+            newSize = TRDP_MAX_MD_AGGR_SIZE;
+        }
+        pNewSet = (UINT8 *) vos_memAlloc(newSize);
+        if (pNewSet == NULL)
+        {
+            vos_printLogStr(VOS_LOG_ERROR, "trdp_mdAggregateReply - Out of memory, reply dropped\n");
+            return;
+        }
+        if (pElement->pAggrSet != NULL)
+        {
+            memcpy(pNewSet, pElement->pAggrSet, pElement->aggrFill);
+            vos_memFree(pElement->pAggrSet);
+        }
+        pElement->pAggrSet  = pNewSet;
+        pElement->aggrSize  = newSize;
+    }
+
+    pRec = (TRDP_MD_REPLY_REC_T *) (pElement->pAggrSet + pElement->aggrFill);
+    pRec->srcIpAddr = pElement->addr.srcIpAddr;
+    pRec->comId     = pElement->addr.comId;
+    pRec->seqCount  = vos_ntohl(pH->sequenceCounter);
+    pRec->msgType   = (TRDP_MSG_T) vos_ntohs(pH->msgType);
+    if (replyStatus >= 0)
+    {
+        pRec->userStatus    = (UINT16) replyStatus;
+        pRec->replyStatus   = TRDP_REPLY_OK;
+    }
+    else
+    {
+        pRec->userStatus    = 0u;
+        pRec->replyStatus   = (TRDP_REPLY_STATUS_T) replyStatus;
+    }
+    pRec->dataSize = dataSize;
+    memcpy(pRec + 1, pElement->pPacket->data, dataSize);
+
+    pElement->aggrFill += recSize;
+}
+
+/**********************************************************************************************************************/
+/** Hash a sessionID for the duplicate detection table
+ *
+ *  @param[in]      pSessionId      UUID of the session
+ *  @retval         hash value (FNV-1a)
+ */
+static UINT32 trdp_mdDupHash (const UINT8 *pSessionId)
+{
+    UINT32  hash = 2166136261u;
+    UINT32  i;
+
+    for (i = 0u; i < TRDP_SESS_ID_SIZE; i++)
+    {
+        hash    ^= pSessionId[i];
+        hash    *= 16777619u;
+    }
+    return hash;
+}
+
+/**********************************************************************************************************************/
+/** Find the replier session of a sessionID in the duplicate detection table
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pSessionId      UUID of the received request
+ *  @retval         pointer to the table entry, NULL if there is no such replier session
+ */
+static TRDP_MD_DUP_ENTRY_T *trdp_mdDupLookup (TRDP_SESSION_PT appHandle, const UINT8 *pSessionId)
+{
+    UINT32 mask;
+    UINT32 idx;
+
+    if (appHandle->pMDDupTable == NULL)
+    {
+        return NULL;
+    }
+
+    mask = appHandle->mdDupTableSize - 1u;
+    for (idx = trdp_mdDupHash(pSessionId) & mask;
+         appHandle->pMDDupTable[idx].pSession != NULL;
+         idx = (idx + 1u) & mask)
+    {
+        if (memcmp(appHandle->pMDDupTable[idx].sessionID, pSessionId, TRDP_SESS_ID_SIZE) == 0)
+        {
+            return &appHandle->pMDDupTable[idx];
+        }
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/** Enter a new replier session into the duplicate detection table
+ *
+ *  The table is kept at most half full, it is doubled if needed. Its size is bound by the maximum number of
+ *  replier sessions (mdDefault.maxNumSessions). A session with the same sessionID replaces the former one.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pSession        the new replier session
+ *  @param[in]      seqCnt          sequence counter of the request (host order)
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory
+ */
+static TRDP_ERR_T trdp_mdDupInsert (TRDP_SESSION_PT appHandle, MD_ELE_T *pSession, UINT32 seqCnt)
+{
+    TRDP_MD_DUP_ENTRY_T *pEntry = trdp_mdDupLookup(appHandle, pSession->sessionID);
+    UINT32              mask;
+    UINT32              idx;
+
+    if (pEntry == NULL)
+    {
+        if (((appHandle->mdDupCount + 1u) * 2u) > appHandle->mdDupTableSize)
+        {
+            TRDP_MD_DUP_ENTRY_T *pOldTable  = appHandle->pMDDupTable;
+            UINT32              oldSize     = appHandle->mdDupTableSize;
+            UINT32              newSize     = (oldSize == 0u) ? cMDDupMinTableSize : (oldSize * 2u);
+            TRDP_MD_DUP_ENTRY_T *pNewTable  = (TRDP_MD_DUP_ENTRY_T *) vos_memAlloc(
+                    newSize * sizeof(TRDP_MD_DUP_ENTRY_T));
+
+            if (pNewTable == NULL)
+            {
+                return TRDP_MEM_ERR;
+            }
+
+            /* rehash the used slots */
+            mask = newSize - 1u;
+            for (idx = 0u; idx < oldSize; idx++)
+            {
+                if (pOldTable[idx].pSession != NULL)
+                {
+                    UINT32 newIdx = trdp_mdDupHash(pOldTable[idx].sessionID) & mask;
+
+                    while (pNewTable[newIdx].pSession != NULL)
+                    {
+                        newIdx = (newIdx + 1u) & mask;
+                    }
+                    pNewTable[newIdx] = pOldTable[idx];
+                }
+            }
+            if (pOldTable != NULL)
+            {
+                vos_memFree(pOldTable);
+            }
+            appHandle->pMDDupTable      = pNewTable;
+            appHandle->mdDupTableSize   = newSize;
+        }
+
+        mask = appHandle->mdDupTableSize - 1u;
+        for (idx = trdp_mdDupHash(pSession->sessionID) & mask;
+             appHandle->pMDDupTable[idx].pSession != NULL;
+             idx = (idx + 1u) & mask)
+        {
+            ;
+        }
+        pEntry = &appHandle->pMDDupTable[idx];
+        memcpy(pEntry->sessionID, pSession->sessionID, TRDP_SESS_ID_SIZE);
+        appHandle->mdDupCount++;
+    }
+
+    pEntry->pSession    = pSession;
+    pEntry->lastSeqCnt  = seqCnt;
+    pEntry->seqWindow   = 1u;
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Remove a replier session from the duplicate detection table
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pSession        the replier session to be freed
+ */
+static void trdp_mdDupRemove (TRDP_SESSION_PT appHandle, const MD_ELE_T *pSession)
+{
+    TRDP_MD_DUP_ENTRY_T *pEntry = trdp_mdDupLookup(appHandle, pSession->sessionID);
+    UINT32              mask;
+    UINT32              hole;
+    UINT32              idx;
+
+    /* the slot may already belong to a newer session with the same sessionID */
+    if ((pEntry == NULL) || (pEntry->pSession != pSession))
+    {
+        return;
+    }
+
+    mask    = appHandle->mdDupTableSize - 1u;
+    hole    = (UINT32) (pEntry - appHandle->pMDDupTable);
+    appHandle->pMDDupTable[hole].pSession = NULL;
+    appHandle->mdDupCount--;
+
+    /* close the gap: move back following entries which would not be found anymore (linear probing) */
+    for (idx = (hole + 1u) & mask; appHandle->pMDDupTable[idx].pSession != NULL; idx = (idx + 1u) & mask)
+    {
+        UINT32 home = trdp_mdDupHash(appHandle->pMDDupTable[idx].sessionID) & mask;
+
+        if (((idx - home) & mask) >= ((idx - hole) & mask))
+        {
+            appHandle->pMDDupTable[hole]            = appHandle->pMDDupTable[idx];
+            appHandle->pMDDupTable[idx].pSession    = NULL;
+            hole = idx;
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/** Check and record the sequence counter of a request for an existing replier session
+ *
+ *  The last cMDDupWindowSize sequence counters are remembered; older ones are treated as received.
+ *
+ *  @param[in,out]  pEntry          duplicate table entry of the session
+ *  @param[in]      seqCnt          sequence counter of the request (host order)
+ *  @retval         TRUE            this sequence counter has been received before
+ *  @retval         FALSE           new sequence counter
+ */
+static BOOL8 trdp_mdDupSeqReceived (TRDP_MD_DUP_ENTRY_T *pEntry, UINT32 seqCnt)
+{
+    UINT32 diff = pEntry->lastSeqCnt - seqCnt;
+
+    if (diff == 0u)
+    {
+        return TRUE;
+    }
+    if (diff < 0x80000000u)
+    {
+        /* older than the last one */
+        if ((diff >= cMDDupWindowSize) || ((pEntry->seqWindow & (1u << diff)) != 0u))
+        {
+            return TRUE;
+        }
+        pEntry->seqWindow |= (1u << diff);
+        return FALSE;
+    }
+
+    /* newer: slide the window */
+    diff = seqCnt - pEntry->lastSeqCnt;
+    pEntry->seqWindow   = (diff >= cMDDupWindowSize) ? 1u : ((pEntry->seqWindow << diff) | 1u);
+    pEntry->lastSeqCnt  = seqCnt;
+    return FALSE;
+}
+
+/**********************************************************************************************************************/
+/** Release the duplicate detection table
+ *
+ *  @param[in]      appHandle       session pointer
+ */
+void trdp_mdFreeDupTable (TRDP_SESSION_PT appHandle)
+{
+    if (appHandle->pMDDupTable != NULL)
+    {
+        vos_memFree(appHandle->pMDDupTable);
+        appHandle->pMDDupTable = NULL;
+    }
+    appHandle->mdDupTableSize   = 0u;
+    appHandle->mdDupCount       = 0u;
+}
+
 /**********************************************************************************************************************/
 /** Handle and manage the time out and communication state of a given MD_ELE_T
  *
@@ -305,6 +630,7 @@ static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
 {
     INT32 replyStatus = 0;
     TRDP_MD_INFO_T theMessage = cTrdp_md_info_default;
+    TRDP_TRACE_DECL(traceStart)
 
     if (pMdItem == NULL)
     {
@@ -351,7 +677,23 @@ static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
     /* theMessage.pUserRef     = appHandle->mdDefault.pRefCon; */
     theMessage.resultCode = resultCode;
 
-    if ((resultCode == TRDP_NO_ERR) && (pMdItem->pPacket != NULL))
+    TRDP_TRACE_START(traceStart);
+
+    if (pMdItem->pAggrSet != NULL)
+    {
+        /* aggregated replies: the complete set at once, also on timeout */
+        theMessage.comId        = pMdItem->addr.comId;
+        theMessage.etbTopoCnt   = pMdItem->addr.etbTopoCnt;
+        theMessage.opTrnTopoCnt = pMdItem->addr.opTrnTopoCnt;
+        theMessage.srcIpAddr    = 0u;
+        pMdItem->pfCbFunction(
+            appHandle->mdDefault.pRefCon,
+            appHandle,
+            &theMessage,
+            pMdItem->pAggrSet,
+            pMdItem->aggrFill);
+    }
+    else if ((resultCode == TRDP_NO_ERR) && (pMdItem->pPacket != NULL))
     {
         theMessage.comId        = vos_ntohl(pMdItem->pPacket->frameHead.comId);
         theMessage.etbTopoCnt   = vos_ntohl(pMdItem->pPacket->frameHead.etbTopoCnt);
@@ -378,6 +720,8 @@ static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
             (UINT8 *)NULL,
             0u);
     }
+    TRDP_TRACE_SPAN(appHandle, TRDP_TRACE_MD_CALLBACK, theMessage.comId, theMessage.seqCount, (UINT16) resultCode,
+                    traceStart);
 }
 
 /**********************************************************************************************************************/
@@ -423,7 +767,7 @@ static BOOL8 trdp_mdTimeOutStateHandler ( MD_ELE_T *pElement, TRDP_SESSION_PT ap
                hasTimedOut          = TRUE;
                *pResult = TRDP_REPLYTO_ERR;
 
-               appHandle->stats.tcpMd.numReplyTimeout++;
+               TRDP_STATS_INC(appHandle->stats.tcpMd.numReplyTimeout);
            }
            else
            {
@@ -449,6 +793,7 @@ static BOOL8 trdp_mdTimeOutStateHandler ( MD_ELE_T *pElement, TRDP_SESSION_PT ap
                        /* this MD_ELE_T item to TRDP_ST_TX_REQUEST_ARM, for ref- */
                        /* erence check the trdp_mdSend function                  */
                        pElement->stateEle = TRDP_ST_TX_REQUEST_ARM;
+                       TRDP_TRACE_MD_NEW_STATE(appHandle, pElement);
                        /* Increment the retry counter */
                        pElement->numRetries++;
                        /* Increment sequence counter in network order of course */
@@ -471,7 +816,7 @@ static BOOL8 trdp_mdTimeOutStateHandler ( MD_ELE_T *pElement, TRDP_SESSION_PT ap
                        *pResult = TRDP_REPLYTO_ERR;
                    }
                    /* Statistics */
-                   appHandle->stats.udpMd.numReplyTimeout++;
+                   TRDP_STATS_INC(appHandle->stats.udpMd.numReplyTimeout);
                }
 
                /* Manage send Confirm if no repetition */
@@ -506,11 +851,11 @@ static BOOL8 trdp_mdTimeOutStateHandler ( MD_ELE_T *pElement, TRDP_SESSION_PT ap
            /* Statistics */
            if ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0 )
            {
-               appHandle->stats.tcpMd.numConfirmTimeout++;
+               TRDP_STATS_INC(appHandle->stats.tcpMd.numConfirmTimeout);
            }
            else
            {
-               appHandle->stats.udpMd.numConfirmTimeout++;
+               TRDP_STATS_INC(appHandle->stats.udpMd.numConfirmTimeout);
            }
            break;
        case TRDP_ST_TX_REPLY_RECEIVED:
@@ -540,6 +885,10 @@ static BOOL8 trdp_mdTimeOutStateHandler ( MD_ELE_T *pElement, TRDP_SESSION_PT ap
        default:
            break;
     }
+    if (hasTimedOut)
+    {
+        TRDP_TRACE_EVENT(appHandle, TRDP_TRACE_MD_TIMEOUT, pElement->addr.comId, 0u, (UINT16) *pResult);
+    }
     return hasTimedOut;
 }
 
@@ -602,6 +951,7 @@ static MD_ELE_T *trdp_mdHandleConfirmReply (TRDP_APP_SESSION_T appHandle, MD_HEA
             }
             /* and get the newly received data  */
             iterMD->pPacket     = appHandle->pMDRcvEle->pPacket;
+            iterMD->pSendData   = NULL;
             iterMD->dataSize    = vos_ntohl(pMdItemHeader->datasetLength);
             iterMD->grossSize   = appHandle->pMDRcvEle->grossSize;
 
@@ -625,6 +975,7 @@ static MD_ELE_T *trdp_mdHandleConfirmReply (TRDP_APP_SESSION_T appHandle, MD_HEA
                 /* set element state and indicate that the item has to be removed */
                 iterMD->stateEle    = TRDP_ST_RX_CONF_RECEIVED;
                 iterMD->morituri    = TRUE;
+                TRDP_TRACE_MD_NEW_STATE(appHandle, iterMD);
                 vos_printLogStr(VOS_LOG_INFO, "Received Confirmation, session will be closed!\n");
                 break; /* exit for loop */
             }
@@ -642,6 +993,7 @@ static MD_ELE_T *trdp_mdHandleConfirmReply (TRDP_APP_SESSION_T appHandle, MD_HEA
                     iterMD->numRepliesQuery++;
 
                     iterMD->stateEle = TRDP_ST_TX_REQ_W4AP_CONFIRM;
+                    TRDP_TRACE_MD_NEW_STATE(appHandle, iterMD);
 
                     /* receive time */
                     vos_getTime(&iterMD->timeToGo);
@@ -659,6 +1011,7 @@ static MD_ELE_T *trdp_mdHandleConfirmReply (TRDP_APP_SESSION_T appHandle, MD_HEA
                 {
                     /* dedicated MP handling */
                     iterMD->stateEle = TRDP_ST_TX_REPLY_RECEIVED;
+                    TRDP_TRACE_MD_NEW_STATE(appHandle, iterMD);
                     iterMD->numReplies++;
                     /* Handle multiple replies
                      Close session now if number of expected replies reached and confirmed as far as requested
@@ -702,7 +1055,8 @@ static void trdp_mdCloseSessions (
     BOOL8           checkAllSockets)
 {
 
-    MD_ELE_T *iterMD;
+    MD_ELE_T    *iterMD;
+    MD_ELE_T    *pNextMD;
 
     /* Check all the sockets */
     if (checkAllSockets == TRUE)
@@ -718,6 +1072,7 @@ static void trdp_mdCloseSessions (
         {
             trdp_releaseSocket(appHandle->iface, iterMD->socketIdx, appHandle->mdDefault.connectTimeout,
                                FALSE, VOS_INADDR_ANY);
+            pNextMD = iterMD->pNext;
             trdp_MDqueueDelElement(&appHandle->pMDSndQueue, iterMD);
             vos_printLog(VOS_LOG_INFO, "Freeing %s MD caller session '%02x%02x%02x%02x%02x%02x%02x%02x'\n",
                          iterMD->pktFlags & TRDP_FLAGS_TCP ? "TCP" : "UDP",
@@ -725,7 +1080,7 @@ static void trdp_mdCloseSessions (
                          iterMD->sessionID[4], iterMD->sessionID[5], iterMD->sessionID[6], iterMD->sessionID[7])
 
             trdp_mdFreeSession(iterMD);
-            iterMD = appHandle->pMDSndQueue;
+            iterMD = pNextMD;
         }
         else
         {
@@ -744,13 +1099,16 @@ static void trdp_mdCloseSessions (
                 trdp_releaseSocket(appHandle->iface, iterMD->socketIdx, appHandle->mdDefault.connectTimeout,
                                    FALSE, VOS_INADDR_ANY);
             }
+            pNextMD = iterMD->pNext;
             trdp_MDqueueDelElement(&appHandle->pMDRcvQueue, iterMD);
+            trdp_mdDupRemove(appHandle, iterMD);
+            appHandle->numMDRcvSessions--;
             vos_printLog(VOS_LOG_INFO, "Freeing MD %s replier session '%02x%02x%02x%02x%02x%02x%02x%02x'\n",
                          iterMD->pktFlags & TRDP_FLAGS_TCP ? "TCP" : "UDP",
                          iterMD->sessionID[0], iterMD->sessionID[1], iterMD->sessionID[2], iterMD->sessionID[3],
                          iterMD->sessionID[4], iterMD->sessionID[5], iterMD->sessionID[6], iterMD->sessionID[7])
             trdp_mdFreeSession(iterMD);
-            iterMD = appHandle->pMDRcvQueue;
+            iterMD = pNextMD;
         }
         else
         {
@@ -765,6 +1123,7 @@ static void trdp_mdCloseSessions (
         vos_printLog(VOS_LOG_INFO,
                      "Replacing the old socket by the new one (New Socket: %d, Index: %d)\n",
                      (int) newSocket, (int) socketIndex);
+        trdp_freeTCPRcvBuffer(appHandle, socketIndex);
 
         appHandle->iface[socketIndex].sock = newSocket;
         appHandle->iface[socketIndex].rcvMostly = TRUE;
@@ -958,6 +1317,65 @@ static void    trdp_mdUpdatePacket (MD_ELE_T *pElement)
     *hFCS = MAKE_LE(myCRC);
 }
 
+/**********************************************************************************************************************/
+/** Check if the caller's data can be sent in place instead of being copied into the packet
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pktFlags        flags of the sender element
+ *  @param[in]      pData           caller's data
+ *  @retval         TRUE            send header and data as separate buffers
+ */
+static BOOL8 trdp_mdSendInPlace (TRDP_SESSION_PT appHandle, TRDP_FLAGS_T pktFlags, const UINT8 *pData)
+{
+    if ((pData == NULL) || ((pktFlags & TRDP_FLAGS_NOCOPY) == 0))
+    {
+        return FALSE;
+    }
+    /* marshalled data needs the packet buffer anyway */
+    if (((pktFlags & TRDP_FLAGS_MARSHALL) != 0) && (appHandle->marshall.pfCbMarshall != NULL))
+    {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Describe a packet with in place data as header, data and padding buffers
+ *
+ *  @param[in]      pElement        element to be sent
+ *  @param[in]      offset          number of bytes already sent (TCP)
+ *  @param[out]     iov             buffer array, at least 3 entries
+ *  @retval         number of buffers to send
+ */
+static UINT32 trdp_mdSetupIov (const MD_ELE_T *pElement, UINT32 offset, VOS_IOVEC_T iov[])
+{
+    UINT32  iovCnt = 0u;
+    UINT32  i;
+
+    iov[0].pBuffer  = (const UINT8 *) &pElement->pPacket->frameHead;
+    iov[0].size     = sizeof(MD_HEADER_T);
+    iov[1].pBuffer  = pElement->pSendData;
+    iov[1].size     = pElement->dataSize;
+    iov[2].pBuffer  = cPadding;
+    iov[2].size     = pElement->grossSize - sizeof(MD_HEADER_T) - pElement->dataSize;
+
+    for (i = 0u; i < 3u; i++)
+    {
+        if (offset >= iov[i].size)
+        {
+            offset -= iov[i].size;
+        }
+        else
+        {
+            iov[iovCnt].pBuffer = iov[i].pBuffer + offset;
+            iov[iovCnt].size    = iov[i].size - offset;
+            offset = 0u;
+            iovCnt++;
+        }
+    }
+    return iovCnt;
+}
+
 /**********************************************************************************************************************/
 /** Send MD packet
  *
@@ -973,7 +1391,27 @@ static TRDP_ERR_T  trdp_mdSendPacket (SOCKET    mdSock,
     VOS_ERR_T   err         = VOS_NO_ERR;
     UINT32      tmpSndSize  = 0u;
 
-    if ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0)
+    if (pElement->pSendData != NULL)
+    {
+        /* Header, caller's data and padding are gathered by the socket layer */
+        VOS_IOVEC_T iov[3];
+        UINT32      iovCnt;
+
+        if ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0)
+        {
+            tmpSndSize  = pElement->sendSize;
+            iovCnt      = trdp_mdSetupIov(pElement, tmpSndSize, iov);
+
+            err = vos_sockSendTCPv(mdSock, iov, iovCnt, &pElement->sendSize);
+            pElement->sendSize = tmpSndSize + pElement->sendSize;
+        }
+        else
+        {
+            iovCnt  = trdp_mdSetupIov(pElement, 0u, iov);
+            err     = vos_sockSendUDPv(mdSock, iov, iovCnt, &pElement->sendSize, pElement->addr.destIpAddr, port);
+        }
+    }
+    else if ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0)
     {
         tmpSndSize = pElement->sendSize;
 
@@ -993,6 +1431,15 @@ static TRDP_ERR_T  trdp_mdSendPacket (SOCKET    mdSock,
                               port);
     }
 
+    if ((err == VOS_BLOCK_ERR) && ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0))
+    {
+        /* Connection not yet established or send buffer full: the remainder is sent later,
+           other sessions on this connection wait until the message is complete */
+        vos_printLog(VOS_LOG_INFO, "vos_sockSendTCP would block (Socket: %d, %u of %u bytes sent)\n",
+                     (int) mdSock, (unsigned int) pElement->sendSize, (unsigned int) pElement->grossSize);
+        return TRDP_IO_ERR;
+    }
+
     if (err != VOS_NO_ERR)
     {
         vos_printLog(VOS_LOG_ERROR, "vos_sockSend%s error (Err: %d, Socket: %d, Port: %u)\n",
@@ -1024,307 +1471,188 @@ static TRDP_ERR_T  trdp_mdSendPacket (SOCKET    mdSock,
 
 
 /**********************************************************************************************************************/
-/** Receive MD packet transmitted via TCP
+/** Get the size of the frame at the start of a TCP stream buffer
  *
  *  @param[in]      appHandle       session pointer
- *  @param[in]      mdSock          socket descriptor
- *  @param[out]     pElement        pointer to received packet
- *  @retval         != TRDP_NO_ERR  error
+ *  @param[in]      pBuf            stream buffer of the connection
+ *  @param[out]     pFrameSize      size of the frame on the wire, 0 if the header is not complete yet
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         != TRDP_NO_ERR  header check failed, the stream is out of sync
  */
-static TRDP_ERR_T trdp_mdRecvTCPPacket (TRDP_SESSION_PT appHandle, SOCKET mdSock, MD_ELE_T *pElement)
+static TRDP_ERR_T trdp_mdTCPFrameSize (TRDP_SESSION_PT          appHandle,
+                                       const TRDP_TCP_RCV_BUF_T *pBuf,
+                                       UINT32                   *pFrameSize)
 {
-    /* TCP receiver */
     TRDP_ERR_T  err = TRDP_NO_ERR;
-    UINT32      size = 0u;                       /* Size of the all data read until now */
-    UINT32      dataSize        = 0u;            /* The pending data to read */
-    UINT32      socketIndex     = 0u;
-    UINT32      readSize        = 0u;            /* All the data read in this cycle (Header + Data) */
-    UINT32      readDataSize    = 0u;            /* All the data part read in this cycle (Data) */
-    BOOL8       noDataToRead    = FALSE;
-    UINT32      storedDataSize  = 0u;
-
-    /* Initialize to 0 the stored header size*/
-    UINT32      storedHeader = 0;
-
-    /* Initialize to 0 the pElement->dataSize
-     * Once it is known, the message complete data size will be saved*/
-    pElement->dataSize = 0u;
+    MD_HEADER_T *pH = (MD_HEADER_T *) pBuf->pBuffer;
 
-    /* Fill destination address */
-    pElement->addr.destIpAddr = appHandle->realIP;
+    *pFrameSize = 0u;
 
-    /* Find the socket index */
-    for ( socketIndex = 0u; socketIndex < (UINT32)trdp_getCurrentMaxSocketCnt(); socketIndex++ )
+    if (pBuf->fill >= sizeof(MD_HEADER_T))
     {
-        if ( appHandle->iface[socketIndex].sock == mdSock )
+        err = trdp_mdCheck(appHandle, pH, sizeof(MD_HEADER_T), CHECK_HEADER_ONLY);
+        if (err != TRDP_NO_ERR)
         {
-            break;
+            vos_printLogStr(VOS_LOG_INFO, "TCP MD header check failed\n");
+            return err;
         }
+        *pFrameSize = trdp_packetSizeMD(vos_ntohl(pH->datasetLength));
     }
+    return err;
+}
 
-    if ( socketIndex >= (UINT32)trdp_getCurrentMaxSocketCnt() )
-    {
-        vos_printLogStr(VOS_LOG_ERROR, "trdp_mdRecvPacket - Socket index out of range\n");
-        return TRDP_UNKNOWN_ERR;
-    }
+/**********************************************************************************************************************/
+/** Check if a complete TCP MD frame is waiting in the stream buffer of a socket
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      sockIndex       index of the socket in the socket pool
+ *  @retval         TRUE            frame can be processed without reading from the socket
+ */
+static BOOL8 trdp_mdTCPFramePending (TRDP_SESSION_PT appHandle, UINT32 sockIndex)
+{
+    const TRDP_TCP_RCV_BUF_T *pBuf = &appHandle->tcpRcvBuf[sockIndex];
 
-    /* Read Header */
-    if ((appHandle->uncompletedTCP[socketIndex] == NULL)
-        || ((appHandle->uncompletedTCP[socketIndex] != NULL)
-            && (appHandle->uncompletedTCP[socketIndex]->grossSize < sizeof(MD_HEADER_T))))
+    if ((appHandle->iface[sockIndex].sock == VOS_INVALID_SOCKET)
+        || (pBuf->sock != appHandle->iface[sockIndex].sock)
+        || (pBuf->fill < sizeof(MD_HEADER_T)))
     {
-        if ( appHandle->uncompletedTCP[socketIndex] == NULL )
-        {
-            readSize = sizeof(MD_HEADER_T);
-        }
-        else
-        {
-            /* If we have read some data before, read the rest */
-            readSize        = sizeof(MD_HEADER_T) - appHandle->uncompletedTCP[socketIndex]->grossSize;
-            storedHeader    = appHandle->uncompletedTCP[socketIndex]->grossSize;
-        }
+        return FALSE;
+    }
+    return (pBuf->fill >= trdp_packetSizeMD(vos_ntohl(((MD_HEADER_T *) pBuf->pBuffer)->datasetLength))) ? TRUE : FALSE;
+}
 
-        if ( readSize > 0u )
-        {
-            err = (TRDP_ERR_T) vos_sockReceiveTCP(mdSock,
-                                                  ((UINT8 *)&pElement->pPacket->frameHead) + storedHeader,
-                                                  &readSize);
+/**********************************************************************************************************************/
+/** Receive MD packet transmitted via TCP
+ *  TCP is a byte stream: a single read may deliver part of a frame or several pipelined frames. All available data
+ *  is read into the connection's stream buffer; one complete frame is taken from it per call. Further complete
+ *  frames stay buffered and are processed without reading from the socket again (see trdp_mdTCPFramePending).
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      sockIndex       index of the socket in the socket pool
+ *  @param[out]     pElement        pointer to received packet
+ *  @retval         TRDP_NO_ERR     complete frame copied to pElement
+ *  @retval         TRDP_PACKET_ERR incomplete frame, wait for more data
+ *  @retval         TRDP_NODATA_ERR connection closed by the other corner
+ *  @retval         != TRDP_NO_ERR  error
+ */
+static TRDP_ERR_T trdp_mdRecvTCPPacket (TRDP_SESSION_PT appHandle, UINT32 sockIndex, MD_ELE_T *pElement)
+{
+    TRDP_ERR_T          err         = TRDP_NO_ERR;
+    SOCKET              mdSock      = appHandle->iface[sockIndex].sock;
+    TRDP_TCP_RCV_BUF_T  *pBuf       = &appHandle->tcpRcvBuf[sockIndex];
+    UINT32              frameSize   = 0u;
+    UINT32              readSize    = 0u;
 
-            /* Add the read data size to the size read before */
-            size = storedHeader + readSize;
+    /* Fill destination address */
+    pElement->addr.destIpAddr = appHandle->realIP;
 
-            if ( err == TRDP_NO_ERR
-                 && (appHandle->uncompletedTCP[socketIndex] != NULL)
-                 && (size >= sizeof(MD_HEADER_T))
-                 && appHandle->uncompletedTCP[socketIndex]->pPacket != NULL )     /* BL: Prevent NULL pointer access */
-            {
-                if ( trdp_mdCheck(appHandle, &pElement->pPacket->frameHead, size, CHECK_HEADER_ONLY) == TRDP_NO_ERR )
-                {
-                    /* Uncompleted Header, completed. Save some parameters in the uncompletedTCP structure */
-                    appHandle->uncompletedTCP[socketIndex]->pPacket->frameHead.datasetLength =
-                        pElement->pPacket->frameHead.datasetLength;
-                    appHandle->uncompletedTCP[socketIndex]->pPacket->frameHead.frameCheckSum =
-                        pElement->pPacket->frameHead.frameCheckSum;
-                }
-                else
-                {
-                    vos_printLogStr(VOS_LOG_INFO, "TCP MD header check failed\n");
-                    return TRDP_NODATA_ERR;
-                }
-            }
-        }
+    /* Data of a former connection on this socket index is stale */
+    if (pBuf->sock != mdSock)
+    {
+        pBuf->sock  = mdSock;
+        pBuf->fill  = 0u;
     }
 
-    /* Read Data */
-    if ((size >= sizeof(MD_HEADER_T))
-        || ((appHandle->uncompletedTCP[socketIndex] != NULL)
-            && (appHandle->uncompletedTCP[socketIndex]->grossSize >= sizeof(MD_HEADER_T))))
+    if (pBuf->pBuffer == NULL)
     {
-        if ( appHandle->uncompletedTCP[socketIndex] == NULL || appHandle->uncompletedTCP[socketIndex]->pPacket == NULL )
-        {
-            /* Get the rest of the message length */
-            dataSize = vos_ntohl(pElement->pPacket->frameHead.datasetLength);
-
-            readDataSize        = trdp_packetSizeMD(dataSize - sizeof(MD_HEADER_T));
-            pElement->grossSize = trdp_packetSizeMD(dataSize);
-            pElement->dataSize  = dataSize;
-            dataSize = pElement->grossSize - sizeof(MD_HEADER_T);
-        }
-        else
+        pBuf->pBuffer = (UINT8 *) vos_memAlloc(cTCPRcvBufferSize);
+        if (pBuf->pBuffer == NULL)
         {
-            /* Calculate the data size that is pending to read */
-            dataSize = vos_ntohl(appHandle->uncompletedTCP[socketIndex]->pPacket->frameHead.datasetLength);
-
-            pElement->dataSize  = dataSize;
-            pElement->grossSize = trdp_packetSizeMD(dataSize);
-
-            size = appHandle->uncompletedTCP[socketIndex]->grossSize + readSize;
-            dataSize        = dataSize - (size - sizeof(MD_HEADER_T));
-            readDataSize    = dataSize; /* trdp_packetSizeMD(dataSize); */
+            vos_printLogStr(VOS_LOG_ERROR, "trdp_mdRecvTCPPacket - Out of receive buffers!\n");
+            return TRDP_MEM_ERR;
         }
+        pBuf->size = cTCPRcvBufferSize;
+    }
 
-        /* If all the Header is read, check if more memory is needed */
-        if ( size >= sizeof(MD_HEADER_T))
+    /* Read until a complete frame is buffered or the socket is drained */
+    for (;;)
+    {
+        err = trdp_mdTCPFrameSize(appHandle, pBuf, &frameSize);
+        if (err != TRDP_NO_ERR)
         {
-            if ( trdp_packetSizeMD(pElement->dataSize) > cMinimumMDSize )
+            switch (err)
             {
-                /* we have to allocate a bigger buffer */
-                MD_PACKET_T *pBigData = (MD_PACKET_T *) vos_memAlloc(trdp_packetSizeMD(pElement->dataSize));
-                if ( pBigData == NULL )
-                {
-                    return TRDP_MEM_ERR;
-                }
-                /*  Swap the pointers ...  */
-                memcpy(((UINT8 *)&pBigData->frameHead) + storedHeader,
-                       ((UINT8 *)&pElement->pPacket->frameHead) + storedHeader,
-                       readSize);
-
-                vos_memFree(pElement->pPacket);
-                pElement->pPacket = pBigData;
+               case TRDP_CRC_ERR:
+                   TRDP_STATS_INC(appHandle->stats.tcpMd.numCrcErr);
+                   break;
+               case TRDP_TOPO_ERR:
+                   TRDP_STATS_INC(appHandle->stats.tcpMd.numTopoErr);
+                   break;
+               default:
+                   TRDP_STATS_INC(appHandle->stats.tcpMd.numProtErr);
+                   break;
             }
+            return err;
         }
 
-        if ( readDataSize > 0u )
-        {
-            err = (TRDP_ERR_T) vos_sockReceiveTCP(mdSock,
-                                                  ((UINT8 *)&pElement->pPacket->frameHead) + size,
-                                                  &readDataSize);
-
-            /* Add the read data size */
-            size = size + readDataSize;
-
-            /* Add the read Data size to the size read during this cycle */
-            readSize = readSize + readDataSize;
-        }
-    }
-    pElement->grossSize = size;
-
-    /* If the Header is incomplete, the data size will be "0". Otherwise it will be calculated. */
-    switch ( err )
-    {
-       case TRDP_NODATA_ERR:
-           vos_printLog(VOS_LOG_INFO, "vos_sockReceiveTCP - No data at socket %d\n", (int) mdSock);
-           return TRDP_NODATA_ERR;
-       case TRDP_BLOCK_ERR:
-           if (((pElement->pktFlags & TRDP_FLAGS_TCP) != 0) && (readSize == 0u))
-           {
-               return TRDP_BLOCK_ERR;
-           }
-           break;
-       case TRDP_NO_ERR:
-           break;
-       default:
-           vos_printLog(VOS_LOG_ERROR, "vos_sockReceiveTCP failed (Err: %d, Socket: %d)\n", err, (int) mdSock);
-           return err;
-    }
-    /* All the data (Header + Data) stored in the uncompletedTCP[] array */
-    /* Check if it's necessary to read some data */
-    if ( pElement->grossSize == sizeof(MD_HEADER_T))
-    {
-        if ( dataSize == 0u )
+        if ((frameSize > 0u) && (pBuf->fill >= frameSize))
         {
-            noDataToRead = TRUE;
+            break;
         }
-    }
-
-    /* Compare if all the data has been read */
-    if (((pElement->grossSize < sizeof(MD_HEADER_T)) && (readDataSize == 0u))
-        ||
-        ((noDataToRead == FALSE) && (readDataSize != dataSize)))
-    {
-        /* Uncompleted message received */
 
-        if ( appHandle->uncompletedTCP[socketIndex] == NULL )
+        if (frameSize > pBuf->size)
         {
-            /* It is the first loop, no data stored yet. Allocate memory for the message */
-            appHandle->uncompletedTCP[socketIndex] = (MD_ELE_T *) vos_memAlloc(sizeof(MD_ELE_T));
-
-            if ( appHandle->uncompletedTCP[socketIndex] == NULL )
-            {
-                /* vos_memDelete(NULL); */
-                vos_printLogStr(VOS_LOG_ERROR, "vos_memAlloc() failed\n");
-                return TRDP_MEM_ERR;
-            }
-
-            /* Check the memory that is needed */
-            if ( trdp_packetSizeMD(pElement->dataSize) < cMinimumMDSize )
-            {
-                /* Allocate the cMinimumMDSize memory at least for now*/
-                appHandle->uncompletedTCP[socketIndex]->pPacket = (MD_PACKET_T *) vos_memAlloc(cMinimumMDSize);
-            }
-            else
-            {
-                /* Allocate the dataSize memory */
-                /* we have to allocate a bigger buffer */
-                appHandle->uncompletedTCP[socketIndex]->pPacket =
-                    (MD_PACKET_T *) vos_memAlloc(trdp_packetSizeMD(pElement->dataSize));
-            }
-
-            if ( appHandle->uncompletedTCP[socketIndex]->pPacket == NULL )
+            /* we have to allocate a bigger buffer */
+            UINT8 *pBigData = (UINT8 *) vos_memAlloc(frameSize);
+            if (pBigData == NULL)
             {
                 return TRDP_MEM_ERR;
             }
-
-            storedDataSize = 0;
+            memcpy(pBigData, pBuf->pBuffer, pBuf->fill);
+            vos_memFree(pBuf->pBuffer);
+            pBuf->pBuffer   = pBigData;
+            pBuf->size      = frameSize;
         }
-        else
-        {
-            /* Get the size that have been already stored in the uncompletedTCP[] */
-            storedDataSize = appHandle->uncompletedTCP[socketIndex]->grossSize;
-
-            if ((storedDataSize < sizeof(MD_HEADER_T))
-                && (pElement->grossSize > sizeof(MD_HEADER_T)))
-            {
-                if ( trdp_packetSizeMD(pElement->dataSize) > cMinimumMDSize )
-                {
-                    /* we have to allocate a bigger buffer */
-                    MD_PACKET_T *pBigData = (MD_PACKET_T *) vos_memAlloc(trdp_packetSizeMD(pElement->dataSize));
-                    if ( pBigData == NULL )
-                    {
-                        return TRDP_MEM_ERR;
-                    }
-
-                    /* Copy the data to the pBigData->frameHead */
-                    memcpy(((UINT8 *)&pBigData->frameHead),
-                           ((UINT8 *)&pElement->pPacket->frameHead),
-                           storedDataSize);
 
-                    /*  Swap the pointers ...  */
-                    vos_memFree(appHandle->uncompletedTCP[socketIndex]->pPacket);
-                    appHandle->uncompletedTCP[socketIndex]->pPacket = pBigData;
-                }
-            }
-        }
+        readSize    = pBuf->size - pBuf->fill;
+        err         = (TRDP_ERR_T) vos_sockReceiveTCP(mdSock, pBuf->pBuffer + pBuf->fill, &readSize);
+        pBuf->fill += readSize;
 
-        if ( readSize > 0u )
+        switch (err)
         {
-            /* Copy the read data in the uncompletedTCP[] */
-            memcpy(((UINT8 *)&appHandle->uncompletedTCP[socketIndex]->pPacket->frameHead) + storedDataSize,
-                   ((UINT8 *)&pElement->pPacket->frameHead) + storedDataSize, readSize);
-            appHandle->uncompletedTCP[socketIndex]->grossSize   = pElement->grossSize;
-            appHandle->uncompletedTCP[socketIndex]->dataSize    = readDataSize;
+           case TRDP_NODATA_ERR:
+               vos_printLog(VOS_LOG_INFO, "vos_sockReceiveTCP - No data at socket %d\n", (int) mdSock);
+               return TRDP_NODATA_ERR;
+           case TRDP_BLOCK_ERR:
+               /* Socket drained without completing a frame */
+               return (pBuf->fill == 0u) ? TRDP_BLOCK_ERR : TRDP_PACKET_ERR;
+           case TRDP_NO_ERR:
+               break;
+           default:
+               vos_printLog(VOS_LOG_ERROR, "vos_sockReceiveTCP failed (Err: %d, Socket: %d)\n", err, (int) mdSock);
+               return err;
         }
-        else
+    }
+
+    /* Hand the frame over to the element */
+    if (frameSize > cMinimumMDSize)
+    {
+        /* we have to allocate a bigger buffer */
+        MD_PACKET_T *pBigData = (MD_PACKET_T *) vos_memAlloc(frameSize);
+        if (pBigData == NULL)
         {
-            vos_printLog(VOS_LOG_DBG, "Received TCP - readSize = 0 (Socket: %d)\n", (int) mdSock);
-            return TRDP_PARAM_ERR;
+            return TRDP_MEM_ERR;
         }
+        /*  Swap the pointers ...  */
+        vos_memFree(pElement->pPacket);
+        pElement->pPacket = pBigData;
+    }
+    memcpy(pElement->pPacket, pBuf->pBuffer, frameSize);
+    pElement->dataSize  = vos_ntohl(pElement->pPacket->frameHead.datasetLength);
+    pElement->grossSize = frameSize;
 
-        return TRDP_PACKET_ERR;
+    /* Keep the remainder (start of the next frame) at the buffer start */
+    pBuf->fill -= frameSize;
+    if (pBuf->fill > 0u)
+    {
+        memmove(pBuf->pBuffer, pBuf->pBuffer + frameSize, pBuf->fill);
     }
-    else
+    else if (pBuf->size > cTCPRcvBufferSize)
     {
-        /* Complete message */
-        /* All data is read. Save all the data and copy to the pElement to continue */
-        if ( appHandle->uncompletedTCP[socketIndex] != NULL )
-        {
-            /* Add the received information and copy all the data to the pElement */
-            storedDataSize = appHandle->uncompletedTCP[socketIndex]->grossSize;
-
-            if ((readSize > 0u) &&
-                appHandle->uncompletedTCP[socketIndex]->pPacket != NULL )
-            {
-                /* Copy the read data in the uncompletedTCP[] */
-                memcpy(((UINT8 *)&appHandle->uncompletedTCP[socketIndex]->pPacket->frameHead) + storedDataSize,
-                       ((UINT8 *)&pElement->pPacket->frameHead) + storedDataSize, readSize);
-
-                /* Copy all the uncompletedTCP data to the pElement */
-                memcpy(((UINT8 *)&pElement->pPacket->frameHead),
-                       ((UINT8 *)&appHandle->uncompletedTCP[socketIndex]->pPacket->frameHead), pElement->grossSize);
-
-                /* Disallocate the memory */
-                /* 1st free data buffer - independant pointer */
-                vos_memFree(appHandle->uncompletedTCP[socketIndex]->pPacket);
-                /* 2nd free socket element */
-                vos_memFree(appHandle->uncompletedTCP[socketIndex]);
-                appHandle->uncompletedTCP[socketIndex] = NULL;
-            }
-            else
-            {
-                vos_printLog(VOS_LOG_DBG, "vos_sockReceiveTCP - readSize = 0 (Socket: %d)\n", (int) mdSock);
-                return TRDP_PARAM_ERR;
-            }
-        }
+        /* Do not hold a big buffer longer than needed */
+        vos_memFree(pBuf->pBuffer);
+        pBuf->pBuffer   = NULL;
+        pBuf->size      = 0u;
     }
     return TRDP_NO_ERR;
 }
@@ -1437,14 +1765,14 @@ static TRDP_ERR_T trdp_mdRecvUDPPacket (TRDP_SESSION_PT appHandle, SOCKET mdSock
 /** Receive MD packet
  *
  *  @param[in]      appHandle       session pointer
- *  @param[in]      mdSock          socket descriptor
+ *  @param[in]      sockIndex       index of the socket in the socket pool
  *  @param[in]      pElement        pointer to received packet
  *
  *  @retval         != TRDP_NO_ERR  error
  */
 static TRDP_ERR_T  trdp_mdRecvPacket (
     TRDP_SESSION_PT appHandle,
-    SOCKET          mdSock,
+    UINT32          sockIndex,
     MD_ELE_T        *pElement)
 {
     TRDP_MD_STATISTICS_T *pElementStatistics;
@@ -1454,7 +1782,7 @@ static TRDP_ERR_T  trdp_mdRecvPacket (
     if ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0)
     {
         /* Call TCP receiver function */
-        err = trdp_mdRecvTCPPacket(appHandle, mdSock, pElement);
+        err = trdp_mdRecvTCPPacket(appHandle, sockIndex, pElement);
         if (err != TRDP_NO_ERR)
         {
             /* fatal communication issue, exit function */
@@ -1467,7 +1795,7 @@ static TRDP_ERR_T  trdp_mdRecvPacket (
     else
     {
         /* Call UDP receiver function */
-        err = trdp_mdRecvUDPPacket(appHandle, mdSock, pElement);
+        err = trdp_mdRecvUDPPacket(appHandle, appHandle->iface[sockIndex].sock, pElement);
         if (err != TRDP_NO_ERR)
         {
             /* fatal communication issue, exit function */
@@ -1485,16 +1813,16 @@ static TRDP_ERR_T  trdp_mdRecvPacket (
     switch (err)
     {
        case TRDP_NO_ERR:
-           pElementStatistics->numRcv++;
+           TRDP_STATS_INC(pElementStatistics->numRcv);
            break;
        case TRDP_CRC_ERR:
-           pElementStatistics->numCrcErr++;
+           TRDP_STATS_INC(pElementStatistics->numCrcErr);
            break;
        case TRDP_WIRE_ERR:
-           pElementStatistics->numProtErr++;
+           TRDP_STATS_INC(pElementStatistics->numProtErr);
            break;
        case TRDP_TOPO_ERR:
-           pElementStatistics->numTopoErr++;
+           TRDP_STATS_INC(pElementStatistics->numTopoErr);
            break;
        default:
            ;
@@ -1529,83 +1857,83 @@ static TRDP_ERR_T trdp_mdHandleRequest (TRDP_SESSION_PT     appHandle,
                                         TRDP_MD_ELE_ST_T    state,
                                         MD_ELE_T            * *pIterMD)
 {
-    UINT32 numOfReceivers = 0u;
-    MD_LIS_ELE_T    *iterListener   = NULL;
-    TRDP_ERR_T      result          = TRDP_NO_ERR;
-    MD_ELE_T        *iterMD         = NULL;
+    MD_LIS_ELE_T        *iterListener   = NULL;
+    TRDP_ERR_T          result          = TRDP_NO_ERR;
+    MD_ELE_T            *iterMD         = NULL;
+    TRDP_MD_DUP_ENTRY_T *pDup;
 
     /* set pointer to be returned to NULL */
     *pIterMD = NULL;
 
     /* Search for existing session (in case it is a repeated request)  */
     /* This is kind of error detection/comm issue remedy functionality */
-    /* running ahead of further logic */
-    for ( iterMD = appHandle->pMDRcvQueue; iterMD != NULL; iterMD = iterMD->pNext )
-    {
-        numOfReceivers++; /* count the list items here */
-        if ( 0 == memcmp(iterMD->pPacket->frameHead.sessionID, pH->sessionID, TRDP_SESS_ID_SIZE))
-        {
-            /* According IEC61375-2-3 A.7.7.1 */
-            /* encountered a matching session */
-            if ((pH->sequenceCounter == iterMD->pPacket->frameHead.sequenceCounter)
-                ||
-                (isTCP == TRUE) /* include TCP as topmost discard criterium */
-                ||
-                (iterMD->addr.mcGroup != 0))  /* discard multicasts anyway */
-            {
-                /* discard call immediately */
-                vos_printLogStr(VOS_LOG_INFO,
-                                "trdp_mdRecv: Repeated request discarded!\n");
-                return result;
-            }
-            else if ( iterMD->stateEle != TRDP_ST_RX_REPLYQUERY_W4C )
-            {
-                /* reply has not been sent - discard immediately */
-                vos_printLogStr(VOS_LOG_INFO, "trdp_mdRecv: Reply not sent, request discarded!\n");
-                return result;
-            }
-            else if (((pH->etbTopoCnt != 0u) || (pH->opTrnTopoCnt != 0u))
-                     && !trdp_validTopoCounters( vos_ntohl(pH->etbTopoCnt),
-                                                 vos_ntohl(pH->opTrnTopoCnt),
-                                                 iterMD->addr.etbTopoCnt,
-                                                 iterMD->addr.opTrnTopoCnt))
-            {
-                /* no local communication and there has been a change in train configuration - ignore request */
-                vos_printLog(VOS_LOG_ERROR, "Repeated request topocount error - received: %u/%u, expected: %u/%u\n",
-                             vos_ntohl(pH->etbTopoCnt), vos_ntohl(pH->opTrnTopoCnt),
-                             iterMD->addr.etbTopoCnt, iterMD->addr.opTrnTopoCnt);
-                break; /* exit lookup at this place */
-            }
-            else
-            {
-                /* criteria reched to schedule resending reply message */
-                vos_printLogStr(VOS_LOG_INFO, "trdp_mdRecv: Restart reply transmission\n");
-                /* Retransmission will occur upon resetting the state of */
-                /* this MD_ELE_T item to TRDP_ST_TX_REPLYQUERY_ARM, for  */
-                /* reference check the trdp_mdSend function              */
-                iterMD->stateEle = TRDP_ST_TX_REPLYQUERY_ARM;
-                /* Increment the retry counter */
-                iterMD->numRetries++;
-                /* Align sequence counter with the received counter. Both*/
-                /* retain network order, as pH consists out of network   */
-                /* ordered data                                          */
-                iterMD->pPacket->frameHead.sequenceCounter = pH->sequenceCounter;
-                /* Store new sequence counter within the management info */
-                /* Set new time out value */
-                vos_addTime(&iterMD->timeToGo, &iterMD->interval);
-                /* update the frame header CRC also */
-                trdp_mdUpdatePacket(iterMD);
-                /* ready to proceed - will be handled by trdp_mdSend run- */
-                /* ning within its own loop triggered cyclically.         */
-                return result;
-            }
+    /* running ahead of further logic, before any session is allocated */
+    pDup = trdp_mdDupLookup(appHandle, pH->sessionID);
+    if (pDup != NULL)
+    {
+        iterMD = pDup->pSession;
+
+        /* According IEC61375-2-3 A.7.7.1 */
+        /* encountered a matching session */
+        if ((trdp_mdDupSeqReceived(pDup, vos_ntohl(pH->sequenceCounter)) == TRUE)
+            ||
+            (isTCP == TRUE) /* include TCP as topmost discard criterium */
+            ||
+            (iterMD->addr.mcGroup != 0))  /* discard multicasts anyway */
+        {
+            /* discard call immediately */
+            vos_printLogStr(VOS_LOG_INFO,
+                            "trdp_mdRecv: Repeated request discarded!\n");
+            return result;
+        }
+        else if ( iterMD->stateEle != TRDP_ST_RX_REPLYQUERY_W4C )
+        {
+            /* reply has not been sent - discard immediately */
+            vos_printLogStr(VOS_LOG_INFO, "trdp_mdRecv: Reply not sent, request discarded!\n");
+            return result;
+        }
+        else if (((pH->etbTopoCnt != 0u) || (pH->opTrnTopoCnt != 0u))
+                 && !trdp_validTopoCounters( vos_ntohl(pH->etbTopoCnt),
+                                             vos_ntohl(pH->opTrnTopoCnt),
+                                             iterMD->addr.etbTopoCnt,
+                                             iterMD->addr.opTrnTopoCnt))
+        {
+            /* no local communication and there has been a change in train configuration - ignore request */
+            vos_printLog(VOS_LOG_ERROR, "Repeated request topocount error - received: %u/%u, expected: %u/%u\n",
+                         vos_ntohl(pH->etbTopoCnt), vos_ntohl(pH->opTrnTopoCnt),
+                         iterMD->addr.etbTopoCnt, iterMD->addr.opTrnTopoCnt);
+        }
+        else
+        {
+            /* criteria reched to schedule resending reply message */
+            vos_printLogStr(VOS_LOG_INFO, "trdp_mdRecv: Restart reply transmission\n");
+            /* Retransmission will occur upon resetting the state of */
+            /* this MD_ELE_T item to TRDP_ST_TX_REPLYQUERY_ARM, for  */
+            /* reference check the trdp_mdSend function              */
+            iterMD->stateEle = TRDP_ST_TX_REPLYQUERY_ARM;
+            TRDP_TRACE_MD_NEW_STATE(appHandle, iterMD);
+            /* Increment the retry counter */
+            iterMD->numRetries++;
+            /* Align sequence counter with the received counter. Both*/
+            /* retain network order, as pH consists out of network   */
+            /* ordered data                                          */
+            iterMD->pPacket->frameHead.sequenceCounter = pH->sequenceCounter;
+            /* Store new sequence counter within the management info */
+            /* Set new time out value */
+            vos_addTime(&iterMD->timeToGo, &iterMD->interval);
+            /* update the frame header CRC also */
+            trdp_mdUpdatePacket(iterMD);
+            /* ready to proceed - will be handled by trdp_mdSend run- */
+            /* ning within its own loop triggered cyclically.         */
+            return result;
         }
     }
     /* Inhibit MQ/MN Flooding */
-    if ( appHandle->mdDefault.maxNumSessions <= numOfReceivers )
+    if ( appHandle->mdDefault.maxNumSessions <= appHandle->numMDRcvSessions )
     {
         /* Discard MD request, we shall not be flooded by incoming requests */
-        vos_printLog(VOS_LOG_INFO, "trdp_mdRecv: Max. number of requests reached (%d)!\n", numOfReceivers);
+        vos_printLog(VOS_LOG_INFO, "trdp_mdRecv: Max. number of requests reached (%u)!\n",
+                     appHandle->numMDRcvSessions);
         /* Indicate that this call can not get replied due to receiver count limitation  */
         (void)trdp_mdSendME(appHandle, pH, TRDP_REPLY_NO_MEM_REPL);
         /* return to calling routine without performing any receiver action */
@@ -1702,6 +2030,7 @@ static TRDP_ERR_T trdp_mdHandleRequest (TRDP_SESSION_PT     appHandle,
             iterMD->addr.etbTopoCnt     = iterListener->addr.etbTopoCnt;
             iterMD->addr.opTrnTopoCnt   = iterListener->addr.opTrnTopoCnt;
             iterMD->pktFlags            = iterListener->pktFlags;           /* BL: This was missing! */
+            TRDP_TRACE_MD_NEW_STATE(appHandle, iterMD);
 
 
             /* Count this Request/Notification as new session */
@@ -1755,6 +2084,11 @@ static TRDP_ERR_T trdp_mdHandleRequest (TRDP_SESSION_PT     appHandle,
         }
         /* save session Id and sequence counter for next steps */
         memcpy(iterMD->sessionID, pH->sessionID, TRDP_SESS_ID_SIZE);
+        appHandle->numMDRcvSessions++;
+        if (trdp_mdDupInsert(appHandle, iterMD, vos_ntohl(pH->sequenceCounter)) != TRDP_NO_ERR)
+        {
+            vos_printLogStr(VOS_LOG_WARNING, "trdp_mdRecv: Out of memory, repeated requests will not be detected\n");
+        }
         /* save source URI for reply */
         vos_strncpy(iterMD->srcURI, (CHAR8 *) pH->sourceURI, TRDP_MAX_URI_USER_LEN);
     }
@@ -1763,11 +2097,11 @@ static TRDP_ERR_T trdp_mdHandleRequest (TRDP_SESSION_PT     appHandle,
         /*this should be the place to add the Me call*/
         if ( isTCP == TRUE )
         {
-            appHandle->stats.tcpMd.numNoListener++;
+            TRDP_STATS_INC(appHandle->stats.tcpMd.numNoListener);
         }
         else
         {
-            appHandle->stats.udpMd.numNoListener++;
+            TRDP_STATS_INC(appHandle->stats.udpMd.numNoListener);
         }
         vos_printLogStr(VOS_LOG_INFO, "trdp_mdRecv: No listener found!\n");
         result = TRDP_NOLIST_ERR;
@@ -1982,12 +2316,15 @@ static TRDP_ERR_T  trdp_mdRecv (
     }
 
     /* get packet: */
-    result = trdp_mdRecvPacket(appHandle, appHandle->iface[sockIndex].sock, appHandle->pMDRcvEle);
+    result = trdp_mdRecvPacket(appHandle, sockIndex, appHandle->pMDRcvEle);
 
     if (result != TRDP_NO_ERR)
     {
         return result;
     }
+    TRDP_TRACE_EVENT(appHandle, TRDP_TRACE_MD_RECEIVE, vos_ntohl(appHandle->pMDRcvEle->pPacket->frameHead.comId),
+                     vos_ntohl(appHandle->pMDRcvEle->pPacket->frameHead.sequenceCounter),
+                     vos_ntohs(appHandle->pMDRcvEle->pPacket->frameHead.msgType));
 
     /* process message */
     pH = &appHandle->pMDRcvEle->pPacket->frameHead;
@@ -2059,6 +2396,19 @@ static TRDP_ERR_T  trdp_mdRecv (
            break;
     }
 
+    /* Aggregated reply mode: collect the reply, inform the user once the session is complete  */
+    if ((NULL != iterMD)
+        && ((iterMD->pktFlags & TRDP_FLAGS_AGGREGATE) != 0)
+        && ((vos_ntohs(pH->msgType) == TRDP_MSG_MP) || (vos_ntohs(pH->msgType) == TRDP_MSG_ME)))
+    {
+        trdp_mdAggregateReply(iterMD);
+        if ((iterMD->morituri == TRUE) && (iterMD->pfCbFunction != NULL))
+        {
+            trdp_mdInvokeCallback(iterMD, appHandle, TRDP_NO_ERR);
+        }
+        return TRDP_NO_ERR;
+    }
+
     /* Inform user  */
     if (NULL != iterMD && iterMD->pfCbFunction != NULL)
     {
@@ -2156,6 +2506,10 @@ void trdp_mdFreeSession (
         {
             vos_memFree(pMDSession->pPacket);
         }
+        if (NULL != pMDSession->pAggrSet)
+        {
+            vos_memFree(pMDSession->pAggrSet);
+        }
         vos_memFree(pMDSession);
     }
 }
@@ -2173,6 +2527,7 @@ TRDP_ERR_T  trdp_mdSend (
     TRDP_ERR_T  result      = TRDP_NO_ERR;
     MD_ELE_T    *iterMD     = appHandle->pMDSndQueue;
     BOOL8       firstLoop   = TRUE;
+    TRDP_TRACE_DECL(traceStart)
 
     /*  Find the packet which has to be sent next:
      Note: We must also check the receive queue for pending replies! */
@@ -2295,6 +2650,7 @@ TRDP_ERR_T  trdp_mdSend (
                             || (iterMD->tcpParameters.msgUncomplete == TRUE))))
                 {
 
+                    TRDP_TRACE_START(traceStart);
                     if (0u != iterMD->replyPort &&
                         (iterMD->pPacket->frameHead.msgType == vos_ntohs(TRDP_MSG_MP) ||
                          iterMD->pPacket->frameHead.msgType == vos_ntohs(TRDP_MSG_MQ)))
@@ -2312,6 +2668,9 @@ TRDP_ERR_T  trdp_mdSend (
 
                     if (result == TRDP_NO_ERR)
                     {
+                        TRDP_TRACE_SPAN(appHandle, TRDP_TRACE_MD_SEND, iterMD->addr.comId,
+                                        vos_ntohl(iterMD->pPacket->frameHead.sequenceCounter),
+                                        vos_ntohs(iterMD->pPacket->frameHead.msgType), traceStart);
                         if ((iterMD->pktFlags & TRDP_FLAGS_TCP) != 0)
                         {
                             appHandle->iface[iterMD->socketIdx].tcpParams.notSend = FALSE;
@@ -2321,12 +2680,12 @@ TRDP_ERR_T  trdp_mdSend (
                             /* Add the socket in the file descriptor*/
                             appHandle->iface[iterMD->socketIdx].tcpParams.addFileDesc = TRUE;
                             /* increment transmission counter for TCP */
-                            appHandle->stats.tcpMd.numSend++;
+                            TRDP_STATS_INC(appHandle->stats.tcpMd.numSend);
                         }
                         else
                         {
                             /* increment transmission counter for UDP */
-                            appHandle->stats.udpMd.numSend++;
+                            TRDP_STATS_INC(appHandle->stats.udpMd.numSend);
                         }
 
                         if (nextstate == TRDP_ST_RX_REPLYQUERY_W4C)
@@ -2377,6 +2736,7 @@ TRDP_ERR_T  trdp_mdSend (
                                ;
                         }
                         iterMD->stateEle = nextstate;
+                        TRDP_TRACE_MD_NEW_STATE(appHandle, iterMD);
                     }
                     else
                     {
@@ -2444,8 +2804,48 @@ TRDP_ERR_T  trdp_mdSend (
 }
 
 
+/**********************************************************************************************************************/
+/** Merge the time-out of an MD session into the next job of the session (ns)
+ *  Only states handled by trdp_mdTimeOutStateHandler are taken, any other state would keep a passed
+ *  time-out and make every select() return at once.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pElement            MD session to check
+ */
+static void trdp_mdNextJob (
+    TRDP_SESSION_PT appHandle,
+    const MD_ELE_T  *pElement)
+{
+    VOS_TIME_NS_T timeToGo;
+
+    if ((pElement->morituri == TRUE) ||
+        ((pElement->interval.tv_sec == TRDP_MD_INFINITE_TIME) &&
+         (pElement->interval.tv_usec == TRDP_MD_INFINITE_USEC_TIME)))
+    {
+        return;
+    }
+
+    switch (pElement->stateEle)
+    {
+       case TRDP_ST_RX_REQ_W4AP_REPLY:
+       case TRDP_ST_TX_REQ_W4AP_CONFIRM:
+       case TRDP_ST_TX_REQUEST_W4REPLY:
+       case TRDP_ST_RX_REPLYQUERY_W4C:
+       case TRDP_ST_TX_REPLY_RECEIVED:
+           timeToGo = VOS_NS_FROM_TIMEVAL(&pElement->timeToGo);
+           if ((appHandle->nextJob == 0u) || (timeToGo < appHandle->nextJob))
+           {
+               appHandle->nextJob = timeToGo;
+           }
+           break;
+       default:
+           break;
+    }
+}
+
 /******************************************************************************/
 /** Check for pending packets, set FD if non blocking
+ *  The time-outs of the MD sessions are merged into the next job of the session.
  *
  *  @param[in]      appHandle           session pointer
  *  @param[in,out]  pFileDesc           pointer to set of ready descriptors
@@ -2519,6 +2919,8 @@ void trdp_mdCheckPending (
     /*  Include MD UDP receive sockets */
     for (iterMD = appHandle->pMDRcvQueue; iterMD != NULL; iterMD = iterMD->pNext)
     {
+        trdp_mdNextJob(appHandle, iterMD);
+
         /*    There can be several sockets depending on TRDP_PD_CONFIG_T    */
         if ((iterMD->socketIdx != TRDP_INVALID_SOCKET_INDEX)
             && (appHandle->iface[iterMD->socketIdx].sock != VOS_INVALID_SOCKET)
@@ -2543,6 +2945,8 @@ void trdp_mdCheckPending (
 
     for (iterMD = appHandle->pMDSndQueue; iterMD != NULL; iterMD = iterMD->pNext)
     {
+        trdp_mdNextJob(appHandle, iterMD);
+
         /*    There can be several sockets depending on TRDP_PD_CONFIG_T    */
         if ((iterMD->socketIdx != TRDP_INVALID_SOCKET_INDEX)
             && (appHandle->iface[iterMD->socketIdx].sock != VOS_INVALID_SOCKET)
@@ -2846,6 +3250,17 @@ void  trdp_mdCheckListenSocks (
 
             if (appHandle->iface[lIndex].type == TRDP_SOCK_MD_TCP)
             {
+                /* Process further frames delivered by the same read (pipelined messages) */
+                while ((err != TRDP_NODATA_ERR)
+                       && (err != TRDP_CRC_ERR)
+                       && (err != TRDP_WIRE_ERR)
+                       && (err != TRDP_TOPO_ERR)
+                       && (err != TRDP_MEM_ERR)
+                       && (trdp_mdTCPFramePending(appHandle, (UINT32) lIndex) == TRUE))
+                {
+                    err = trdp_mdRecv(appHandle, (UINT32) lIndex);
+                }
+
                 /* The receive message is incomplete */
                 if (err == TRDP_PACKET_ERR)
                 {
@@ -2863,6 +3278,7 @@ void  trdp_mdCheckListenSocks (
                                  (int) appHandle->iface[lIndex].sock);
 
                     appHandle->iface[lIndex].tcpParams.morituri = TRUE;
+                    trdp_freeTCPRcvBuffer(appHandle, lIndex);
 
                     trdp_mdCloseSessions(appHandle, TRDP_INVALID_SOCKET_INDEX, VOS_INVALID_SOCKET, TRUE);
                 }
@@ -2877,6 +3293,7 @@ void  trdp_mdCheckListenSocks (
                                  (int) appHandle->iface[lIndex].sock);
 
                     appHandle->iface[lIndex].tcpParams.morituri = TRUE;
+                    trdp_freeTCPRcvBuffer(appHandle, lIndex);
 
                     trdp_mdCloseSessions(appHandle, TRDP_INVALID_SOCKET_INDEX, VOS_INVALID_SOCKET, TRUE);
                 }
@@ -3153,7 +3570,14 @@ static void trdp_mdDetailSenderPacket (const TRDP_MSG_T         msgType,
         memset((CHAR8 *) pSenderElement->pPacket->frameHead.destinationURI, 0, TRDP_MAX_URI_USER_LEN);
         memcpy((CHAR8 *) pSenderElement->pPacket->frameHead.destinationURI, destURI, strlen((char *)destURI));
     }
-    if ( pData != NULL )
+    pSenderElement->pSendData = NULL;
+
+    if ( trdp_mdSendInPlace(appHandle, pSenderElement->pktFlags, pData) == TRUE )
+    {
+        /* No copy: the caller's buffer is sent by trdp_mdSendPacket() */
+        pSenderElement->pSendData = pData;
+    }
+    else if ( pData != NULL )
     {
         if (pSenderElement->pktFlags & TRDP_FLAGS_MARSHALL &&
             appHandle->marshall.pfCbMarshall != NULL)
@@ -3299,8 +3723,10 @@ TRDP_ERR_T trdp_mdReply (const TRDP_MSG_T           msgType,
                         vos_memFree(pSenderElement->pPacket);
                         pSenderElement->pPacket = NULL;
                     }
-                    /* allocate a buffer for the data   */
-                    pSenderElement->pPacket = (MD_PACKET_T *) vos_memAlloc(pSenderElement->grossSize);
+                    /* allocate a buffer for the data (header only, if the data is sent in place)   */
+                    pSenderElement->pPacket = (MD_PACKET_T *) vos_memAlloc(
+                            trdp_mdSendInPlace(appHandle, pSenderElement->pktFlags, pData)
+                            ? sizeof(MD_HEADER_T) : pSenderElement->grossSize);
                     if ( NULL == pSenderElement->pPacket )
                     {
                         vos_memFree(pSenderElement);
@@ -3515,7 +3941,9 @@ TRDP_ERR_T trdp_mdCall (
                 pSenderElement->pPacket = NULL;
             }
             /* allocate a buffer for the data   */
-            pSenderElement->pPacket = (MD_PACKET_T *) vos_memAlloc(pSenderElement->grossSize);
+            pSenderElement->pPacket = (MD_PACKET_T *) vos_memAlloc(
+                    trdp_mdSendInPlace(appHandle, pSenderElement->pktFlags, pData)
+                    ? sizeof(MD_HEADER_T) : pSenderElement->grossSize);
             if ( NULL == pSenderElement->pPacket )
             {
                 vos_memFree(pSenderElement);
@@ -16,6 +16,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: trdp_mdFreeDupTable added
  *     AHW 2017-11-08: Ticket #179 Max. number of retries (part of sendParam) of a MD request needs to be checked
  *      BL 2014-07-14: Ticket #46: Protocol change: operational topocount needed
  *                     Ticket #47: Protocol change: no FCS for data part of telegrams
@@ -50,6 +51,9 @@ TRDP_ERR_T  trdp_mdGetTCPSocket (
 void        trdp_mdFreeSession (
     MD_ELE_T *pMDSession);
 
+void        trdp_mdFreeDupTable (
+    TRDP_SESSION_PT appHandle);
+
 TRDP_ERR_T  trdp_mdSend (
     TRDP_SESSION_PT appHandle);
 
@@ -16,6 +16,14 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Senders of a multi source subscription linked in the order of their time out
+ *      AG 2026-10-18: TRDP_FLAGS_MULTI_SRC: latest data and time out per sender, trdp_pdGetSource
+ *      AG 2026-10-18: Packets of senders beyond maxNumSources counted in numMissed of the session as well
+ *      AG 2026-10-18: Sequence counter check bound by pdDefault.maxNumSources
+ *      AG 2026-10-18: Hot path trace points (TRDP_TRACE): send, receive, callbacks, timeouts
+ *      AG 2026-10-18: Statistics counters via TRDP_STATS_INC (atomic), numMissed summed on receive
+ *      AG 2026-10-18: PD scheduling in ns, one time stamp per process pass instead of one per queue element
+ *      AG 2026-10-18: PD timing histograms (TRDP_OPTION_PD_TIMING): send lateness, inter-arrival, callback runtime
  *      BL 2018-10-29: Ticket #217 PD Pull requests must be subscribed for
  *      BL 2018-08-07: Ticket #207 tlp_put() and variable dataSize
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
@@ -65,6 +73,7 @@
 #include "trdp_pdcom.h"
 #include "trdp_if.h"
 #include "trdp_stats.h"
+#include "trdp_trace.h"
 #include "vos_sock.h"
 #include "vos_mem.h"
 
@@ -85,6 +94,249 @@
  *   Locals
  */
 
+#define TRDP_PD_SRC_START_SIZE  8u      /**< senders of a multi source subscription at start */
+
+/******************************************************************************/
+/** Find or enter the sender of a received packet in the sender table of a multi source subscription.
+ *  The sequence counter entry of the sender (just checked) holds the index, so a known sender costs no search.
+ *
+ *  @param[in]      pElement        subscription element
+ *  @param[in]      srcIpAddr       source IP address of the packet
+ *  @param[in]      msgType         message type of the packet
+ *
+ *  @retval         sender entry, NULL on memory error
+ */
+static TRDP_PD_SRC_T *trdp_pdSrcFind (
+    PD_ELE_T        *pElement,
+    TRDP_IP_ADDR_T  srcIpAddr,
+    TRDP_MSG_T      msgType)
+{
+    TRDP_SEQ_CNT_ENTRY_T    *pEntry = trdp_findSequenceCounter(pElement, srcIpAddr, msgType);
+    TRDP_PD_SRC_LIST_T      *pList  = pElement->pSrcList;
+    UINT32                  idx;
+
+    if (pEntry == NULL)
+    {
+        return NULL;
+    }
+    if (pEntry->srcIdx != 0u)
+    {
+        return &pList->src[pEntry->srcIdx - 1u];
+    }
+
+    /*  New (sender, message type): the sender may be known by another message type (e.g. Pd and Pp)  */
+    for (idx = 0u; (pList != NULL) && (idx < pList->numSrc); idx++)
+    {
+        if (pList->src[idx].srcIpAddr == srcIpAddr)
+        {
+            pEntry->srcIdx = (UINT16) (idx + 1u);
+            return &pList->src[idx];
+        }
+    }
+
+    if ((pList == NULL) || (pList->numSrc >= pList->maxNoOfSrc))
+    {
+        /* Allocate some (more) space */
+        UINT32              newSize = (pList == NULL) ? TRDP_PD_SRC_START_SIZE : (2u * pList->maxNoOfSrc);
+        TRDP_PD_SRC_LIST_T  *pNewList = (TRDP_PD_SRC_LIST_T *) vos_memAlloc(sizeof(TRDP_PD_SRC_LIST_T) +
+                                                                          (newSize - 1u) * sizeof(TRDP_PD_SRC_T));
+        if (pNewList == NULL)
+        {
+            return NULL;
+        }
+        if (pList != NULL)
+        {
+            memcpy(pNewList, pList, sizeof(TRDP_PD_SRC_LIST_T) + (pList->numSrc - 1u) * sizeof(TRDP_PD_SRC_T));
+            vos_memFree(pList);
+        }
+        pNewList->maxNoOfSrc    = newSize;
+        pElement->pSrcList      = pNewList;
+        pList = pNewList;
+    }
+    idx = pList->numSrc++;
+    pList->src[idx].srcIpAddr   = srcIpAddr;
+    pEntry->srcIdx              = (UINT16) (idx + 1u);
+    return &pList->src[idx];
+}
+
+/******************************************************************************/
+/** Remove a sender from the time out list of a multi source subscription.
+ *
+ *  @param[in]      pList           sender table
+ *  @param[in]      idx             index of the sender
+ */
+static void trdp_pdSrcUnlink (
+    TRDP_PD_SRC_LIST_T  *pList,
+    UINT32              idx)
+{
+    TRDP_PD_SRC_T *pSrc = &pList->src[idx];
+
+    if ((pSrc->prevDue == 0u) && (pList->firstDue != idx + 1u))
+    {
+        return;     /* not linked */
+    }
+    if (pSrc->prevDue == 0u)
+    {
+        pList->firstDue = pSrc->nextDue;
+    }
+    else
+    {
+        pList->src[pSrc->prevDue - 1u].nextDue = pSrc->nextDue;
+    }
+    if (pSrc->nextDue == 0u)
+    {
+        pList->lastDue = pSrc->prevDue;
+    }
+    else
+    {
+        pList->src[pSrc->nextDue - 1u].prevDue = pSrc->prevDue;
+    }
+    pSrc->prevDue   = 0u;
+    pSrc->nextDue   = 0u;
+    pList->nextTimeOut = (pList->firstDue == 0u) ? 0u : pList->src[pList->firstDue - 1u].timeToGo;
+}
+
+/******************************************************************************/
+/** Store the received packet as the latest one of its sender and restart the sender's time out.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        subscription element
+ *  @param[in]      pSrc            sender entry
+ *  @param[in]      destIpAddr      destination of the packet
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory
+ */
+static TRDP_ERR_T trdp_pdSrcStore (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement,
+    TRDP_PD_SRC_T   *pSrc,
+    TRDP_IP_ADDR_T  destIpAddr)
+{
+    if (pSrc->frameSize < pElement->grossSize)
+    {
+        PD_PACKET_T *pFrame = (PD_PACKET_T *) vos_memAlloc(pElement->grossSize);
+
+        if (pFrame == NULL)
+        {
+            return TRDP_MEM_ERR;
+        }
+        if (pSrc->pFrame != NULL)
+        {
+            vos_memFree(pSrc->pFrame);
+        }
+        pSrc->pFrame    = pFrame;
+        pSrc->frameSize = pElement->grossSize;
+    }
+    memcpy(pSrc->pFrame, appHandle->pNewFrame, pElement->grossSize);
+
+    pSrc->destIpAddr    = destIpAddr;
+    pSrc->timedOut      = FALSE;
+    pSrc->numRecv++;
+    if (pElement->interval != 0u)
+    {
+        TRDP_PD_SRC_LIST_T  *pList  = pElement->pSrcList;
+        UINT32              idx     = (UINT32) (pSrc - pList->src);
+
+        /*  Same interval for all senders: the latest one times out last   */
+        trdp_pdSrcUnlink(pList, idx);
+        pSrc->timeToGo  = appHandle->now + pElement->interval;
+        pSrc->prevDue   = pList->lastDue;
+        if (pList->lastDue == 0u)
+        {
+            pList->firstDue = idx + 1u;
+        }
+        else
+        {
+            pList->src[pList->lastDue - 1u].nextDue = idx + 1u;
+        }
+        pList->lastDue      = idx + 1u;
+        pList->nextTimeOut  = pList->src[pList->firstDue - 1u].timeToGo;
+    }
+    return TRDP_NO_ERR;
+}
+
+/******************************************************************************/
+/** Fill in the PD info of a sender
+ *
+ *  @param[in]      pElement        subscription element
+ *  @param[in]      pSrc            sender entry
+ *  @param[out]     pPdInfo         PD info to fill in
+ *  @param[in]      resultCode      result to report
+ */
+static void trdp_pdSrcInfo (
+    const PD_ELE_T      *pElement,
+    const TRDP_PD_SRC_T *pSrc,
+    TRDP_PD_INFO_T      *pPdInfo,
+    TRDP_ERR_T          resultCode)
+{
+    memset(pPdInfo, 0, sizeof(TRDP_PD_INFO_T));
+    pPdInfo->comId          = pElement->addr.comId;
+    pPdInfo->srcIpAddr      = pSrc->srcIpAddr;
+    pPdInfo->destIpAddr     = pSrc->destIpAddr;
+    pPdInfo->pUserRef       = pElement->pUserRef;
+    pPdInfo->resultCode     = resultCode;
+    if (pSrc->pFrame != NULL)
+    {
+        pPdInfo->etbTopoCnt     = vos_ntohl(pSrc->pFrame->frameHead.etbTopoCnt);
+        pPdInfo->opTrnTopoCnt   = vos_ntohl(pSrc->pFrame->frameHead.opTrnTopoCnt);
+        pPdInfo->msgType        = (TRDP_MSG_T) vos_ntohs(pSrc->pFrame->frameHead.msgType);
+        pPdInfo->seqCount       = vos_ntohl(pSrc->pFrame->frameHead.sequenceCounter);
+        pPdInfo->protVersion    = vos_ntohs(pSrc->pFrame->frameHead.protocolVersion);
+        pPdInfo->replyComId     = vos_ntohl(pSrc->pFrame->frameHead.replyComId);
+        pPdInfo->replyIpAddr    = vos_ntohl(pSrc->pFrame->frameHead.replyIpAddress);
+    }
+}
+
+/******************************************************************************/
+/** Check the senders of a multi source subscription for time outs.
+ *  Each sender times out once, the user is informed by a callback with its source address.
+ *  Only the late senders at the head of the time out list are visited.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        subscription element
+ *  @param[in]      now             current time
+ *
+ *  @retval         current time after the callbacks
+ */
+static VOS_TIME_NS_T trdp_pdSrcTimeOuts (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement,
+    VOS_TIME_NS_T   now)
+{
+    /*  The table is addressed anew for each sender, a callback may receive packets and so enlarge it  */
+    while ((pElement->pSrcList->nextTimeOut != 0u) && (pElement->pSrcList->nextTimeOut <= now))
+    {
+        UINT32          idx     = pElement->pSrcList->firstDue - 1u;
+        TRDP_PD_SRC_T   *pSrc   = &pElement->pSrcList->src[idx];
+
+        /*  Sender is late  */
+        trdp_pdSrcUnlink(pElement->pSrcList, idx);
+        pSrc->timedOut = TRUE;
+        TRDP_STATS_INC(appHandle->stats.pd.numTimeout);
+        TRDP_TRACE_EVENT(appHandle, TRDP_TRACE_PD_TIMEOUT, pElement->addr.comId,
+                         vos_ntohl(pSrc->pFrame->frameHead.sequenceCounter), 0u);
+
+        if ((pElement->pktFlags & TRDP_FLAGS_CALLBACK) && (pElement->pfCbFunction != NULL))
+        {
+            TRDP_PD_INFO_T theMessage;
+
+            trdp_pdSrcInfo(pElement, pSrc, &theMessage, TRDP_TIMEOUT_ERR);
+            pElement->pfCbFunction(appHandle->pdDefault.pRefCon,
+                                   appHandle,
+                                   &theMessage,
+                                   pSrc->pFrame->data,
+                                   vos_ntohl(pSrc->pFrame->frameHead.datasetLength));
+            now = vos_getTimeNs();
+        }
+    }
+    return now;
+}
+
+/******************************************************************************
+ *   Globals
+ */
+
 
 /******************************************************************************/
 /** Initialize/construct the packet
@@ -281,6 +533,134 @@ TRDP_ERR_T trdp_pdGet (
     return TRDP_NO_ERR;
 }
 
+/******************************************************************************/
+/** Copy the latest data of one sender of a multi source subscription
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        subscription element
+ *  @param[in]      index           index of the sender (order of the first packet), if srcIpAddr is 0
+ *  @param[in]      srcIpAddr       source IP address of the sender or 0
+ *  @param[out]     pPdInfo         PD info of the sender, may be NULL
+ *  @param[out]     pData           pointer to application's data buffer, may be NULL
+ *  @param[in,out]  pDataSize       in: size of buffer, out: size of data
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      no multi source subscription, index out of range or buffer too small
+ *  @retval         TRDP_NODATA_ERR     nothing received from this source
+ *  @retval         TRDP_TIMEOUT_ERR    the sender timed out
+ */
+TRDP_ERR_T trdp_pdGetSource (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement,
+    UINT32          index,
+    TRDP_IP_ADDR_T  srcIpAddr,
+    TRDP_PD_INFO_T  *pPdInfo,
+    UINT8           *pData,
+    UINT32          *pDataSize)
+{
+    TRDP_PD_SRC_T   *pSrc = NULL;
+    TRDP_ERR_T      err = TRDP_NO_ERR;
+    UINT32          dataSize;
+
+    if (!(pElement->pktFlags & TRDP_FLAGS_MULTI_SRC))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (srcIpAddr != VOS_INADDR_ANY)
+    {
+        TRDP_SEQ_CNT_ENTRY_T *pEntry = trdp_findSequenceCounter(pElement, srcIpAddr, (TRDP_MSG_T) TRDP_MSG_PD);
+
+        if ((pEntry == NULL) || (pEntry->srcIdx == 0u))
+        {
+            pEntry = trdp_findSequenceCounter(pElement, srcIpAddr, (TRDP_MSG_T) TRDP_MSG_PP);
+        }
+        if ((pEntry == NULL) || (pEntry->srcIdx == 0u))
+        {
+            return TRDP_NODATA_ERR;
+        }
+        pSrc = &pElement->pSrcList->src[pEntry->srcIdx - 1u];
+    }
+    else if ((pElement->pSrcList != NULL) && (index < pElement->pSrcList->numSrc))
+    {
+        pSrc = &pElement->pSrcList->src[index];
+    }
+    else
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (pSrc->pFrame == NULL)
+    {
+        return TRDP_NODATA_ERR;                         /* storing its first packet failed */
+    }
+    dataSize = vos_ntohl(pSrc->pFrame->frameHead.datasetLength);
+    if ((pElement->interval != 0u) && (pSrc->timeToGo < appHandle->now))
+    {
+        /*    Sender is late    */
+        if ((pElement->toBehavior == TRDP_TO_SET_TO_ZERO) && (pData != NULL) && (pDataSize != NULL))
+        {
+            memset(pData, 0, *pDataSize);
+        }
+        err = TRDP_TIMEOUT_ERR;
+    }
+    else if ((pData != NULL) && (pDataSize != NULL))
+    {
+        if (!(pElement->pktFlags & TRDP_FLAGS_MARSHALL) || (appHandle->marshall.pfCbUnmarshall == NULL))
+        {
+            if (*pDataSize >= dataSize)
+            {
+                *pDataSize = dataSize;
+                memcpy(pData, pSrc->pFrame->data, dataSize);
+            }
+            else
+            {
+                err = TRDP_PARAM_ERR;
+            }
+        }
+        else
+        {
+            err = appHandle->marshall.pfCbUnmarshall(appHandle->marshall.pRefCon,
+                                                     pElement->addr.comId,
+                                                     pSrc->pFrame->data,
+                                                     dataSize,
+                                                     pData,
+                                                     pDataSize,
+                                                     &pElement->pCachedDS);
+        }
+    }
+
+    if (pPdInfo != NULL)
+    {
+        trdp_pdSrcInfo(pElement, pSrc, pPdInfo, err);
+    }
+    return err;
+}
+
+/******************************************************************************/
+/** Release the sender table of a multi source subscription
+ *
+ *  @param[in]      pElement        subscription element
+ */
+void trdp_pdFreeSources (
+    PD_ELE_T *pElement)
+{
+    UINT32 idx;
+
+    if (pElement->pSrcList != NULL)
+    {
+        for (idx = 0u; idx < pElement->pSrcList->numSrc; idx++)
+        {
+            if (pElement->pSrcList->src[idx].pFrame != NULL)
+            {
+                vos_memFree(pElement->pSrcList->src[idx].pFrame);
+            }
+        }
+        vos_memFree(pElement->pSrcList);
+        pElement->pSrcList = NULL;
+    }
+}
+
 /******************************************************************************/
 /** Send all due PD messages
  *
@@ -292,26 +672,31 @@ TRDP_ERR_T trdp_pdGet (
 TRDP_ERR_T  trdp_pdSendQueued (
     TRDP_SESSION_PT appHandle)
 {
-    PD_ELE_T    *iterPD = appHandle->pSndQueue;
-    TRDP_TIME_T now;
-    TRDP_ERR_T  err = TRDP_NO_ERR;
+    PD_ELE_T        *iterPD = appHandle->pSndQueue;
+    VOS_TIME_NS_T   now     = appHandle->now;   /* time of this process pass */
+    VOS_TIME_NS_T   cbStart = 0u;
+    TRDP_ERR_T      err     = TRDP_NO_ERR;
+    TRDP_TRACE_DECL(traceStart)
 
-    vos_clearTime(&appHandle->nextJob);
+    appHandle->nextJob = 0u;
 
     /*    Find the packet which has to be sent next:    */
     while (iterPD != NULL)
     {
-        /*    Get the current time    */
-        vos_getTime(&now);
-
         /*  Is this a cyclic packet and
          due to sent?
          or is it a PD Request or a requested packet (PULL) ?
          */
-        if ((timerisset(&iterPD->interval) &&                   /*  Request for immediate sending   */
-             !timercmp(&iterPD->timeToGo, &now, >)) ||
+        if (((iterPD->interval != 0u) &&                        /*  Request for immediate sending   */
+             (iterPD->timeToGo <= now)) ||
             (iterPD->privFlags & TRDP_REQ_2B_SENT))
         {
+            if ((appHandle->option & TRDP_OPTION_PD_TIMING) &&
+                !(iterPD->privFlags & TRDP_REQ_2B_SENT))
+            {
+                trdp_timingAdd(&iterPD->timing.sendLateness, iterPD->timeToGo, now);
+            }
+
             /* send only if there is valid data */
             if (!(iterPD->privFlags & TRDP_INVALID_DATA))
             {
@@ -359,17 +744,31 @@ TRDP_ERR_T  trdp_pdSendQueued (
                         theMessage.pUserRef     = iterPD->pUserRef; /* User reference given with the local subscribe? */
                         theMessage.resultCode   = err;
 
+                        if (appHandle->option & TRDP_OPTION_PD_TIMING)
+                        {
+                            cbStart = vos_getTimeNs();
+                        }
+                        TRDP_TRACE_START(traceStart);
                         iterPD->pfCbFunction(appHandle->pdDefault.pRefCon,
                                                        appHandle,
                                                        &theMessage,
                                                        iterPD->pFrame->data,
                                                        vos_ntohl(iterPD->pFrame->frameHead.datasetLength));
+                        TRDP_TRACE_SPAN(appHandle, TRDP_TRACE_PD_CALLBACK, iterPD->addr.comId, iterPD->curSeqCnt,
+                                        (UINT16) err, traceStart);
+                        if (appHandle->option & TRDP_OPTION_PD_TIMING)
+                        {
+                            trdp_timingAdd(&iterPD->timing.cbExecTime, cbStart, vos_getTimeNs());
+                        }
                     }
                     /* We pass the error to the application, but we keep on going    */
+                    TRDP_TRACE_START(traceStart);
                     result = trdp_pdSend(appHandle->iface[iterPD->socketIdx].sock, iterPD, appHandle->pdDefault.port);
                     if (result == TRDP_NO_ERR)
                     {
-                        appHandle->stats.pd.numSend++;
+                        TRDP_TRACE_SPAN(appHandle, TRDP_TRACE_PD_SEND, iterPD->addr.comId, iterPD->curSeqCnt,
+                                        vos_ntohs(iterPD->pFrame->frameHead.msgType), traceStart);
+                        TRDP_STATS_INC(appHandle->stats.pd.numSend);
                         iterPD->numRxTx++;
                     }
                     else
@@ -385,18 +784,17 @@ TRDP_ERR_T  trdp_pdSendQueued (
                 /* Do not reset timer, but restore msgType */
                 iterPD->pFrame->frameHead.msgType = vos_htons(TRDP_MSG_PD);
             }
-            else if (timerisset(&iterPD->interval))
+            else if (iterPD->interval != 0u)
             {
                 /*  Set timer if interval was set.
                     In case of a requested cyclically PD packet, this will lead to one time jump (jitter) in the interval
                 */
-                vos_addTime(&iterPD->timeToGo, &iterPD->interval);
+                iterPD->timeToGo += iterPD->interval;
 
-                if (vos_cmpTime(&iterPD->timeToGo, &now) <= 0)
+                if (iterPD->timeToGo <= now)
                 {
                     /* in case of a delay of more than one interval - avoid sending it in the next cycle again */
-                    iterPD->timeToGo = now;
-                    vos_addTime(&iterPD->timeToGo, &iterPD->interval);
+                    iterPD->timeToGo = now + iterPD->interval;
                 }
             }
 
@@ -413,6 +811,7 @@ TRDP_ERR_T  trdp_pdSendQueued (
                 pTemp = iterPD->pNext;
                 /* Remove current element */
                 trdp_queueDelElement(&appHandle->pSndQueue, iterPD);
+                TRDP_STATS_DEC(appHandle->stats.pd.numPub);
                 iterPD->magic = 0u;
                 if (iterPD->pSeqCntList != NULL)
                 {
@@ -460,6 +859,11 @@ TRDP_ERR_T  trdp_pdReceive (
     UINT32              recSize         = TRDP_MAX_PD_PACKET_SIZE;
     int                 informUser      = FALSE;
     TRDP_ADDRESSES_T    subAddresses    = { 0u, 0u, 0u, 0u, 0u, 0u, 0u};
+    TRDP_PD_SRC_T       *pSrc           = NULL;
+    VOS_TIME_NS_T       cbStart         = 0u;
+    TRDP_TRACE_DECL(traceStart)
+
+    TRDP_TRACE_START(traceStart);
 
     /*  Get the packet from the wire:  */
     err = (TRDP_ERR_T) vos_sockReceiveUDP(sock,
@@ -481,13 +885,15 @@ TRDP_ERR_T  trdp_pdReceive (
     switch (err)
     {
        case TRDP_NO_ERR:
-           appHandle->stats.pd.numRcv++;
+           TRDP_STATS_INC(appHandle->stats.pd.numRcv);
+           TRDP_TRACE_SPAN(appHandle, TRDP_TRACE_PD_RECEIVE, vos_ntohl(pNewFrameHead->comId),
+                           vos_ntohl(pNewFrameHead->sequenceCounter), vos_ntohs(pNewFrameHead->msgType), traceStart);
            break;
        case TRDP_CRC_ERR:
-           appHandle->stats.pd.numCrcErr++;
+           TRDP_STATS_INC(appHandle->stats.pd.numCrcErr);
            return err;
        case TRDP_WIRE_ERR:
-           appHandle->stats.pd.numProtErr++;
+           TRDP_STATS_INC(appHandle->stats.pd.numProtErr);
            return err;
        default:
            return err;
@@ -501,7 +907,7 @@ TRDP_ERR_T  trdp_pdReceive (
                                   vos_ntohl(pNewFrameHead->etbTopoCnt),
                                   vos_ntohl(pNewFrameHead->opTrnTopoCnt)))
     {
-        appHandle->stats.pd.numTopoErr++;
+        TRDP_STATS_INC(appHandle->stats.pd.numTopoErr);
         return TRDP_TOPO_ERR;
     }
 
@@ -534,11 +940,6 @@ TRDP_ERR_T  trdp_pdReceive (
                                    pExistingElement->addr.opTrnTopoCnt))
         {
             UINT32 newSeqCnt = vos_ntohl(pNewFrameHead->sequenceCounter);
-            /* Save the source IP address of the received packet */
-            pExistingElement->lastSrcIP = subAddresses.srcIpAddr;
-            /* Save the real destination of the received packet (own IP or MC group) */
-            pExistingElement->addr.destIpAddr = subAddresses.destIpAddr;
-
 
             if (newSeqCnt == 0u)  /* restarted or new sender */
             {
@@ -550,25 +951,35 @@ TRDP_ERR_T  trdp_pdReceive (
             switch (trdp_checkSequenceCounter(pExistingElement,
                                               newSeqCnt,
                                               subAddresses.srcIpAddr,
-                                              (TRDP_MSG_T) vos_ntohs(pNewFrameHead->msgType)))
+                                              (TRDP_MSG_T) vos_ntohs(pNewFrameHead->msgType),
+                                              appHandle->pdDefault.maxNumSources))
             {
                case 0:                      /* Sequence counter is valid (at least 1 higher than previous one) */
                    break;
-               case -1:                     /* List overflow */
+               case -1:                     /* Out of memory */
                    return TRDP_MEM_ERR;
                case 1:
-                   vos_printLog(VOS_LOG_INFO, "Old PD data ignored (SrcIp: %s comId %u)\n", vos_ipDotted(
-                                    subAddresses.srcIpAddr), vos_ntohl(pNewFrameHead->comId));
                    return TRDP_NO_ERR;      /* Ignore packet, too old or duplicate */
+               case 2:                      /* Ignore packet, sender not tracked */
+                   pExistingElement->numMissed++;
+                   TRDP_STATS_INC(appHandle->stats.pd.numMissed);
+                   return TRDP_NO_ERR;
             }
 
+            /* Save the source IP address of the received packet */
+            pExistingElement->lastSrcIP = subAddresses.srcIpAddr;
+            /* Save the real destination of the received packet (own IP or MC group) */
+            pExistingElement->addr.destIpAddr = subAddresses.destIpAddr;
+
             if ((newSeqCnt > 0u) && (newSeqCnt > (pExistingElement->curSeqCnt + 1u)))
             {
                 pExistingElement->numMissed += newSeqCnt - pExistingElement->curSeqCnt - 1u;
+                TRDP_STATS_ADD(appHandle->stats.pd.numMissed, newSeqCnt - pExistingElement->curSeqCnt - 1u);
             }
             else if (pExistingElement->curSeqCnt > newSeqCnt)
             {
                 pExistingElement->numMissed += UINT32_MAX - pExistingElement->curSeqCnt + newSeqCnt;
+                TRDP_STATS_ADD(appHandle->stats.pd.numMissed, UINT32_MAX - pExistingElement->curSeqCnt + newSeqCnt);
             }
 
             /* Store last received sequence counter here, too (pd_get et. al. may access it).   */
@@ -578,6 +989,17 @@ TRDP_ERR_T  trdp_pdReceive (
             pExistingElement->dataSize  = vos_ntohl(pNewFrameHead->datasetLength);
             pExistingElement->grossSize = trdp_packetSizePD(pExistingElement->dataSize);
 
+            /*  Multi source subscription: the sender's latest data is compared and kept   */
+            if (pExistingElement->pktFlags & TRDP_FLAGS_MULTI_SRC)
+            {
+                pSrc = trdp_pdSrcFind(pExistingElement, subAddresses.srcIpAddr,
+                                      (TRDP_MSG_T) vos_ntohs(pNewFrameHead->msgType));
+                if (pSrc == NULL)
+                {
+                    return TRDP_MEM_ERR;
+                }
+            }
+
             /*  Has the data changed?   */
             if (pExistingElement->pktFlags & TRDP_FLAGS_CALLBACK)
             {
@@ -586,6 +1008,15 @@ TRDP_ERR_T  trdp_pdReceive (
                 {
                     informUser = TRUE;                 /* Inform user anyway */
                 }
+                else if (pSrc != NULL)
+                {
+                    if ((pSrc->pFrame == NULL) || pSrc->timedOut ||
+                        (pSrc->pFrame->frameHead.datasetLength != pNewFrameHead->datasetLength) ||
+                        (0 != memcmp(appHandle->pNewFrame->data, pSrc->pFrame->data, pExistingElement->dataSize)))
+                    {
+                        informUser = TRUE;
+                    }
+                }
                 else if (0 != memcmp(appHandle->pNewFrame->data,
                                      pExistingElement->pFrame->data,
                                      pExistingElement->dataSize))
@@ -593,10 +1024,24 @@ TRDP_ERR_T  trdp_pdReceive (
                     informUser = TRUE;
                 }
             }
+            if ((pSrc != NULL) &&
+                (trdp_pdSrcStore(appHandle, pExistingElement, pSrc, subAddresses.destIpAddr) != TRDP_NO_ERR))
+            {
+                return TRDP_MEM_ERR;
+            }
 
-            /*  Get the current time and compute the next time this packet should be received.  */
-            vos_getTime(&pExistingElement->timeToGo);
-            vos_addTime(&pExistingElement->timeToGo, &pExistingElement->interval);
+            /*  Compute the next time this packet should be received from the time of this pass.  */
+            if (appHandle->option & TRDP_OPTION_PD_TIMING)
+            {
+                if (pExistingElement->timing.lastArrival != 0u)
+                {
+                    trdp_timingAdd(&pExistingElement->timing.interArrival,
+                                   pExistingElement->timing.lastArrival,
+                                   appHandle->now);
+                }
+                pExistingElement->timing.lastArrival = appHandle->now;
+            }
+            pExistingElement->timeToGo = appHandle->now + pExistingElement->interval;
 
             /*  Update some statistics  */
             pExistingElement->numRxTx++;
@@ -680,7 +1125,7 @@ TRDP_ERR_T  trdp_pdReceive (
         }
         else
         {
-            appHandle->stats.pd.numTopoErr++;
+            TRDP_STATS_INC(appHandle->stats.pd.numTopoErr);
             pExistingElement->lastErr = TRDP_TOPO_ERR;
             err         = TRDP_TOPO_ERR;
             informUser  = TRUE;
@@ -708,11 +1153,22 @@ TRDP_ERR_T  trdp_pdReceive (
             theMessage.pUserRef     = pExistingElement->pUserRef; /* User reference given with the local subscribe? */
             theMessage.resultCode   = err;
 
+            if (appHandle->option & TRDP_OPTION_PD_TIMING)
+            {
+                cbStart = vos_getTimeNs();
+            }
+            TRDP_TRACE_START(traceStart);
             pExistingElement->pfCbFunction(appHandle->pdDefault.pRefCon,
                                            appHandle,
                                            &theMessage,
                                            pExistingElement->pFrame->data,
                                            vos_ntohl(pExistingElement->pFrame->frameHead.datasetLength));
+            TRDP_TRACE_SPAN(appHandle, TRDP_TRACE_PD_CALLBACK, pExistingElement->addr.comId,
+                            pExistingElement->curSeqCnt, (UINT16) err, traceStart);
+            if (appHandle->option & TRDP_OPTION_PD_TIMING)
+            {
+                trdp_timingAdd(&pExistingElement->timing.cbExecTime, cbStart, vos_getTimeNs());
+            }
         }
     }
     return err;
@@ -734,19 +1190,28 @@ void trdp_pdCheckPending (
 
     /*    Walk over the registered PDs, find pending packets */
 
-    timerclear(&appHandle->nextJob);
+    appHandle->nextJob = 0u;
 
     /*    Find the packet which has to be received next:    */
     for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
     {
         if ((!(iterPD->privFlags & TRDP_TIMED_OUT)) &&              /* Exempt already timed-out packet */
-            timerisset(&iterPD->interval) &&                        /* not PD PULL?                    */
-            (timercmp(&iterPD->timeToGo, &appHandle->nextJob, <) || /* earlier than current time-out?  */
-             !timerisset(&appHandle->nextJob)))                     /* or not set at all?              */
+            (iterPD->interval != 0u) &&                             /* not PD PULL?                    */
+            ((iterPD->timeToGo < appHandle->nextJob) ||             /* earlier than current time-out?  */
+             (appHandle->nextJob == 0u)))                           /* or not set at all?              */
         {
             appHandle->nextJob = iterPD->timeToGo;                  /* set new next time value from queue element */
         }
 
+        /*    Senders of a multi source subscription time out on their own    */
+        if ((iterPD->pSrcList != NULL) &&
+            (iterPD->pSrcList->nextTimeOut != 0u) &&
+            ((iterPD->pSrcList->nextTimeOut < appHandle->nextJob) ||
+             (appHandle->nextJob == 0u)))
+        {
+            appHandle->nextJob = iterPD->pSrcList->nextTimeOut;
+        }
+
         /*    Check and set the socket file descriptor, if not already done    */
         if (iterPD->socketIdx != -1 &&
             appHandle->iface[iterPD->socketIdx].sock != -1 &&
@@ -767,9 +1232,9 @@ void trdp_pdCheckPending (
     /*    Find packet in send queue which evntually has to be sent earlier:    */
     for (iterPD = appHandle->pSndQueue; iterPD != NULL; iterPD = iterPD->pNext)
     {
-        if (timerisset(&iterPD->interval) &&                        /* has a time out value?    */
-            (timercmp(&iterPD->timeToGo, &appHandle->nextJob, <) ||  /* earlier than current time-out? */
-             !timerisset(&appHandle->nextJob)))
+        if ((iterPD->interval != 0u) &&                             /* has a time out value?    */
+            ((iterPD->timeToGo < appHandle->nextJob) ||             /* earlier than current time-out? */
+             (appHandle->nextJob == 0u)))
         {
             appHandle->nextJob = iterPD->timeToGo;                  /* set new next time value from queue element */
         }
@@ -784,24 +1249,32 @@ void trdp_pdCheckPending (
 void trdp_pdHandleTimeOuts (
     TRDP_SESSION_PT appHandle)
 {
-    PD_ELE_T    *iterPD = NULL;
-    TRDP_TIME_T now;
-
-    /*    Update the current time    */
-    vos_getTime(&now);
+    PD_ELE_T        *iterPD = NULL;
+    VOS_TIME_NS_T   now     = appHandle->now;   /* time of this process pass */
+    VOS_TIME_NS_T   cbEnd;
+    TRDP_TRACE_DECL(traceStart)
 
     /*    Examine receive queue for late packets    */
     for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
     {
-        if (timerisset(&iterPD->interval) &&
-            timerisset(&iterPD->timeToGo) &&                        /*  Prevent timing out of PULLed data too early */
-            !timercmp(&iterPD->timeToGo, &now, >) &&                /*  late?   */
+        /*    Late senders of a multi source subscription   */
+        if ((iterPD->pSrcList != NULL) &&
+            (iterPD->pSrcList->nextTimeOut != 0u) &&
+            (iterPD->pSrcList->nextTimeOut <= now))
+        {
+            now = trdp_pdSrcTimeOuts(appHandle, iterPD, now);
+        }
+
+        if ((iterPD->interval != 0u) &&
+            (iterPD->timeToGo != 0u) &&                             /*  Prevent timing out of PULLed data too early */
+            (iterPD->timeToGo <= now) &&                            /*  late?   */
             !(iterPD->privFlags & TRDP_TIMED_OUT) &&                /*  and not already flagged ?   */
             !(iterPD->addr.comId == TRDP_STATISTICS_PULL_COMID)) /*  Do not bother user with statistics timeout */
         {
             /*  Update some statistics  */
-            appHandle->stats.pd.numTimeout++;
+            TRDP_STATS_INC(appHandle->stats.pd.numTimeout);
             iterPD->lastErr = TRDP_TIMEOUT_ERR;
+            TRDP_TRACE_EVENT(appHandle, TRDP_TRACE_PD_TIMEOUT, iterPD->addr.comId, iterPD->curSeqCnt, 0u);
 
             /* Packet is late! We inform the user about this:    */
             if (iterPD->pfCbFunction != NULL)
@@ -813,6 +1286,7 @@ void trdp_pdHandleTimeOuts (
                 theMessage.destIpAddr   = iterPD->addr.destIpAddr;
                 theMessage.pUserRef     = iterPD->pUserRef;
                 theMessage.resultCode   = TRDP_TIMEOUT_ERR;
+                TRDP_TRACE_START(traceStart);
                 if (iterPD->pFrame != NULL)
                 {
                     theMessage.etbTopoCnt   = vos_ntohl(iterPD->pFrame->frameHead.etbTopoCnt);
@@ -837,14 +1311,21 @@ void trdp_pdHandleTimeOuts (
                                          NULL,
                                          iterPD->dataSize);
                 }
+
+                TRDP_TRACE_SPAN(appHandle, TRDP_TRACE_PD_CALLBACK, iterPD->addr.comId, iterPD->curSeqCnt,
+                                (UINT16) TRDP_TIMEOUT_ERR, traceStart);
+                /* The time only needs an update if the application spent some in the callback */
+                cbEnd = vos_getTimeNs();
+                if (appHandle->option & TRDP_OPTION_PD_TIMING)
+                {
+                    trdp_timingAdd(&iterPD->timing.cbExecTime, now, cbEnd);
+                }
+                now = cbEnd;
             }
 
             /*    Prevent repeated time out events    */
             iterPD->privFlags |= TRDP_TIMED_OUT;
         }
-
-        /*    Update the current time    */
-        vos_getTime(&now);
     }
 }
 
@@ -1071,13 +1552,13 @@ TRDP_ERR_T  trdp_pdSend (
 TRDP_ERR_T  trdp_pdDistribute (
     PD_ELE_T *pSndQueue)
 {
-    PD_ELE_T    *pPacket    = pSndQueue;
-    TRDP_TIME_T deltaTmax   = {1000u, 0}; /*    Preset to highest value    */
-    TRDP_TIME_T tNull       = {0u, 0};
-    TRDP_TIME_T temp        = {0u, 0};
-    TRDP_TIME_T nextTime2Go;
-    UINT32      noOfPackets = 0u;
-    UINT32      packetIndex = 0u;
+    PD_ELE_T        *pPacket    = pSndQueue;
+    VOS_TIME_NS_T   deltaTmax   = 1000u * (VOS_TIME_NS_T) VOS_NS_PER_SEC;  /*    Preset to highest value    */
+    VOS_TIME_NS_T   tNull       = 0u;
+    VOS_TIME_NS_T   temp;
+    VOS_TIME_NS_T   nextTime2Go;
+    UINT32          noOfPackets = 0u;
+    UINT32          packetIndex = 0u;
 
     if (pSndQueue == NULL)
     {
@@ -1099,14 +1580,13 @@ TRDP_ERR_T  trdp_pdDistribute (
     while (pPacket)
     {
         /*  Do not count PULL-only packets!  */
-        if ((pPacket->interval.tv_sec != 0u) ||
-            (pPacket->interval.tv_usec != 0))
+        if (pPacket->interval != 0u)
         {
-            if (vos_cmpTime(&deltaTmax, &pPacket->interval) > 0)
+            if (deltaTmax > pPacket->interval)
             {
                 deltaTmax = pPacket->interval;
             }
-            if (vos_cmpTime(&tNull, &pPacket->timeToGo) < 0)
+            if (tNull < pPacket->timeToGo)
             {
                 tNull = pPacket->timeToGo;
             }
@@ -1116,7 +1596,7 @@ TRDP_ERR_T  trdp_pdDistribute (
     }
 
     /*  Sanity check  */
-    if ((vos_cmpTime(&deltaTmax, &temp) == 0) ||
+    if ((deltaTmax == 0u) ||
         (noOfPackets == 0))
     {
         vos_printLog(VOS_LOG_INFO, "trdp_pdDistribute: no minimal interval in %d packets found!\n", noOfPackets);
@@ -1124,42 +1604,40 @@ TRDP_ERR_T  trdp_pdDistribute (
     }
 
     /*  This is the delta time we can jitter...   */
-    vos_divTime(&deltaTmax, noOfPackets);
+    deltaTmax /= noOfPackets;
 
     vos_printLog(VOS_LOG_INFO,
                  "trdp_pdDistribute: deltaTmax   = %ld.%06u\n",
-                 (long) deltaTmax.tv_sec,
-                 (unsigned int)deltaTmax.tv_usec);
+                 (long) (deltaTmax / VOS_NS_PER_SEC),
+                 (unsigned int) VOS_NS_TO_USEC(deltaTmax % VOS_NS_PER_SEC));
     vos_printLog(VOS_LOG_INFO,
                  "trdp_pdDistribute: tNull       = %ld.%06u\n",
-                 (long) tNull.tv_sec,
-                 (unsigned int)tNull.tv_usec);
+                 (long) (tNull / VOS_NS_PER_SEC),
+                 (unsigned int) VOS_NS_TO_USEC(tNull % VOS_NS_PER_SEC));
     vos_printLog(VOS_LOG_INFO, "trdp_pdDistribute: noOfPackets = %d\n", noOfPackets);
 
     for (packetIndex = 0, pPacket = pSndQueue; packetIndex < noOfPackets && pPacket != NULL; )
     {
         /*  Ignore PULL-only packets!  */
-        if ((pPacket->interval.tv_sec != 0u) ||
-            (pPacket->interval.tv_usec != 0))
+        if (pPacket->interval != 0u)
         {
-            nextTime2Go = tNull;
-            temp        = deltaTmax;
-            vos_mulTime(&temp, packetIndex);
-
-            vos_addTime(&nextTime2Go, &temp);
-            vos_mulTime(&temp, 2u);
+            temp        = deltaTmax * packetIndex;
+            nextTime2Go = tNull + temp;
+            temp        *= 2u;
 
-            if (vos_cmpTime(&temp, &pPacket->interval) > 0)
+            if (temp > pPacket->interval)
             {
                 vos_printLog(VOS_LOG_INFO, "trdp_pdDistribute: packet [%d] with interval %lu.%06u could timeout...\n",
-                             packetIndex, (long) temp.tv_sec, (unsigned int)temp.tv_usec);
+                             packetIndex, (long) (temp / VOS_NS_PER_SEC),
+                             (unsigned int) VOS_NS_TO_USEC(temp % VOS_NS_PER_SEC));
                 vos_printLogStr(VOS_LOG_INFO, "...no change in send time!\n");
             }
             else
             {
                 pPacket->timeToGo = nextTime2Go;
                 vos_printLog(VOS_LOG_INFO, "trdp_pdDistribute: nextTime2Go[%d] = %lu.%06u\n",
-                             packetIndex, (unsigned long) nextTime2Go.tv_sec, (unsigned int)nextTime2Go.tv_usec);
+                             packetIndex, (unsigned long) (nextTime2Go / VOS_NS_PER_SEC),
+                             (unsigned int) VOS_NS_TO_USEC(nextTime2Go % VOS_NS_PER_SEC));
 
             }
             packetIndex++;
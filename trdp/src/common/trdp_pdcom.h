@@ -16,6 +16,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: trdp_pdGetSource, trdp_pdFreeSources (TRDP_FLAGS_MULTI_SRC)
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
  *      BL 2014-07-14: Ticket #46: Protocol change: operational topocount needed
  *                     Ticket #47: Protocol change: no FCS for data part of telegrams
@@ -78,6 +79,18 @@ TRDP_ERR_T trdp_pdGet (
     const UINT8         *pData,
     UINT32              *pDataSize);
 
+TRDP_ERR_T trdp_pdGetSource (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement,
+    UINT32          index,
+    TRDP_IP_ADDR_T  srcIpAddr,
+    TRDP_PD_INFO_T  *pPdInfo,
+    UINT8           *pData,
+    UINT32          *pDataSize);
+
+void        trdp_pdFreeSources (
+    PD_ELE_T *pElement);
+
 TRDP_ERR_T  trdp_pdSendQueued (
     TRDP_SESSION_PT appHandle);
 
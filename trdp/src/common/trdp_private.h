@@ -16,6 +16,16 @@
  *      
  * $Id$
  *
+ *      AG 2026-10-18: TRDP_PD_SRC_LIST_T: time out list of the senders (firstDue/lastDue)
+ *      AG 2026-10-18: Per sender data of multi source subscriptions (TRDP_PD_SRC_LIST_T)
+ *      AG 2026-10-18: Sequence counter list is an open addressing hash table keyed by (srcIpAddr, msgType)
+ *      AG 2026-10-18: Shared memory statistics export per session
+ *      AG 2026-10-18: Session statistics on cache lines of their own, join counter per socket pool
+ *      AG 2026-10-18: PD scheduling on the nanosecond time base (VOS_TIME_NS_T), cached time per process pass
+ *      AG 2026-10-18: PD timing histograms per PD_ELE_T (TRDP_OPTION_PD_TIMING)
+ *      AG 2026-10-18: Doubly linked PD/MD queues (pPrev)
+ *      AG 2026-10-18: Duplicate detection table for received MD requests
+ *      AG 2026-10-18: Per connection TCP MD receive buffer (stream reassembly) replaces uncompletedTCP[]
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
  *      BL 2017-11-28: Ticket #180 Filtering rules for DestinationURI does not follow the standard
  *      BL 2017-11-17: superfluous session->redID replaced by sndQueue->redId
@@ -40,6 +50,7 @@
 #include "trdp_types.h"
 #include "vos_thread.h"
 #include "vos_sock.h"
+#include "vos_shared_mem.h"
 
 
 /***********************************************************************************************************************
@@ -61,7 +72,10 @@
 #define TRDP_MAGIC_PUB_HNDL_VALUE           0xCAFEBABEu
 #define TRDP_MAGIC_SUB_HNDL_VALUE           0xBABECAFEu
 
-#define TRDP_SEQ_CNT_START_ARRAY_SIZE       64u                           /**< This should be enough for the start    */
+#define TRDP_SEQ_CNT_MIN_ARRAY_SIZE         8u                            /**< Slots at start (fixed source)          */
+#define TRDP_PD_MAX_NUM_SOURCES             1024u                         /**< Default for pdDefault.maxNumSources    */
+#define TRDP_PD_MAX_NUM_SOURCES_LIMIT       16384u                        /**< Upper limit (UINT16 table size), see
+                                                                               trdp_maxNumSources for the memory one */
 
 #define TRDP_IF_WAIT_FOR_READY              120u    /**< 120 seconds (120 tries each second to bind to an IP address) */
 
@@ -103,6 +117,7 @@ typedef enum
 #define TRDP_PULL_SUB           0x10u       /**< if set, its a PULL subscription                        */
 #define TRDP_REDUNDANT          0x20u       /**< if set, packet should not be sent (redundant)          */
 #define TRDP_CHECK_COMID        0x40u       /**< if set, do filter comId (addListener)                  */
+#define TRDP_SRC_OVERFLOW       0x80u       /**< if set, senders beyond maxNumSources have been reported */
 
 typedef UINT8   TRDP_PRIV_FLAGS_T;
 
@@ -131,14 +146,17 @@ typedef struct
 {
     UINT32          lastSeqCnt;                         /**< Sequence counter value for comId           */
     TRDP_IP_ADDR_T  srcIpAddr;                          /**< Source IP address                          */
-    TRDP_MSG_T      msgType;                            /**< message type                               */
+    TRDP_MSG_T      msgType;                            /**< message type, 0 if the slot is free        */
+    UINT16          srcIdx;                             /**< TRDP_FLAGS_MULTI_SRC: index into the sender
+                                                             table + 1, 0 if not yet entered            */
 } TRDP_SEQ_CNT_ENTRY_T;
 
+/** Last received sequence counters of a subscription: open addressing hash table keyed by (srcIpAddr, msgType) */
 typedef struct
 {
-    UINT16                  maxNoOfEntries;             /**< Max. no of entries the seq[] can hold      */
-    UINT16                  curNoOfEntries;             /**< Current no of entries in array             */
-    TRDP_SEQ_CNT_ENTRY_T    seq[1];                     /**< list of used sequence no.                  */
+    UINT16                  maxNoOfEntries;             /**< Number of slots in seq[] (power of 2)      */
+    UINT16                  curNoOfEntries;             /**< Number of used slots, at most half of them */
+    TRDP_SEQ_CNT_ENTRY_T    seq[1];                     /**< hash table of sequence counters            */
 } TRDP_SEQ_CNT_LIST_T;
 
 /** TCP parameters    */
@@ -165,6 +183,7 @@ typedef struct TRDP_SOCKETS
     INT16               usage;                           /**< No. of current users of this socket         */
     TRDP_SOCKET_TCP_T   tcpParams;                       /**< Params used for TCP                         */
     TRDP_IP_ADDR_T      mcGroups[VOS_MAX_MULTICAST_CNT]; /**< List of multicast addresses for this socket */
+    UINT32              *pNumJoin;                       /**< Joins of the socket pool (session statistics) */
 } TRDP_SOCKETS_T;
 
 #if (defined (WIN32) || defined (WIN64))
@@ -212,6 +231,33 @@ typedef struct
     UINT8       data[TRDP_MAX_PD_DATA_SIZE];    /**< data ready to be sent or received (with CRCs)          */
 } GNU_PACKED PD_PACKET_T;
 
+/** Latest data of one sender of a multi source subscription (TRDP_FLAGS_MULTI_SRC)   */
+typedef struct
+{
+    TRDP_IP_ADDR_T      srcIpAddr;                  /**< source IP address of the sender                        */
+    TRDP_IP_ADDR_T      destIpAddr;                 /**< destination of its last packet (own IP or MC group)    */
+    VOS_TIME_NS_T       timeToGo;                   /**< time out of this sender (ns), 0 if none                */
+    UINT32              numRecv;                    /**< packets received from this sender                      */
+    UINT32              frameSize;                  /**< size of the pFrame buffer                              */
+    BOOL8               timedOut;                   /**< time out reported, not received since                  */
+    UINT32              prevDue;                    /**< previous sender in the time out list (index + 1), 0: none */
+    UINT32              nextDue;                    /**< next sender in the time out list (index + 1), 0: none  */
+    PD_PACKET_T         *pFrame;                    /**< last packet of this sender (header, data)              */
+} TRDP_PD_SRC_T;
+
+/** Senders of a multi source subscription, in the order of their first packet.
+ *  The senders waiting for a packet are linked in the order of their time out as well: all senders time out after
+ *  the same interval, so a sender is moved to the tail of the list when a packet is stored.   */
+typedef struct
+{
+    UINT32              maxNoOfSrc;                 /**< number of entries src[] can hold                       */
+    UINT32              numSrc;                     /**< number of used entries                                 */
+    UINT32              firstDue;                   /**< sender timing out first (index + 1), 0: none           */
+    UINT32              lastDue;                    /**< sender timing out last (index + 1), 0: none            */
+    VOS_TIME_NS_T       nextTimeOut;                /**< time out of the first due sender (ns), 0 if none       */
+    TRDP_PD_SRC_T       src[1];                     /**< sender table, indexed by TRDP_SEQ_CNT_ENTRY_T.srcIdx   */
+} TRDP_PD_SRC_LIST_T;
+
 #if MD_SUPPORT
 /** TRDP MD packet    */
 typedef struct
@@ -225,10 +271,21 @@ typedef struct
 #pragma pack(pop)
 #endif
 
+/** PD timing instrumentation (TRDP_OPTION_PD_TIMING)    */
+typedef struct
+{
+    VOS_TIME_NS_T       lastArrival;            /**< receive time of the last packet (ns), 0 if none yet    */
+    TRDP_TIMING_HIST_T  sendLateness;           /**< delay of sending behind timeToGo                       */
+    TRDP_TIMING_HIST_T  interArrival;           /**< time between two received packets                      */
+    TRDP_TIMING_HIST_T  cbExecTime;             /**< runtime of pfCbFunction                                */
+} TRDP_PD_TIMING_T;
+
 /** Queue element for PD packets to send or receive    */
 typedef struct PD_ELE
 {
     struct PD_ELE       *pNext;                 /**< pointer to next element or NULL                        */
+    struct PD_ELE       *pPrev;                 /**< previous element, the last one for the first element,
+                                                     NULL if not queued                                     */
     UINT32              magic;                  /**< prevent acces through dangeling pointer                */
     TRDP_ADDRESSES_T    addr;                   /**< handle of publisher/subscriber                         */
     TRDP_IP_ADDR_T      lastSrcIP;              /**< last source IP a subscribed packet was received from   */
@@ -237,6 +294,7 @@ typedef struct PD_ELE
     UINT32              curSeqCnt;              /**< the last sent or received sequence counter             */
     UINT32              curSeqCnt4Pull;         /**< the last sent sequence counter for PULL                */
     TRDP_SEQ_CNT_LIST_T*pSeqCntList;            /**< pointer to list of received sequence numbers per comId */
+    TRDP_PD_SRC_LIST_T  *pSrcList;              /**< latest data per sender (TRDP_FLAGS_MULTI_SRC) or NULL  */
     UINT32              numRxTx;                /**< Counter for received packets (statistics)              */
     UINT32              updPkts;                /**< Counter for updated packets (statistics)               */
     UINT32              getPkts;                /**< Counter for read packets (statistics)                  */
@@ -244,9 +302,9 @@ typedef struct PD_ELE
     TRDP_ERR_T          lastErr;                /**< Last error (timeout)                                   */
     TRDP_PRIV_FLAGS_T   privFlags;              /**< private flags                                          */
     TRDP_FLAGS_T        pktFlags;               /**< flags                                                  */
-    TRDP_TIME_T         interval;               /**< time out value for received packets or
-                                                     interval for packets to send (set from ms)             */
-    TRDP_TIME_T         timeToGo;               /**< next time this packet must be sent/rcv                 */
+    VOS_TIME_NS_T       interval;               /**< time out value for received packets or
+                                                     interval for packets to send (ns), 0 if none           */
+    VOS_TIME_NS_T       timeToGo;               /**< next time this packet must be sent/rcv (ns)            */
     TRDP_TO_BEHAVIOR_T  toBehavior;             /**< timeout behavior for packets                           */
     UINT32              dataSize;               /**< net data size                                          */
     UINT32              grossSize;              /**< complete packet size (header, data)                    */
@@ -256,6 +314,7 @@ typedef struct PD_ELE
     const void          *pUserRef;              /**< from subscribe()                                       */
     TRDP_PD_CALLBACK_T  pfCbFunction;           /**< Pointer to PD callback function                        */
     PD_PACKET_T         *pFrame;                /**< header ... data + FCS...                               */
+    TRDP_PD_TIMING_T    timing;                 /**< timing histograms (statistics)                         */
 } PD_ELE_T, *TRDP_PUB_PT, *TRDP_SUB_PT;
 
 #if MD_SUPPORT
@@ -285,6 +344,8 @@ typedef struct TRDP_MD_TCP
 typedef struct MD_ELE
 {
     struct MD_ELE       *pNext;                 /**< pointer to next element or NULL                        */
+    struct MD_ELE       *pPrev;                 /**< previous element, the last one for the first element,
+                                                     NULL if not queued                                     */
     TRDP_ADDRESSES_T    addr;                   /**< handle of publisher/subscriber                         */
     UINT32              curSeqCnt;              /**< the last sent or received sequence counter             */
     TRDP_PRIV_FLAGS_T   privFlags;              /**< private flags                                          */
@@ -316,8 +377,31 @@ typedef struct MD_ELE
     TRDP_MD_CALLBACK_T  pfCbFunction;           /**< Pointer to MD callback function                        */
     MD_PACKET_T         *pPacket;               /**< Packet header in network byte order                    */
                                                 /**< data ready to be sent (with CRCs)                      */
+    const UINT8         *pSendData;             /**< caller's data sent in place (TRDP_FLAGS_NOCOPY), the
+                                                     packet holds the header only                           */
+    UINT8               *pAggrSet;              /**< collected replies (TRDP_FLAGS_AGGREGATE) or NULL       */
+    UINT32              aggrSize;               /**< allocated size of pAggrSet                             */
+    UINT32              aggrFill;               /**< used size of pAggrSet                                  */
 } MD_ELE_T;
 
+/** Duplicate detection of received MD requests: slot of an open addressing hash table keyed by sessionID   */
+typedef struct TRDP_MD_DUP_ENTRY
+{
+    MD_ELE_T    *pSession;                      /**< replier session, NULL if the slot is free              */
+    UINT8       sessionID[16u];                 /**< UUID of the session (hash key)                         */
+    UINT32      lastSeqCnt;                     /**< highest sequence counter received (host order)         */
+    UINT32      seqWindow;                      /**< bit n set: sequence counter lastSeqCnt - n received    */
+} TRDP_MD_DUP_ENTRY_T;
+
+/** Per connection receive buffer for the TCP MD byte stream    */
+typedef struct TRDP_TCP_RCV_BUF
+{
+    SOCKET  sock;                               /**< socket the buffered data was read from                 */
+    UINT32  size;                               /**< allocated size of pBuffer                              */
+    UINT32  fill;                               /**< number of valid bytes in pBuffer                       */
+    UINT8   *pBuffer;                           /**< stream data, always starting at a frame boundary       */
+} TRDP_TCP_RCV_BUF_T;
+
 /**    TCP file descriptor parameters   */
 typedef struct
 {
@@ -338,7 +422,8 @@ typedef struct TRDP_SESSION
     TRDP_IP_ADDR_T          virtualIP;          /**< Virtual IP address                                     */
     UINT32                  etbTopoCnt;         /**< current valid topocount or zero                        */
     UINT32                  opTrnTopoCnt;       /**< current valid topocount or zero                        */
-    TRDP_TIME_T             nextJob;            /**< Store for next select interval                         */
+    VOS_TIME_NS_T           nextJob;            /**< Store for next select interval (ns), 0 if none         */
+    VOS_TIME_NS_T           now;                /**< Time taken once per tlc_process pass (ns)              */
     TRDP_PRINT_DBG_T        pPrintDebugString;  /**< Pointer to function to print debug information         */
     TRDP_MARSHALL_CONFIG_T  marshall;           /**< Marshalling(unMarshalling configuration                */
     TRDP_PD_CONFIG_T        pdDefault;          /**< Default configuration for process data                 */
@@ -349,7 +434,13 @@ typedef struct TRDP_SESSION
     PD_ELE_T                *pRcvQueue;         /**< pointer to first element of rcv queue                  */
     PD_PACKET_T             *pNewFrame;         /**< pointer to received PD frame                           */
     TRDP_TIME_T             initTime;           /**< initialization time of session                         */
-    TRDP_STATISTICS_T       stats;              /**< statistics of this session                             */
+    UINT8                   statsPadHead[VOS_CACHE_LINE_SIZE];  /**< keep stats off the lines of other fields   */
+    TRDP_STATISTICS_T       stats;              /**< statistics of this session, counters are atomic        */
+    UINT8                   statsPadTail[VOS_CACHE_LINE_SIZE];  /**< keep stats off the lines of other fields   */
+    VOS_SHRD_T              statsExportHandle;  /**< shared memory of the statistics export, NULL if off    */
+    TRDP_STATS_EXPORT_T     *pStatsExport;      /**< mapped statistics export area, NULL if off             */
+    VOS_TIME_NS_T           statsExportInterval; /**< update interval of the statistics export (ns)         */
+    VOS_TIME_NS_T           statsExportNext;    /**< next update of the statistics export (ns)              */
 #if MD_SUPPORT
     struct TAU_TTDB         *pTTDB;             /**< session related TTDB data                              */
     void                    *pUser;             /**< space for higher layer data                            */
@@ -359,7 +450,11 @@ typedef struct TRDP_SESSION
     MD_ELE_T                *pMDSndQueue;       /**< pointer to first element of send MD queue (caller)     */
     MD_ELE_T                *pMDRcvQueue;       /**< pointer to first element of recv MD queue (replier)    */
     MD_ELE_T                *pMDRcvEle;         /**< pointer to received MD element                         */
-    MD_ELE_T                *uncompletedTCP[VOS_MAX_SOCKET_CNT];     /**< uncompleted TCP messages buffer   */
+    TRDP_TCP_RCV_BUF_T      tcpRcvBuf[VOS_MAX_SOCKET_CNT];  /**< TCP stream receive buffers per socket      */
+    TRDP_MD_DUP_ENTRY_T     *pMDDupTable;       /**< replier sessions by sessionID, for duplicate detection  */
+    UINT32                  mdDupTableSize;     /**< number of slots in pMDDupTable (power of 2)            */
+    UINT32                  mdDupCount;         /**< number of used slots in pMDDupTable                    */
+    UINT32                  numMDRcvSessions;   /**< number of replier sessions in pMDRcvQueue              */
 #endif
 } TRDP_SESSION_T, *TRDP_SESSION_PT;
 
@@ -16,6 +16,9 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Statistics export into shared memory (tlc_openStatisticsExport)
+ *      AG 2026-10-18: Lock-free statistics: atomic counters, aggregates maintained on change, no queue walks
+ *      AG 2026-10-18: PD timing histograms: trdp_timingAdd, tlc_getPdTimingStatistics, reset by tlc_resetStatistics
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
  *      BL 2017-11-17: superfluous session->redID replaced by sndQueue->redId
  *      BL 2017-05-22: Ticket #122: Addendum for 64Bit compatibility (VOS_TIME_T -> VOS_TIMEVAL_T)
@@ -40,6 +43,7 @@
 #include "trdp_pdcom.h"
 #include "vos_mem.h"
 #include "vos_thread.h"
+#include "vos_shared_mem.h"
 
 /*******************************************************************************
  * DEFINES
@@ -53,7 +57,43 @@
  *   Locals
  */
 
-void trdp_UpdateStats (TRDP_APP_SESSION_T appHandle);
+static void trdp_statsSnapshot (TRDP_APP_SESSION_T appHandle, TRDP_STATISTICS_T *pStatistics);
+
+/**********************************************************************************************************************/
+/** Read a block of statistics counters, each one atomically
+ *
+ *  @param[out]     pDst                destination
+ *  @param[in]      pSrc                first counter
+ *  @param[in]      size                size of the block in bytes (32 Bit counters only)
+ */
+static void trdp_statsLoad (
+    UINT32          *pDst,
+    UINT32          *pSrc,
+    UINT32          size)
+{
+    UINT32 i;
+
+    for (i = 0u; i < size / sizeof(UINT32); i++)
+    {
+        pDst[i] = VOS_ATOMIC_LOAD(&pSrc[i]);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Clear a range of statistics counters, each one atomically
+ *
+ *  @param[in,out]  pFirst              first counter
+ *  @param[in,out]  pLast               last counter (same structure)
+ */
+static void trdp_statsZero (
+    UINT32  *pFirst,
+    UINT32  *pLast)
+{
+    for (; pFirst <= pLast; pFirst++)
+    {
+        VOS_ATOMIC_STORE(pFirst, 0u);
+    }
+}
 
 /******************************************************************************
  *   Globals
@@ -91,8 +131,44 @@ void trdp_initStats (
     }
 }
 
+/**********************************************************************************************************************/
+/** Add a sample to a timing histogram.
+ *  The sample is the time from 'from' to 'to' in us, negative values count as 0.
+ *
+ *  @param[in,out]  pHist               pointer to the histogram
+ *  @param[in]      from                start time (ns)
+ *  @param[in]      to                  end time (ns)
+ */
+void trdp_timingAdd (
+    TRDP_TIMING_HIST_T  *pHist,
+    VOS_TIME_NS_T       from,
+    VOS_TIME_NS_T       to)
+{
+    UINT32  value = 0u;
+    UINT32  slot;
+
+    if (to > from)
+    {
+        value = (VOS_NS_TO_USEC(to - from) >= UINT32_MAX) ? UINT32_MAX : (UINT32) VOS_NS_TO_USEC(to - from);
+    }
+
+    /* slot n counts values below 2^n us */
+    for (slot = 0u; (slot < TRDP_TIMING_HIST_SIZE - 1u) && ((value >> slot) != 0u); slot++)
+    {
+        ;
+    }
+    pHist->hist[slot]++;
+    pHist->count++;
+    if (value > pHist->max)
+    {
+        pHist->max = value;
+    }
+}
+
 /**********************************************************************************************************************/
 /** Reset statistics.
+ *  Clears the event counters and the PD timing histograms. The numbers of subscriptions, publishers, joins and
+ *  listeners and the packets missed by the current subscriptions describe the current state and are kept.
  *
  *  @param[in]      appHandle           the handle returned by tlc_openSession
  *  @retval         TRDP_NO_ERR         no error
@@ -102,16 +178,26 @@ void trdp_initStats (
 EXT_DECL TRDP_ERR_T tlc_resetStatistics (
     TRDP_APP_SESSION_T appHandle)
 {
-    TIMEDATE32 tempTime;
+    PD_ELE_T    *iter;
 
     if (!trdp_isValidSession(appHandle))
     {
         return TRDP_NOINIT_ERR;
     }
 
-    tempTime = appHandle->stats.upTime;
-    memset(&appHandle->stats, 0, sizeof(TRDP_STATISTICS_T));
-    appHandle->stats.upTime = tempTime;
+    /*  Counters may be updated concurrently by tlc_process    */
+    trdp_statsZero(&appHandle->stats.pd.numRcv, &appHandle->stats.pd.numSend);
+    trdp_statsZero(&appHandle->stats.udpMd.numRcv, &appHandle->stats.udpMd.numSend);
+    trdp_statsZero(&appHandle->stats.tcpMd.numRcv, &appHandle->stats.tcpMd.numSend);
+
+    for (iter = appHandle->pSndQueue; iter != NULL; iter = iter->pNext)
+    {
+        memset(&iter->timing, 0, sizeof(TRDP_PD_TIMING_T));
+    }
+    for (iter = appHandle->pRcvQueue; iter != NULL; iter = iter->pNext)
+    {
+        memset(&iter->timing, 0, sizeof(TRDP_PD_TIMING_T));
+    }
 
     return TRDP_NO_ERR;
 }
@@ -119,6 +205,7 @@ EXT_DECL TRDP_ERR_T tlc_resetStatistics (
 /**********************************************************************************************************************/
 /** Return statistics.
  *  Memory for statistics information must be provided by the user.
+ *  The session is not locked: the counters are read atomically and the totals are kept up to date by the stack.
  *
  *  @param[in]      appHandle           the handle returned by tlc_openSession
  *  @param[out]     pStatistics         Pointer to statistics for this application session
@@ -139,9 +226,7 @@ EXT_DECL TRDP_ERR_T tlc_getStatistics (
         return TRDP_NOINIT_ERR;
     }
 
-    trdp_UpdateStats(appHandle);
-
-    *pStatistics = appHandle->stats;
+    trdp_statsSnapshot(appHandle, pStatistics);
 
     return TRDP_NO_ERR;
 }
@@ -185,7 +270,7 @@ EXT_DECL TRDP_ERR_T tlc_getSubsStatistics (
         pStatistics[lIndex].filterAddr  = iter->addr.srcIpAddr; /* Filter IP address           */
         pStatistics[lIndex].callBack    = (iter->pfCbFunction == NULL)? 0 : 1;      /* > 0 if call back function is used */
         pStatistics[lIndex].userRef     = (iter->pUserRef == NULL) ? 0 : 1;         /* > 0 if user reference if used  */
-        pStatistics[lIndex].timeout     = (UINT32) iter->interval.tv_usec + (UINT32) iter->interval.tv_sec * 1000000;
+        pStatistics[lIndex].timeout     = (UINT32) VOS_NS_TO_USEC(iter->interval);
         /* Time-out value in us. 0 = No time-out supervision  */
         pStatistics[lIndex].toBehav     = iter->toBehavior;     /* Behavior at time-out    */
         pStatistics[lIndex].numRecv     = iter->numRxTx;        /* Number of packets received for this subscription.  */
@@ -241,7 +326,7 @@ EXT_DECL TRDP_ERR_T tlc_getPubStatistics (
                                                                                         1 = Follower
                                                                                         0 = Leader                  */
 
-        pStatistics[lIndex].cycle = (UINT32) iter->interval.tv_usec + (UINT32)iter->interval.tv_sec * 1000000;
+        pStatistics[lIndex].cycle = (UINT32) VOS_NS_TO_USEC(iter->interval);
         /* Interval/cycle in us. 0 = No time-out supervision */
         pStatistics[lIndex].numSend = iter->numRxTx;            /* Number of packets sent for this publisher.       */
         pStatistics[lIndex].numPut  = iter->updPkts;            /* Updated packets (via put)                        */
@@ -254,6 +339,66 @@ EXT_DECL TRDP_ERR_T tlc_getPubStatistics (
     return err;
 }
 
+/**********************************************************************************************************************/
+/** Return PD timing statistics.
+ *  Memory for statistics information must be provided by the user. Publishers are returned first, then
+ *  subscribers. The histograms are only filled if the session was opened with TRDP_OPTION_PD_TIMING.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in,out]  pNumPd              In: The number of entries requested
+ *                                      Out: Number of entries returned
+ *  @param[out]     pStatistics         Pointer to an array with the timing statistics information
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        there are more publishers/subscribers than requested
+ */
+EXT_DECL TRDP_ERR_T tlc_getPdTimingStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    UINT16                      *pNumPd,
+    TRDP_PD_TIMING_STATISTICS_T *pStatistics)
+{
+    TRDP_ERR_T  err = TRDP_NO_ERR;
+    PD_ELE_T    *iter;
+    UINT16      lIndex;
+    UINT32      subscriber;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if ((pNumPd == NULL) || (pStatistics == NULL) || (*pNumPd == 0u))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /*  Loop over publishers, then subscribers, but do not exceed user supplied buffers!    */
+    lIndex = 0u;
+    for (subscriber = 0u; subscriber < 2u; subscriber++)
+    {
+        for (iter = (subscriber == 0u) ? appHandle->pSndQueue : appHandle->pRcvQueue;
+             (lIndex < *pNumPd) && (iter != NULL);
+             lIndex++, iter = iter->pNext)
+        {
+            pStatistics[lIndex].comId           = iter->addr.comId;
+            pStatistics[lIndex].srcAddr         = iter->addr.srcIpAddr;
+            pStatistics[lIndex].destAddr        = iter->addr.destIpAddr;
+            pStatistics[lIndex].subscriber      = subscriber;
+            pStatistics[lIndex].interval        = (UINT32) VOS_NS_TO_USEC(iter->interval);
+            pStatistics[lIndex].sendLateness    = iter->timing.sendLateness;
+            pStatistics[lIndex].interArrival    = iter->timing.interArrival;
+            pStatistics[lIndex].cbExecTime      = iter->timing.cbExecTime;
+        }
+        if (iter != NULL)
+        {
+            err = TRDP_MEM_ERR;
+        }
+    }
+    *pNumPd = lIndex;
+    return err;
+}
+
 #if MD_SUPPORT
 /**********************************************************************************************************************/
 /** Return UDP MD listener statistics.
@@ -446,19 +591,164 @@ EXT_DECL TRDP_ERR_T tlc_getJoinStatistics (
 }
 
 /**********************************************************************************************************************/
-/** Update the statistics
+/** Export statistics into shared memory.
+ *  The area is created (or attached, if it exists) with room for the header and the subscription and publisher
+ *  tables and is filled for the first time before returning.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pKey                name of the shared memory area
+ *  @param[in]      maxSubs             number of subscriptions to reserve space for
+ *  @param[in]      maxPub              number of publishers to reserve space for
+ *  @param[in]      interval            update interval in us, 0 = on every tlc_process call
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error or export already open
+ *  @retval         TRDP_MEM_ERR        shared memory not available
+ */
+EXT_DECL TRDP_ERR_T tlc_openStatisticsExport (
+    TRDP_APP_SESSION_T  appHandle,
+    const CHAR8         *pKey,
+    UINT16              maxSubs,
+    UINT16              maxPub,
+    UINT32              interval)
+{
+    TRDP_ERR_T          ret;
+    TRDP_STATS_EXPORT_T *pExport    = NULL;
+    VOS_SHRD_T          handle      = NULL;
+    UINT32              subsOffset  = sizeof(TRDP_STATS_EXPORT_T);
+    UINT32              pubOffset   = subsOffset + maxSubs * sizeof(TRDP_SUBS_STATISTICS_T);
+    UINT32              size        = pubOffset + maxPub * sizeof(TRDP_PUB_STATISTICS_T);
+    UINT32              areaSize    = size;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    if (pKey == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutex);
+    if (ret != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "vos_mutexLock() failed (Err: %d)\n", ret);
+        return ret;
+    }
+
+    if (appHandle->pStatsExport != NULL)
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "tlc_openStatisticsExport: export already open\n");
+        ret = TRDP_PARAM_ERR;
+    }
+#ifdef ESP32
+    else
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "tlc_openStatisticsExport: no shared memory on this target\n");
+        ret = TRDP_MEM_ERR;
+    }
+#else
+    else if (vos_sharedOpen(pKey, &handle, (UINT8 * *) &pExport, &areaSize) != VOS_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "tlc_openStatisticsExport: cannot open shared memory %s\n", pKey);
+        ret = TRDP_MEM_ERR;
+    }
+    else if (areaSize < size)
+    {
+        /*  Attached to an existing, smaller area (e.g. left over by another configuration)  */
+        vos_printLog(VOS_LOG_ERROR, "tlc_openStatisticsExport: %s has %u bytes, %u needed\n", pKey, areaSize, size);
+        (void) vos_sharedClose(handle, (UINT8 *) pExport);
+        ret = TRDP_MEM_ERR;
+    }
+    else
+    {
+        /*  Readers check the magic, it is written last  */
+        VOS_ATOMIC_STORE(&pExport->magic, 0u);
+        VOS_ATOMIC_STORE(&pExport->sequence, 0u);
+        VOS_MEMORY_BARRIER();
+        pExport->version    = TRDP_STATS_EXPORT_VERSION;
+        pExport->size       = size;
+        pExport->interval   = interval;
+        pExport->maxSubs    = maxSubs;
+        pExport->maxPub     = maxPub;
+        pExport->numSubs    = 0u;
+        pExport->numPub     = 0u;
+        pExport->subsOffset = subsOffset;
+        pExport->pubOffset  = pubOffset;
+        pExport->truncated  = 0u;
+
+        appHandle->statsExportHandle    = handle;
+        appHandle->pStatsExport         = pExport;
+        appHandle->statsExportInterval  = VOS_NS_FROM_USEC(interval);
+        appHandle->statsExportNext      = 0u;
+        trdp_statsExport(appHandle);
+
+        VOS_MEMORY_BARRIER();
+        VOS_ATOMIC_STORE(&pExport->magic, TRDP_STATS_EXPORT_MAGIC);
+    }
+#endif
+
+    if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Stop the statistics export and release the shared memory area.
  *
  *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
  */
-void    trdp_UpdateStats (
+EXT_DECL TRDP_ERR_T tlc_closeStatisticsExport (
     TRDP_APP_SESSION_T appHandle)
 {
-    PD_ELE_T        *iter;
-    UINT16          lIndex, llIndex;
+    TRDP_ERR_T ret;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutex);
+    if (ret != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "vos_mutexLock() failed (Err: %d)\n", ret);
+        return ret;
+    }
+
+    trdp_statsExportClose(appHandle);
+
+    if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Take a consistent copy of the statistics without locking the session
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[out]     pStatistics         copy of the statistics
+ */
+static void trdp_statsSnapshot (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_STATISTICS_T   *pStatistics)
+{
     VOS_ERR_T       ret;
     VOS_TIMEVAL_T   temp, temp2;
     TIMEDATE32      diff;
 
+    /*  Identity and configuration are only written on open / configuration, the counters follow one by one  */
+    *pStatistics = appHandle->stats;
+    pStatistics->numJoin = VOS_ATOMIC_LOAD(&appHandle->stats.numJoin);
+    trdp_statsLoad((UINT32 *) &pStatistics->pd, (UINT32 *) &appHandle->stats.pd, sizeof(TRDP_PD_STATISTICS_T));
+    trdp_statsLoad((UINT32 *) &pStatistics->udpMd, (UINT32 *) &appHandle->stats.udpMd, sizeof(TRDP_MD_STATISTICS_T));
+    trdp_statsLoad((UINT32 *) &pStatistics->tcpMd, (UINT32 *) &appHandle->stats.tcpMd, sizeof(TRDP_MD_STATISTICS_T));
+
     /*  Get a new time stamp    */
     vos_getTime(&temp2);
 
@@ -468,56 +758,24 @@ void    trdp_UpdateStats (
     vos_subTime(&temp, &appHandle->initTime);
 
     /*  Compute statistics from old uptime and old statistics values by maintaining the offset */
-    diff = appHandle->stats.upTime - (TIMEDATE32) temp2.tv_sec;
-    appHandle->stats.upTime         = (TIMEDATE32) temp.tv_sec;         /* will never be up for more than 139 years! */
-    appHandle->stats.statisticTime  = (TIMEDATE32)temp.tv_sec - diff;  /* round down */
-
+    diff = VOS_ATOMIC_LOAD(&appHandle->stats.upTime) - (TIMEDATE32) temp2.tv_sec;
+    pStatistics->upTime         = (TIMEDATE32) temp.tv_sec;         /* will never be up for more than 139 years! */
+    pStatistics->statisticTime  = (TIMEDATE32)temp.tv_sec - diff;  /* round down */
+    VOS_ATOMIC_STORE(&appHandle->stats.upTime, pStatistics->upTime);
 
     /*  Update memory statsp    */
-    ret = vos_memCount(&appHandle->stats.mem.total,
-                       &appHandle->stats.mem.free,
-                       &appHandle->stats.mem.minFree,
-                       &appHandle->stats.mem.numAllocBlocks,
-                       &appHandle->stats.mem.numAllocErr,
-                       &appHandle->stats.mem.numFreeErr,
-                       appHandle->stats.mem.blockSize,
-                       appHandle->stats.mem.usedBlockSize);
+    ret = vos_memCount(&pStatistics->mem.total,
+                       &pStatistics->mem.free,
+                       &pStatistics->mem.minFree,
+                       &pStatistics->mem.numAllocBlocks,
+                       &pStatistics->mem.numAllocErr,
+                       &pStatistics->mem.numFreeErr,
+                       pStatistics->mem.blockSize,
+                       pStatistics->mem.usedBlockSize);
     if (ret != VOS_NO_ERR)
     {
         vos_printLog(VOS_LOG_ERROR, "vos_memCount() failed (Err: %d)\n", ret);
     }
-
-    appHandle->stats.pd.numMissed = 0u;
-
-    /*  Count our subscriptions */
-    for (lIndex = 0u, iter = appHandle->pRcvQueue; iter != NULL; lIndex++, iter = iter->pNext)
-    {
-        appHandle->stats.pd.numMissed += iter->numMissed;
-    }
-
-    appHandle->stats.pd.numSubs = lIndex;
-
-    /*  Count our publishers */
-    for (lIndex = 0u, iter = appHandle->pSndQueue; iter != NULL; lIndex++, iter = iter->pNext)
-    {
-        ;
-    }
-
-    appHandle->stats.pd.numPub = lIndex;
-
-    /*  Count our joins */
-    appHandle->stats.numJoin = 0u;
-    for (lIndex = 0u; lIndex < VOS_MAX_SOCKET_CNT; lIndex++)
-    {
-        for (llIndex = 0u; llIndex < VOS_MAX_MULTICAST_CNT; llIndex++)
-        {
-            if (appHandle->iface[lIndex].mcGroups[llIndex] != 0u)
-            {
-                appHandle->stats.numJoin++;
-            }
-        }
-    }
-
 }
 
 /**********************************************************************************************************************/
@@ -531,6 +789,7 @@ void    trdp_pdPrepareStats (
     PD_ELE_T            *pPacket)
 {
     TRDP_STATISTICS_T   *pData;
+    TRDP_STATISTICS_T   stats;
     unsigned int        i;
 
     if (pPacket == NULL || appHandle == NULL)
@@ -538,85 +797,159 @@ void    trdp_pdPrepareStats (
         return;
     }
 
-    trdp_UpdateStats(appHandle);
+    trdp_statsSnapshot(appHandle, &stats);
 
     /*  The statistics structure is naturally aligned - all 32 Bits, we can cast and just eventually swap the values! */
 
     pData = (TRDP_STATISTICS_T *) pPacket->pFrame->data;
 
     /*  Fill in the values  */
-    pData->version = vos_htonl(appHandle->stats.version);
-    pData->timeStamp.tv_sec     = (UINT32)vos_htonl((UINT32)appHandle->stats.timeStamp.tv_sec);
-    pData->timeStamp.tv_usec    = (INT32)vos_htonl((UINT32)appHandle->stats.timeStamp.tv_usec);
-    pData->upTime           = vos_htonl(appHandle->stats.upTime);
-    pData->statisticTime    = vos_htonl(appHandle->stats.statisticTime);
-    pData->ownIpAddr        = vos_htonl(appHandle->stats.ownIpAddr);
-    pData->leaderIpAddr     = vos_htonl(appHandle->stats.leaderIpAddr);
-    pData->processPrio      = vos_htonl(appHandle->stats.processPrio);
-    pData->processCycle     = vos_htonl(appHandle->stats.processCycle);
-    vos_strncpy(pData->hostName, appHandle->stats.hostName, TRDP_MAX_LABEL_LEN - 1);
-    vos_strncpy(pData->leaderName, appHandle->stats.leaderName, TRDP_MAX_LABEL_LEN - 1);
+    pData->version = vos_htonl(stats.version);
+    pData->timeStamp.tv_sec     = (UINT32)vos_htonl((UINT32)stats.timeStamp.tv_sec);
+    pData->timeStamp.tv_usec    = (INT32)vos_htonl((UINT32)stats.timeStamp.tv_usec);
+    pData->upTime           = vos_htonl(stats.upTime);
+    pData->statisticTime    = vos_htonl(stats.statisticTime);
+    pData->ownIpAddr        = vos_htonl(stats.ownIpAddr);
+    pData->leaderIpAddr     = vos_htonl(stats.leaderIpAddr);
+    pData->processPrio      = vos_htonl(stats.processPrio);
+    pData->processCycle     = vos_htonl(stats.processCycle);
+    vos_strncpy(pData->hostName, stats.hostName, TRDP_MAX_LABEL_LEN - 1);
+    vos_strncpy(pData->leaderName, stats.leaderName, TRDP_MAX_LABEL_LEN - 1);
 
     /*  Memory  */
-    pData->mem.total            = vos_htonl(appHandle->stats.mem.total);
-    pData->mem.free             = vos_htonl(appHandle->stats.mem.free);
-    pData->mem.minFree          = vos_htonl(appHandle->stats.mem.minFree);
-    pData->mem.numAllocBlocks   = vos_htonl(appHandle->stats.mem.numAllocBlocks);
-    pData->mem.numAllocErr      = vos_htonl(appHandle->stats.mem.numAllocErr);
-    pData->mem.numFreeErr       = vos_htonl(appHandle->stats.mem.numFreeErr);
+    pData->mem.total            = vos_htonl(stats.mem.total);
+    pData->mem.free             = vos_htonl(stats.mem.free);
+    pData->mem.minFree          = vos_htonl(stats.mem.minFree);
+    pData->mem.numAllocBlocks   = vos_htonl(stats.mem.numAllocBlocks);
+    pData->mem.numAllocErr      = vos_htonl(stats.mem.numAllocErr);
+    pData->mem.numFreeErr       = vos_htonl(stats.mem.numFreeErr);
 
     for (i = 0; i < VOS_MEM_NBLOCKSIZES; i++)
     {
-        pData->mem.blockSize[i]     = vos_htonl(appHandle->stats.mem.blockSize[i]);
-        pData->mem.usedBlockSize[i] = vos_htonl(appHandle->stats.mem.usedBlockSize[i]);
+        pData->mem.blockSize[i]     = vos_htonl(stats.mem.blockSize[i]);
+        pData->mem.usedBlockSize[i] = vos_htonl(stats.mem.usedBlockSize[i]);
     }
 
     /* Process data */
-    pData->pd.defQos        = vos_htonl(appHandle->stats.pd.defQos);
-    pData->pd.defTtl        = vos_htonl(appHandle->stats.pd.defTtl);
-    pData->pd.defTimeout    = vos_htonl(appHandle->stats.pd.defTimeout);
-    pData->pd.numSubs       = vos_htonl(appHandle->stats.pd.numSubs);
-    pData->pd.numPub        = vos_htonl(appHandle->stats.pd.numPub);
-    pData->pd.numRcv        = vos_htonl(appHandle->stats.pd.numRcv);
-    pData->pd.numCrcErr     = vos_htonl(appHandle->stats.pd.numCrcErr);
-    pData->pd.numProtErr    = vos_htonl(appHandle->stats.pd.numProtErr);
-    pData->pd.numTopoErr    = vos_htonl(appHandle->stats.pd.numTopoErr);
-    pData->pd.numNoSubs     = vos_htonl(appHandle->stats.pd.numNoSubs);
-    pData->pd.numNoPub      = vos_htonl(appHandle->stats.pd.numNoPub);
-    pData->pd.numTimeout    = vos_htonl(appHandle->stats.pd.numTimeout);
-    pData->pd.numSend       = vos_htonl(appHandle->stats.pd.numSend);
-    pData->pd.numMissed     = vos_htonl(appHandle->stats.pd.numMissed);
+    pData->pd.defQos        = vos_htonl(stats.pd.defQos);
+    pData->pd.defTtl        = vos_htonl(stats.pd.defTtl);
+    pData->pd.defTimeout    = vos_htonl(stats.pd.defTimeout);
+    pData->pd.numSubs       = vos_htonl(stats.pd.numSubs);
+    pData->pd.numPub        = vos_htonl(stats.pd.numPub);
+    pData->pd.numRcv        = vos_htonl(stats.pd.numRcv);
+    pData->pd.numCrcErr     = vos_htonl(stats.pd.numCrcErr);
+    pData->pd.numProtErr    = vos_htonl(stats.pd.numProtErr);
+    pData->pd.numTopoErr    = vos_htonl(stats.pd.numTopoErr);
+    pData->pd.numNoSubs     = vos_htonl(stats.pd.numNoSubs);
+    pData->pd.numNoPub      = vos_htonl(stats.pd.numNoPub);
+    pData->pd.numTimeout    = vos_htonl(stats.pd.numTimeout);
+    pData->pd.numSend       = vos_htonl(stats.pd.numSend);
+    pData->pd.numMissed     = vos_htonl(stats.pd.numMissed);
 
     /* Message data */
-    pData->udpMd.defQos = vos_htonl(appHandle->stats.udpMd.defQos);
-    pData->udpMd.defTtl = vos_htonl(appHandle->stats.udpMd.defTtl);
-    pData->udpMd.defReplyTimeout    = vos_htonl(appHandle->stats.udpMd.defReplyTimeout);
-    pData->udpMd.defConfirmTimeout  = vos_htonl(appHandle->stats.udpMd.defConfirmTimeout);
-    pData->udpMd.numList            = vos_htonl(appHandle->stats.udpMd.numList);
-    pData->udpMd.numRcv             = vos_htonl(appHandle->stats.udpMd.numRcv);
-    pData->udpMd.numCrcErr          = vos_htonl(appHandle->stats.udpMd.numCrcErr);
-    pData->udpMd.numProtErr         = vos_htonl(appHandle->stats.udpMd.numProtErr);
-    pData->udpMd.numTopoErr         = vos_htonl(appHandle->stats.udpMd.numTopoErr);
-    pData->udpMd.numNoListener      = vos_htonl(appHandle->stats.udpMd.numNoListener);
-    pData->udpMd.numReplyTimeout    = vos_htonl(appHandle->stats.udpMd.numReplyTimeout);
-    pData->udpMd.numConfirmTimeout  = vos_htonl(appHandle->stats.udpMd.numConfirmTimeout);
-    pData->udpMd.numSend            = vos_htonl(appHandle->stats.udpMd.numSend);
-
-    pData->tcpMd.defQos = vos_htonl(appHandle->stats.tcpMd.defQos);
-    pData->tcpMd.defTtl = vos_htonl(appHandle->stats.tcpMd.defTtl);
-    pData->tcpMd.defReplyTimeout    = vos_htonl(appHandle->stats.tcpMd.defReplyTimeout);
-    pData->tcpMd.defConfirmTimeout  = vos_htonl(appHandle->stats.tcpMd.defConfirmTimeout);
-    pData->tcpMd.numList            = vos_htonl(appHandle->stats.tcpMd.numList);
-    pData->tcpMd.numRcv             = vos_htonl(appHandle->stats.tcpMd.numRcv);
-    pData->tcpMd.numCrcErr          = vos_htonl(appHandle->stats.tcpMd.numCrcErr);
-    pData->tcpMd.numProtErr         = vos_htonl(appHandle->stats.tcpMd.numProtErr);
-    pData->tcpMd.numTopoErr         = vos_htonl(appHandle->stats.tcpMd.numTopoErr);
-    pData->tcpMd.numNoListener      = vos_htonl(appHandle->stats.tcpMd.numNoListener);
-    pData->tcpMd.numReplyTimeout    = vos_htonl(appHandle->stats.tcpMd.numReplyTimeout);
-    pData->tcpMd.numConfirmTimeout  = vos_htonl(appHandle->stats.tcpMd.numConfirmTimeout);
-    pData->tcpMd.numSend            = vos_htonl(appHandle->stats.tcpMd.numSend);
+    pData->udpMd.defQos = vos_htonl(stats.udpMd.defQos);
+    pData->udpMd.defTtl = vos_htonl(stats.udpMd.defTtl);
+    pData->udpMd.defReplyTimeout    = vos_htonl(stats.udpMd.defReplyTimeout);
+    pData->udpMd.defConfirmTimeout  = vos_htonl(stats.udpMd.defConfirmTimeout);
+    pData->udpMd.numList            = vos_htonl(stats.udpMd.numList);
+    pData->udpMd.numRcv             = vos_htonl(stats.udpMd.numRcv);
+    pData->udpMd.numCrcErr          = vos_htonl(stats.udpMd.numCrcErr);
+    pData->udpMd.numProtErr         = vos_htonl(stats.udpMd.numProtErr);
+    pData->udpMd.numTopoErr         = vos_htonl(stats.udpMd.numTopoErr);
+    pData->udpMd.numNoListener      = vos_htonl(stats.udpMd.numNoListener);
+    pData->udpMd.numReplyTimeout    = vos_htonl(stats.udpMd.numReplyTimeout);
+    pData->udpMd.numConfirmTimeout  = vos_htonl(stats.udpMd.numConfirmTimeout);
+    pData->udpMd.numSend            = vos_htonl(stats.udpMd.numSend);
+
+    pData->tcpMd.defQos = vos_htonl(stats.tcpMd.defQos);
+    pData->tcpMd.defTtl = vos_htonl(stats.tcpMd.defTtl);
+    pData->tcpMd.defReplyTimeout    = vos_htonl(stats.tcpMd.defReplyTimeout);
+    pData->tcpMd.defConfirmTimeout  = vos_htonl(stats.tcpMd.defConfirmTimeout);
+    pData->tcpMd.numList            = vos_htonl(stats.tcpMd.numList);
+    pData->tcpMd.numRcv             = vos_htonl(stats.tcpMd.numRcv);
+    pData->tcpMd.numCrcErr          = vos_htonl(stats.tcpMd.numCrcErr);
+    pData->tcpMd.numProtErr         = vos_htonl(stats.tcpMd.numProtErr);
+    pData->tcpMd.numTopoErr         = vos_htonl(stats.tcpMd.numTopoErr);
+    pData->tcpMd.numNoListener      = vos_htonl(stats.tcpMd.numNoListener);
+    pData->tcpMd.numReplyTimeout    = vos_htonl(stats.tcpMd.numReplyTimeout);
+    pData->tcpMd.numConfirmTimeout  = vos_htonl(stats.tcpMd.numConfirmTimeout);
+    pData->tcpMd.numSend            = vos_htonl(stats.tcpMd.numSend);
     pPacket->dataSize = sizeof(TRDP_STATISTICS_T);
 
     /* mark the data as valid */
     pPacket->privFlags = (TRDP_PRIV_FLAGS_T) (pPacket->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_INVALID_DATA);
 }
+
+/**********************************************************************************************************************/
+/** Update the shared memory statistics export, if it is due.
+ *  Called with the session locked. The sequence count is odd while the area is written, so readers in other
+ *  processes can detect and retry a torn copy.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ */
+void trdp_statsExport (
+    TRDP_APP_SESSION_T appHandle)
+{
+    TRDP_STATS_EXPORT_T *pExport = appHandle->pStatsExport;
+    TRDP_ERR_T          errSubs = TRDP_NO_ERR;
+    TRDP_ERR_T          errPub  = TRDP_NO_ERR;
+    UINT16              numSubs;
+    UINT16              numPub;
+    UINT32              seq;
+
+    if ((pExport == NULL) || (appHandle->now < appHandle->statsExportNext))
+    {
+        return;
+    }
+    appHandle->statsExportNext = appHandle->now + appHandle->statsExportInterval;
+
+    /*  We are the only writer  */
+    seq = pExport->sequence + 1u;
+    VOS_ATOMIC_STORE(&pExport->sequence, seq);
+    VOS_MEMORY_BARRIER();
+
+    trdp_statsSnapshot(appHandle, &pExport->statistics);
+
+    numSubs = (UINT16) pExport->maxSubs;
+    if (numSubs > 0u)
+    {
+        errSubs = tlc_getSubsStatistics(appHandle, &numSubs,
+                                        (TRDP_SUBS_STATISTICS_T *) ((UINT8 *) pExport + pExport->subsOffset));
+    }
+    numPub = (UINT16) pExport->maxPub;
+    if (numPub > 0u)
+    {
+        errPub = tlc_getPubStatistics(appHandle, &numPub,
+                                      (TRDP_PUB_STATISTICS_T *) ((UINT8 *) pExport + pExport->pubOffset));
+    }
+    pExport->numSubs    = numSubs;
+    pExport->numPub     = numPub;
+    pExport->truncated  = ((errSubs == TRDP_MEM_ERR) || (errPub == TRDP_MEM_ERR)) ? 1u : 0u;
+
+    VOS_MEMORY_BARRIER();
+    VOS_ATOMIC_STORE(&pExport->sequence, seq + 1u);
+}
+
+/**********************************************************************************************************************/
+/** Release the shared memory statistics export, the session must be locked
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ */
+void trdp_statsExportClose (
+    TRDP_APP_SESSION_T appHandle)
+{
+    if (appHandle->pStatsExport == NULL)
+    {
+        return;
+    }
+    /*  Tell attached readers that there will be no more updates  */
+    VOS_ATOMIC_STORE(&appHandle->pStatsExport->magic, 0u);
+#ifndef ESP32
+    if (vos_sharedClose(appHandle->statsExportHandle, (UINT8 *) appHandle->pStatsExport) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_WARNING, "vos_sharedClose() failed\n");
+    }
+#endif
+    appHandle->statsExportHandle    = NULL;
+    appHandle->pStatsExport         = NULL;
+}
@@ -16,6 +16,9 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: trdp_statsExport/trdp_statsExportClose for the shared memory statistics export
+ *      AG 2026-10-18: TRDP_STATS_ counter macros (atomic, read without the session mutex)
+ *      AG 2026-10-18: trdp_timingAdd for the PD timing histograms
  */
 
 
@@ -29,11 +32,18 @@
 #include "trdp_if_light.h"
 #include "trdp_private.h"
 #include "vos_utils.h"
+#include "vos_thread.h"
 
 /*******************************************************************************
  * DEFINES
  */
 
+/** Session statistics counters are atomic, tlc_getStatistics reads them without the session mutex  */
+#define TRDP_STATS_INC(cnt)         VOS_ATOMIC_ADD(&(cnt), 1u)
+#define TRDP_STATS_DEC(cnt)         VOS_ATOMIC_SUB(&(cnt), 1u)
+#define TRDP_STATS_ADD(cnt, val)    VOS_ATOMIC_ADD(&(cnt), (val))
+#define TRDP_STATS_SUB(cnt, val)    VOS_ATOMIC_SUB(&(cnt), (val))
+
 
 /*******************************************************************************
  * TYPEDEFS
@@ -46,6 +56,9 @@
 
 void    trdp_initStats(TRDP_APP_SESSION_T appHandle);
 void    trdp_pdPrepareStats (TRDP_APP_SESSION_T appHandle, PD_ELE_T *pPacket);
+void    trdp_timingAdd (TRDP_TIMING_HIST_T *pHist, VOS_TIME_NS_T from, VOS_TIME_NS_T to);
+void    trdp_statsExport (TRDP_APP_SESSION_T appHandle);
+void    trdp_statsExportClose (TRDP_APP_SESSION_T appHandle);
 
 
 #endif
@@ -0,0 +1,308 @@
+/******************************************************************************/
+/**
+ * @file            trdp_trace.c
+ *
+ * @brief           Hot path trace for TRDP communication
+ *
+ * @details         Every thread writing trace records claims one ring on its first record. Only this thread
+ *                  writes into the ring, so writing needs no lock: the record is filled in, then the head index
+ *                  is published with release semantics. A reader copies the records below the head and drops
+ *                  those the writer may have overwritten in the meantime.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          TCNOpen TRDP contributors
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen TRDP contributors, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+/*******************************************************************************
+ * INCLUDES
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "trdp_trace.h"
+#include "trdp_if_light.h"
+#include "vos_mem.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+#ifdef TRDP_TRACE
+
+#ifndef VOS_THREAD_LOCAL
+#error "TRDP_TRACE needs thread local storage (VOS_THREAD_LOCAL)"
+#endif
+
+#if (TRDP_TRACE_RING_SIZE & (TRDP_TRACE_RING_SIZE - 1u)) != 0
+#error "TRDP_TRACE_RING_SIZE must be a power of 2"
+#endif
+
+/*******************************************************************************
+ * DEFINES
+ */
+
+/*******************************************************************************
+ * TYPEDEFS
+ */
+
+/** Trace ring of one thread */
+typedef struct
+{
+    UINT32              head;                           /**< number of records written so far   */
+    UINT32              reserved;
+    TRDP_TRACE_REC_T    rec[TRDP_TRACE_RING_SIZE];      /**< records, index head & (size - 1)   */
+} TRDP_TRACE_RING_T;
+
+/******************************************************************************
+ *   Locals
+ */
+
+static TRDP_TRACE_RING_T                sTraceRing[TRDP_TRACE_MAX_THREADS];
+static UINT32                           sTraceNumRings  = 0u;   /**< rings claimed, may exceed the maximum */
+static UINT32                           sTraceLost      = 0u;   /**< records of threads without ring      */
+static VOS_THREAD_LOCAL TRDP_TRACE_RING_T   *spTraceRing = NULL;    /**< ring of this thread               */
+
+/**********************************************************************************************************************/
+/** Number of records of a ring that can be read: the slot of the oldest record of a full ring may be in the course
+ *  of being overwritten, so it is not counted
+ *
+ *  @param[in]      head                number of records written so far
+ *
+ *  @retval         number of readable records
+ */
+static UINT32 trdp_traceReadable (
+    UINT32 head)
+{
+    return (head >= TRDP_TRACE_RING_SIZE) ? TRDP_TRACE_RING_SIZE - 1u : head;
+}
+
+/**********************************************************************************************************************/
+/** Copy the valid records of one ring
+ *
+ *  @param[in]      ringNo              number of the ring
+ *  @param[out]     pDst                destination
+ *  @param[in]      maxRecords          size of the destination
+ *
+ *  @retval         number of records copied
+ */
+static UINT32 trdp_traceCopyRing (
+    UINT32              ringNo,
+    TRDP_TRACE_REC_T    *pDst,
+    UINT32              maxRecords)
+{
+    TRDP_TRACE_RING_T   *pRing  = &sTraceRing[ringNo];
+    UINT32              head    = VOS_ATOMIC_LOAD_ACQUIRE(&pRing->head);
+    UINT32              first   = head - trdp_traceReadable(head);
+    UINT32              valid;
+    UINT32              count;
+    UINT32              i;
+
+    if ((head - first) > maxRecords)
+    {
+        first = head - maxRecords;                      /* the newest ones */
+    }
+    for (i = first; i != head; i++)
+    {
+        pDst[i - first] = pRing->rec[i & (TRDP_TRACE_RING_SIZE - 1u)];
+    }
+
+    /*  The writer may have overtaken us: the record at index n is overwritten by record n + size    */
+    VOS_MEMORY_BARRIER();
+    head    = VOS_ATOMIC_LOAD_ACQUIRE(&pRing->head);
+    valid   = (head >= TRDP_TRACE_RING_SIZE) ? head - TRDP_TRACE_RING_SIZE + 1u : 0u;
+    count   = i - first;
+    if (valid > first)
+    {
+        UINT32 skip = (valid - first < count) ? valid - first : count;
+        count -= skip;
+        memmove(pDst, pDst + skip, count * sizeof(TRDP_TRACE_REC_T));
+    }
+    for (i = 0u; i < count; i++)
+    {
+        pDst[i].thread = ringNo + 1u;
+    }
+    return count;
+}
+
+/******************************************************************************
+ *   Globals
+ */
+
+/**********************************************************************************************************************/
+/** Write one trace record into the ring of the calling thread
+ *
+ *  @param[in]      session             own IP address of the session
+ *  @param[in]      event               TRDP_TRACE_EVENT_T
+ *  @param[in]      comId               ComId or 0
+ *  @param[in]      seqCnt              sequence counter or 0
+ *  @param[in]      info                event specific value
+ *  @param[in]      time                time of the event or start of the span
+ *  @param[in]      duration            duration of the span in ns, 0 for an instant event
+ */
+void trdp_traceWrite (
+    UINT32              session,
+    TRDP_TRACE_EVENT_T  event,
+    UINT32              comId,
+    UINT32              seqCnt,
+    UINT32              info,
+    VOS_TIME_NS_T       time,
+    VOS_TIME_NS_T       duration)
+{
+    TRDP_TRACE_RING_T   *pRing = spTraceRing;
+    TRDP_TRACE_REC_T    *pRec;
+    UINT32              head;
+
+    if (pRing == NULL)
+    {
+        UINT32 ringNo = VOS_ATOMIC_FETCH_ADD(&sTraceNumRings, 1u);
+        if (ringNo >= TRDP_TRACE_MAX_THREADS)
+        {
+            VOS_ATOMIC_ADD(&sTraceLost, 1u);
+            return;
+        }
+        pRing       = &sTraceRing[ringNo];
+        spTraceRing = pRing;
+    }
+
+    head    = pRing->head;
+    pRec    = &pRing->rec[head & (TRDP_TRACE_RING_SIZE - 1u)];
+
+    pRec->time      = time;
+    pRec->duration  = (duration > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (UINT32) duration;
+    pRec->comId     = comId;
+    pRec->seqCnt    = seqCnt;
+    pRec->session   = session;
+    pRec->event     = (UINT16) event;
+    pRec->info      = (UINT16) info;
+    pRec->thread    = 0u;                               /* filled in by the reader */
+
+    VOS_ATOMIC_STORE_RELEASE(&pRing->head, head + 1u);
+}
+
+/**********************************************************************************************************************/
+/** Return the records of the hot path trace.
+ *
+ *  @param[out]     pRecords            Pointer to an array for the records
+ *  @param[in,out]  pNumRecords         In: The number of records requested
+ *                                      Out: Number of records returned
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        there are more records than requested
+ */
+EXT_DECL TRDP_ERR_T tlc_getTrace (
+    TRDP_TRACE_REC_T    *pRecords,
+    UINT32              *pNumRecords)
+{
+    UINT32  numRings;
+    UINT32  count = 0u;
+    UINT32  ringNo;
+    UINT32  total = 0u;
+    UINT32  head;
+
+    if ((pRecords == NULL) || (pNumRecords == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    numRings = VOS_ATOMIC_LOAD_ACQUIRE(&sTraceNumRings);
+    if (numRings > TRDP_TRACE_MAX_THREADS)
+    {
+        numRings = TRDP_TRACE_MAX_THREADS;
+    }
+    for (ringNo = 0u; ringNo < numRings; ringNo++)
+    {
+        head    = VOS_ATOMIC_LOAD(&sTraceRing[ringNo].head);
+        total   += trdp_traceReadable(head);
+        count   += trdp_traceCopyRing(ringNo, pRecords + count, *pNumRecords - count);
+    }
+    *pNumRecords = count;
+    return (total > count) ? TRDP_MEM_ERR : TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Write the records of the hot path trace into a file.
+ *
+ *  @param[in]      pFileName           name of the file to write
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        out of memory
+ *  @retval         TRDP_IO_ERR         file could not be written
+ */
+EXT_DECL TRDP_ERR_T tlc_dumpTrace (
+    const CHAR8 *pFileName)
+{
+    TRDP_TRACE_FILE_T   header;
+    TRDP_TRACE_REC_T    *pBuffer;
+    FILE                *pFile;
+    UINT32              numRings;
+    UINT32              ringNo;
+    UINT32              count;
+    TRDP_ERR_T          err = TRDP_NO_ERR;
+
+    if (pFileName == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    pBuffer = (TRDP_TRACE_REC_T *) vos_memAlloc(TRDP_TRACE_RING_SIZE * sizeof(TRDP_TRACE_REC_T));
+    if (pBuffer == NULL)
+    {
+        return TRDP_MEM_ERR;
+    }
+    pFile = fopen(pFileName, "wb");
+    if (pFile == NULL)
+    {
+        vos_printLog(VOS_LOG_ERROR, "tlc_dumpTrace: cannot open %s\n", pFileName);
+        vos_memFree(pBuffer);
+        return TRDP_IO_ERR;
+    }
+
+    memset(&header, 0, sizeof(header));
+    header.magic        = TRDP_TRACE_FILE_MAGIC;
+    header.version      = TRDP_TRACE_FILE_VERSION;
+    header.recordSize   = sizeof(TRDP_TRACE_REC_T);
+    header.numLost      = VOS_ATOMIC_LOAD(&sTraceLost);
+    if (fwrite(&header, sizeof(header), 1u, pFile) != 1u)
+    {
+        err = TRDP_IO_ERR;
+    }
+
+    numRings = VOS_ATOMIC_LOAD_ACQUIRE(&sTraceNumRings);
+    if (numRings > TRDP_TRACE_MAX_THREADS)
+    {
+        numRings = TRDP_TRACE_MAX_THREADS;
+    }
+    for (ringNo = 0u; (ringNo < numRings) && (err == TRDP_NO_ERR); ringNo++)
+    {
+        count = trdp_traceCopyRing(ringNo, pBuffer, TRDP_TRACE_RING_SIZE);
+        if ((count > 0u) && (fwrite(pBuffer, sizeof(TRDP_TRACE_REC_T), count, pFile) != count))
+        {
+            err = TRDP_IO_ERR;
+        }
+        header.numRecords += count;
+    }
+
+    /*  Now the number of records is known  */
+    if ((err == TRDP_NO_ERR)
+        && ((fseek(pFile, 0L, SEEK_SET) != 0) || (fwrite(&header, sizeof(header), 1u, pFile) != 1u)))
+    {
+        err = TRDP_IO_ERR;
+    }
+    if ((fclose(pFile) != 0) || (err != TRDP_NO_ERR))
+    {
+        vos_printLog(VOS_LOG_ERROR, "tlc_dumpTrace: cannot write %s\n", pFileName);
+        err = TRDP_IO_ERR;
+    }
+    vos_memFree(pBuffer);
+    return err;
+}
+
+#endif
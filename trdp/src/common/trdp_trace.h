@@ -0,0 +1,75 @@
+/******************************************************************************/
+/**
+ * @file            trdp_trace.h
+ *
+ * @brief           Hot path trace for TRDP communication
+ *
+ * @details         Binary trace records written into one lock-free ring per thread. Compiled in with
+ *                  TRDP_TRACE only, otherwise all macros expand to nothing.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          TCNOpen TRDP contributors
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen TRDP contributors, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+
+#ifndef TRDP_TRACE_H
+#define TRDP_TRACE_H
+
+/*******************************************************************************
+ * INCLUDES
+ */
+
+#include "trdp_types.h"
+#include "vos_thread.h"
+
+/*******************************************************************************
+ * DEFINES
+ */
+
+#ifdef TRDP_TRACE
+
+#ifndef TRDP_TRACE_RING_SIZE
+#define TRDP_TRACE_RING_SIZE        2048u       /**< records per thread, must be a power of 2 */
+#endif
+#ifndef TRDP_TRACE_MAX_THREADS
+#define TRDP_TRACE_MAX_THREADS      16u         /**< threads with a ring, later threads are not traced */
+#endif
+
+/** Declare the start time of a span (with the semicolon, place it behind the local declarations) */
+#define TRDP_TRACE_DECL(start)                  VOS_TIME_NS_T start = 0u;
+/** Take the start time of a span */
+#define TRDP_TRACE_START(start)                 ((start) = vos_getTimeNs())
+/** Record an instant event */
+#define TRDP_TRACE_EVENT(appHandle, event, comId, seqCnt, info) \
+    trdp_traceWrite((appHandle)->realIP, (event), (comId), (seqCnt), (info), vos_getTimeNs(), 0u)
+/** Record a span from start until now */
+#define TRDP_TRACE_SPAN(appHandle, event, comId, seqCnt, info, start) \
+    trdp_traceWrite((appHandle)->realIP, (event), (comId), (seqCnt), (info), (start), vos_getTimeNs() - (start))
+
+#else
+
+#define TRDP_TRACE_DECL(start)
+#define TRDP_TRACE_START(start)                 ((void) 0)
+#define TRDP_TRACE_EVENT(appHandle, event, comId, seqCnt, info)         ((void) 0)
+#define TRDP_TRACE_SPAN(appHandle, event, comId, seqCnt, info, start)   ((void) 0)
+
+#endif
+
+/*******************************************************************************
+ * GLOBAL FUNCTIONS
+ */
+
+#ifdef TRDP_TRACE
+void    trdp_traceWrite (UINT32 session, TRDP_TRACE_EVENT_T event, UINT32 comId, UINT32 seqCnt, UINT32 info,
+                         VOS_TIME_NS_T time, VOS_TIME_NS_T duration);
+#endif
+
+#endif
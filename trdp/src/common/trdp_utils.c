@@ -16,6 +16,16 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: trdp_maxNumSources: the sender table of multi source subscriptions must fit as well
+ *      AG 2026-10-18: trdp_findSequenceCounter
+ *      AG 2026-10-18: trdp_maxNumSources: sender tables must fit the largest memory block
+ *      AG 2026-10-18: Senders beyond maxNumSources ignored (counted as missed), table sized from maxNumSources
+ *      AG 2026-10-18: Sequence counters in an open addressing hash table bound by pdDefault.maxNumSources
+ *      AG 2026-10-18: O(1) append and removal for PD/MD queues
+ *      AG 2026-10-18: Joined multicast groups counted in the session statistics while joining/leaving
+ *      AG 2026-10-18: Temporary comId index of PD queues for bulk configuration
+ *      AG 2026-10-18: Outgoing TCP MD connections shared by all sessions to the same corner (pipelining)
+ *      AG 2026-10-18: TCP MD receive: per connection stream buffer, several frames per read
  *      BL 2018-11-06: for-loops limited to sCurrentMaxSocketCnt instead VOS_MAX_SOCKET_CNT
  *      BL 2018-11-06: Ticket #219: PD Sequence Counter is not synched correctly
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
@@ -44,6 +54,7 @@
 
 #include "trdp_if.h"
 #include "trdp_utils.h"
+#include "trdp_stats.h"
 
 /***********************************************************************************************************************
  * DEFINES
@@ -64,10 +75,11 @@ static INT32 sCurrentMaxSocketCnt = 0;
 static void     printSocketUsage (TRDP_SOCKETS_T iface[]);
 static BOOL8    trdp_SockIsJoined (const TRDP_IP_ADDR_T mcList[VOS_MAX_MULTICAST_CNT],
                                    TRDP_IP_ADDR_T       mcGroup);
-static BOOL8    trdp_SockAddJoin (TRDP_IP_ADDR_T    mcList[VOS_MAX_MULTICAST_CNT],
+static BOOL8    trdp_SockAddJoin (TRDP_SOCKETS_T    *pSocket,
                                   TRDP_IP_ADDR_T    mcGroup);
-static BOOL8    trdp_SockDelJoin (TRDP_IP_ADDR_T    mcList[VOS_MAX_MULTICAST_CNT],
+static BOOL8    trdp_SockDelJoin (TRDP_SOCKETS_T    *pSocket,
                                   TRDP_IP_ADDR_T    mcGroup);
+static void     trdp_SockClearJoins (TRDP_SOCKETS_T *pSocket);
 
 /**********************************************************************************************************************/
 /** Debug socket usage output
@@ -123,23 +135,27 @@ static BOOL8 trdp_SockIsJoined (
 /**********************************************************************************************************************/
 /** Add mc group to the list
  *
- *  @param[in]      mcList          List of multicast groups
+ *  @param[in,out]  pSocket         socket with the list of multicast groups
  *  @param[in]      mcGroup         multicast group
  *
  *  @retval         1           if added
  *                  0           if list is full
  */
 static BOOL8 trdp_SockAddJoin (
-    TRDP_IP_ADDR_T  mcList[VOS_MAX_MULTICAST_CNT],
+    TRDP_SOCKETS_T  *pSocket,
     TRDP_IP_ADDR_T  mcGroup)
 {
     int i = 0;
 
     for (i = 0; i < VOS_MAX_MULTICAST_CNT; i++)
     {
-        if (0 == mcList[i] || mcGroup == mcList[i])
+        if (0 == pSocket->mcGroups[i] || mcGroup == pSocket->mcGroups[i])
         {
-            mcList[i] = mcGroup;
+            if (0 == pSocket->mcGroups[i])
+            {
+                TRDP_STATS_INC(*pSocket->pNumJoin);
+            }
+            pSocket->mcGroups[i] = mcGroup;
             return TRUE;
         }
     }
@@ -150,23 +166,24 @@ static BOOL8 trdp_SockAddJoin (
 /**********************************************************************************************************************/
 /** remove mc group from the list
  *
- *  @param[in]      mcList        List of multicast groups
+ *  @param[in,out]  pSocket         socket with the list of multicast groups
  *  @param[in]      mcGroup         multicast group
  *
  *  @retval         1           if deleted
  *                  0           was not in list
  */
 static BOOL8 trdp_SockDelJoin (
-    TRDP_IP_ADDR_T  mcList[VOS_MAX_MULTICAST_CNT],
+    TRDP_SOCKETS_T  *pSocket,
     TRDP_IP_ADDR_T  mcGroup)
 {
     int i = 0;
 
     for (i = 0; i < VOS_MAX_MULTICAST_CNT; i++)
     {
-        if (mcGroup == mcList[i])
+        if (mcGroup == pSocket->mcGroups[i])
         {
-            mcList[i] = 0;
+            pSocket->mcGroups[i] = 0;
+            TRDP_STATS_DEC(*pSocket->pNumJoin);
             return TRUE;
         }
     }
@@ -174,6 +191,26 @@ static BOOL8 trdp_SockDelJoin (
     return FALSE;
 }
 
+/**********************************************************************************************************************/
+/** clear the list of mc groups (socket closed or reused)
+ *
+ *  @param[in,out]  pSocket         socket with the list of multicast groups
+ */
+static void trdp_SockClearJoins (
+    TRDP_SOCKETS_T *pSocket)
+{
+    int i = 0;
+
+    for (i = 0; i < VOS_MAX_MULTICAST_CNT; i++)
+    {
+        if (0 != pSocket->mcGroups[i])
+        {
+            pSocket->mcGroups[i] = 0;
+            TRDP_STATS_DEC(*pSocket->pNumJoin);
+        }
+    }
+}
+
 
 /***********************************************************************************************************************
  *   Globals
@@ -392,6 +429,7 @@ PD_ELE_T *trdp_queueFindSubAddr (
 
 /**********************************************************************************************************************/
 /** Delete an element
+ *  Elements not queued are ignored. The pNext pointer of the removed element is left untouched.
  *
  *  @param[in]      ppHead          pointer to pointer to head of queue
  *  @param[in]      pDelete         pointer to element to delete
@@ -400,28 +438,34 @@ void    trdp_queueDelElement (
     PD_ELE_T    * *ppHead,
     PD_ELE_T    *pDelete)
 {
-    PD_ELE_T *iterPD;
-
-    if (ppHead == NULL || *ppHead == NULL || pDelete == NULL)
+    if (ppHead == NULL || *ppHead == NULL || pDelete == NULL || pDelete->pPrev == NULL)
     {
         return;
     }
 
-    /* handle removal of first element */
     if (pDelete == *ppHead)
     {
+        /*  handle removal of first element, its predecessor is the last element */
         *ppHead = pDelete->pNext;
-        return;
+        if (*ppHead != NULL)
+        {
+            (*ppHead)->pPrev = pDelete->pPrev;
+        }
     }
-
-    for (iterPD = *ppHead; iterPD != NULL; iterPD = iterPD->pNext)
+    else
     {
-        if (iterPD->pNext && iterPD->pNext == pDelete)
+        pDelete->pPrev->pNext = pDelete->pNext;
+        if (pDelete->pNext != NULL)
+        {
+            pDelete->pNext->pPrev = pDelete->pPrev;
+        }
+        else
         {
-            iterPD->pNext = pDelete->pNext;
-            return;
+            /*  removal of last element */
+            (*ppHead)->pPrev = pDelete->pPrev;
         }
     }
+    pDelete->pPrev = NULL;
 }
 
 
@@ -497,6 +541,7 @@ MD_ELE_T *trdp_MDqueueFindAddr (
 
 /**********************************************************************************************************************/
 /** Delete an element from MD queue
+ *  Elements not queued are ignored. The pNext pointer of the removed element is left untouched.
  *
  *  @param[in]      ppHead          pointer to pointer to head of queue
  *  @param[in]      pDelete         pointer to element to delete
@@ -505,28 +550,34 @@ void    trdp_MDqueueDelElement (
     MD_ELE_T    * *ppHead,
     MD_ELE_T    *pDelete)
 {
-    MD_ELE_T *iterMD;
-
-    if (ppHead == NULL || *ppHead == NULL || pDelete == NULL)
+    if (ppHead == NULL || *ppHead == NULL || pDelete == NULL || pDelete->pPrev == NULL)
     {
         return;
     }
 
-    /*    handle removal of first element    */
     if (pDelete == *ppHead)
     {
+        /*  handle removal of first element, its predecessor is the last element */
         *ppHead = pDelete->pNext;
-        return;
+        if (*ppHead != NULL)
+        {
+            (*ppHead)->pPrev = pDelete->pPrev;
+        }
     }
-
-    for (iterMD = *ppHead; iterMD != NULL; iterMD = iterMD->pNext)
+    else
     {
-        if (iterMD->pNext && iterMD->pNext == pDelete)
+        pDelete->pPrev->pNext = pDelete->pNext;
+        if (pDelete->pNext != NULL)
         {
-            iterMD->pNext = pDelete->pNext;
-            return;
+            pDelete->pNext->pPrev = pDelete->pPrev;
+        }
+        else
+        {
+            /*  removal of last element */
+            (*ppHead)->pPrev = pDelete->pPrev;
         }
     }
+    pDelete->pPrev = NULL;
 }
 
 /**********************************************************************************************************************/
@@ -539,8 +590,6 @@ void    trdp_MDqueueAppLast (
     MD_ELE_T    * *ppHead,
     MD_ELE_T    *pNew)
 {
-    MD_ELE_T *iterMD;
-
     if (ppHead == NULL || pNew == NULL)
     {
         return;
@@ -551,15 +600,15 @@ void    trdp_MDqueueAppLast (
 
     if (*ppHead == NULL)
     {
-        *ppHead = pNew;
+        pNew->pPrev = pNew;
+        *ppHead     = pNew;
         return;
     }
 
-    for (iterMD = *ppHead; iterMD->pNext != NULL; iterMD = iterMD->pNext)
-    {
-        ;
-    }
-    iterMD->pNext = pNew;
+    /*  the predecessor of the first element is the last element */
+    pNew->pPrev             = (*ppHead)->pPrev;
+    pNew->pPrev->pNext      = pNew;
+    (*ppHead)->pPrev        = pNew;
 }
 
 /**********************************************************************************************************************/
@@ -577,22 +626,60 @@ void    trdp_MDqueueInsFirst (
         return;
     }
 
+    if (*ppHead == NULL)
+    {
+        pNew->pPrev = pNew;
+    }
+    else
+    {
+        pNew->pPrev         = (*ppHead)->pPrev;
+        (*ppHead)->pPrev    = pNew;
+    }
     pNew->pNext = *ppHead;
     *ppHead     = pNew;
 }
 
 /**********************************************************************************************************************/
-/** Initialize the UncompletedTCP pointers to null
+/** Initialize the TCP stream receive buffers
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ */
+void trdp_initTCPRcvBuffers (TRDP_APP_SESSION_T appHandle)
+{
+    int lIndex;
+    /* No buffer allocated yet, it is created on first reception */
+    for (lIndex = 0; lIndex < VOS_MAX_SOCKET_CNT; lIndex++)
+    {
+        appHandle->tcpRcvBuf[lIndex].sock       = VOS_INVALID_SOCKET;
+        appHandle->tcpRcvBuf[lIndex].size       = 0u;
+        appHandle->tcpRcvBuf[lIndex].fill       = 0u;
+        appHandle->tcpRcvBuf[lIndex].pBuffer    = NULL;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Discard the buffered TCP stream data of a socket and free its buffer
  *
  *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      sockIndex           index into the socket pool, TRDP_INVALID_SOCKET_INDEX for all
  */
-void trdp_initUncompletedTCP (TRDP_APP_SESSION_T appHandle)
+void trdp_freeTCPRcvBuffer (TRDP_APP_SESSION_T appHandle, INT32 sockIndex)
 {
     int lIndex;
-    /* Initialize the pointers to Null */
+
     for (lIndex = 0; lIndex < VOS_MAX_SOCKET_CNT; lIndex++)
     {
-        appHandle->uncompletedTCP[lIndex] = NULL;
+        if ((sockIndex == TRDP_INVALID_SOCKET_INDEX) || (sockIndex == lIndex))
+        {
+            if (appHandle->tcpRcvBuf[lIndex].pBuffer != NULL)
+            {
+                vos_memFree(appHandle->tcpRcvBuf[lIndex].pBuffer);
+            }
+            appHandle->tcpRcvBuf[lIndex].sock       = VOS_INVALID_SOCKET;
+            appHandle->tcpRcvBuf[lIndex].size       = 0u;
+            appHandle->tcpRcvBuf[lIndex].fill       = 0u;
+            appHandle->tcpRcvBuf[lIndex].pBuffer    = NULL;
+        }
     }
 }
 #endif
@@ -607,8 +694,6 @@ void    trdp_queueAppLast (
     PD_ELE_T    * *ppHead,
     PD_ELE_T    *pNew)
 {
-    PD_ELE_T *iterPD;
-
     if (ppHead == NULL || pNew == NULL)
     {
         return;
@@ -619,15 +704,15 @@ void    trdp_queueAppLast (
 
     if (*ppHead == NULL)
     {
-        *ppHead = pNew;
+        pNew->pPrev = pNew;
+        *ppHead     = pNew;
         return;
     }
 
-    for (iterPD = *ppHead; iterPD->pNext != NULL; iterPD = iterPD->pNext)
-    {
-        ;
-    }
-    iterPD->pNext = pNew;
+    /*  the predecessor of the first element is the last element */
+    pNew->pPrev             = (*ppHead)->pPrev;
+    pNew->pPrev->pNext      = pNew;
+    (*ppHead)->pPrev        = pNew;
 }
 
 /**********************************************************************************************************************/
@@ -645,22 +730,185 @@ void    trdp_queueInsFirst (
         return;
     }
 
+    if (*ppHead == NULL)
+    {
+        pNew->pPrev = pNew;
+    }
+    else
+    {
+        pNew->pPrev         = (*ppHead)->pPrev;
+        (*ppHead)->pPrev    = pNew;
+    }
     pNew->pNext = *ppHead;
     *ppHead     = pNew;
 }
 
+/**********************************************************************************************************************/
+/** Bucket of a comId in a PD index
+ *
+ *  @param[in]      pIndex          pointer to index
+ *  @param[in]      comId           ComID
+ *
+ *  @retval         bucket
+ */
+static UINT32 trdp_pdIndexBucket (
+    const TRDP_PD_INDEX_T   *pIndex,
+    UINT32                  comId)
+{
+    comId   ^= comId >> 16u;
+    comId   *= 0x45D9F3Bu;
+    comId   ^= comId >> 16u;
+    return comId & pIndex->mask;
+}
+
+/**********************************************************************************************************************/
+/** Create a comId index for up to maxElements PD elements
+ *
+ *  @param[out]     pIndex          pointer to index
+ *  @param[in]      maxElements     maximum number of elements to be indexed
+ *
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_MEM_ERR
+ */
+TRDP_ERR_T trdp_pdIndexInit (
+    TRDP_PD_INDEX_T *pIndex,
+    UINT32          maxElements)
+{
+    UINT32 size = 16u;
+
+    while (size < (2u * maxElements))
+    {
+        size *= 2u;
+    }
+    memset(pIndex, 0, sizeof(TRDP_PD_INDEX_T));
+    pIndex->mask    = size - 1u;
+    pIndex->maxLink = maxElements;
+    pIndex->pHead   = (UINT32 *) vos_memAlloc(size * sizeof(UINT32));
+    pIndex->pTail   = (UINT32 *) vos_memAlloc(size * sizeof(UINT32));
+    if (maxElements > 0u)
+    {
+        pIndex->pLink = (TRDP_PD_INDEX_LINK_T *) vos_memAlloc(maxElements * sizeof(TRDP_PD_INDEX_LINK_T));
+    }
+    if ((pIndex->pHead == NULL) || (pIndex->pTail == NULL) || ((maxElements > 0u) && (pIndex->pLink == NULL)))
+    {
+        trdp_pdIndexFree(pIndex);
+        return TRDP_MEM_ERR;
+    }
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Release a comId index
+ *
+ *  @param[in]      pIndex          pointer to index
+ */
+void trdp_pdIndexFree (
+    TRDP_PD_INDEX_T *pIndex)
+{
+    if (pIndex->pHead != NULL)
+    {
+        vos_memFree(pIndex->pHead);
+    }
+    if (pIndex->pTail != NULL)
+    {
+        vos_memFree(pIndex->pTail);
+    }
+    if (pIndex->pLink != NULL)
+    {
+        vos_memFree(pIndex->pLink);
+    }
+    memset(pIndex, 0, sizeof(TRDP_PD_INDEX_T));
+}
+
+/**********************************************************************************************************************/
+/** Add an element to a comId index.
+ *  Elements with the same comId are returned by trdp_pdIndexNext in the order of their queue: queued in front
+ *  (first = TRUE) or appended.
+ *
+ *  @param[in]      pIndex          pointer to index
+ *  @param[in]      pElement        element to add
+ *  @param[in]      first           TRUE: element is in front of the elements added before
+ */
+void trdp_pdIndexAdd (
+    TRDP_PD_INDEX_T *pIndex,
+    PD_ELE_T        *pElement,
+    BOOL8           first)
+{
+    UINT32  bucket;
+    UINT32  link;
+
+    if (pIndex->numLink >= pIndex->maxLink)
+    {
+        return;
+    }
+    bucket  = trdp_pdIndexBucket(pIndex, pElement->addr.comId);
+    link    = pIndex->numLink++;
+    pIndex->pLink[link].pElement = pElement;
+
+    if (pIndex->pHead[bucket] == 0u)
+    {
+        pIndex->pLink[link].next    = 0u;
+        pIndex->pHead[bucket]       = link + 1u;
+        pIndex->pTail[bucket]       = link + 1u;
+    }
+    else if (first == TRUE)
+    {
+        pIndex->pLink[link].next    = pIndex->pHead[bucket];
+        pIndex->pHead[bucket]       = link + 1u;
+    }
+    else
+    {
+        pIndex->pLink[link].next = 0u;
+        pIndex->pLink[pIndex->pTail[bucket] - 1u].next  = link + 1u;
+        pIndex->pTail[bucket] = link + 1u;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Iterate over the elements of a comId
+ *
+ *  @param[in]      pIndex          pointer to index
+ *  @param[in]      comId           ComID to search for
+ *  @param[in,out]  pIter           iterator, 0 to get the first element
+ *
+ *  @retval         != NULL         pointer to PD element
+ *  @retval         NULL            No more PD elements
+ */
+PD_ELE_T *trdp_pdIndexNext (
+    const TRDP_PD_INDEX_T   *pIndex,
+    UINT32                  comId,
+    UINT32                  *pIter)
+{
+    UINT32 link = (*pIter == 0u) ? pIndex->pHead[trdp_pdIndexBucket(pIndex, comId)] : pIndex->pLink[*pIter - 1u].next;
+
+    while (link != 0u)
+    {
+        if (pIndex->pLink[link - 1u].pElement->addr.comId == comId)
+        {
+            *pIter = link;
+            return pIndex->pLink[link - 1u].pElement;
+        }
+        link = pIndex->pLink[link - 1u].next;
+    }
+    *pIter = 0u;
+    return NULL;
+}
+
 /**********************************************************************************************************************/
 /** Handle the socket pool: Initialize it
  *
  *  @param[in]      iface          pointer to the socket pool
+ *  @param[in]      pNumJoin       counter of the joined multicast groups of the pool (statistics)
  */
-void trdp_initSockets (TRDP_SOCKETS_T iface[])
+void trdp_initSockets (TRDP_SOCKETS_T iface[], UINT32 *pNumJoin)
 {
     int lIndex;
     /* Clear the socket pool */
     for (lIndex = 0; lIndex < VOS_MAX_SOCKET_CNT; lIndex++)
     {
-        iface[lIndex].sock = VOS_INVALID_SOCKET;
+        iface[lIndex].sock      = VOS_INVALID_SOCKET;
+        iface[lIndex].pNumJoin  = pNumJoin;
+        memset(iface[lIndex].mcGroups, 0, sizeof(iface[lIndex].mcGroups));
     }
 }
 
@@ -669,6 +917,8 @@ void trdp_initSockets (TRDP_SOCKETS_T iface[])
  *  First we loop through the socket pool and check if there is already a socket
  *  which would suit us. If a multicast group should be joined, we do that on an otherwise suitable socket - up to 20
  *  multicast goups can be joined per socket.
+ *  Outgoing TCP connections are shared: all MD sessions to the same corner use one connection, their messages are
+ *  sent one after the other and the replies are assigned to the sessions by their sessionID.
  *  If a socket for multicast publishing is requested, we also use the source IP to determine the interface for outgoing
  *  multicast traffic.
  *
@@ -738,13 +988,16 @@ TRDP_ERR_T  trdp_requestSocket (
                  && (iface[lIndex].sendParam.ttl == params->ttl)
                  && (iface[lIndex].rcvMostly == rcvMostly)
                  && ((type != TRDP_SOCK_MD_TCP)
-                     || ((type == TRDP_SOCK_MD_TCP) && (iface[lIndex].tcpParams.cornerIp == cornerIp) && (iface[lIndex].usage == 0))))
+                     || ((type == TRDP_SOCK_MD_TCP)
+                         && (iface[lIndex].tcpParams.cornerIp == cornerIp)
+                         && (iface[lIndex].tcpParams.morituri == FALSE)
+                         && ((iface[lIndex].usage == 0) || (rcvMostly == FALSE)))))
         {
             /*  Did this socket join the required multicast group?  */
             if (mcGroup != 0 && trdp_SockIsJoined(iface[lIndex].mcGroups, mcGroup) == FALSE)
             {
                 /*  No, but can we add it? */
-                if (trdp_SockAddJoin(iface[lIndex].mcGroups, mcGroup) == FALSE)
+                if (trdp_SockAddJoin(&iface[lIndex], mcGroup) == FALSE)
                 {
                     continue;   /* No, socket cannot join more MC groups */
                 }
@@ -752,7 +1005,7 @@ TRDP_ERR_T  trdp_requestSocket (
                 {
                     if (vos_sockJoinMC(iface[lIndex].sock, mcGroup, srcIP) != VOS_NO_ERR)
                     {
-                        if (trdp_SockDelJoin(iface[lIndex].mcGroups, mcGroup) == FALSE)
+                        if (trdp_SockDelJoin(&iface[lIndex], mcGroup) == FALSE)
                         {
                             vos_printLogStr(VOS_LOG_ERROR, "trdp_SockDelJoin() failed!\n");
                         }
@@ -834,7 +1087,7 @@ TRDP_ERR_T  trdp_requestSocket (
             iface[lIndex].tcpParams.addFileDesc = FALSE;
         }
 
-        memset(iface[lIndex].mcGroups, 0, sizeof(iface[lIndex].mcGroups));
+        trdp_SockClearJoins(&iface[lIndex]);
 
         /* if a socket descriptor was supplied, take that one (for the TCP connection)   */
         if (useSocket != VOS_INVALID_SOCKET)
@@ -900,7 +1153,7 @@ TRDP_ERR_T  trdp_requestSocket (
                            }
                            else
                            {
-                               if (trdp_SockAddJoin(iface[lIndex].mcGroups, mcGroup) == FALSE)
+                               if (trdp_SockAddJoin(&iface[lIndex], mcGroup) == FALSE)
                                {
                                    vos_printLogStr(VOS_LOG_ERROR, "trdp_SockAddJoin() failed!\n");
                                }
@@ -1055,12 +1308,13 @@ void  trdp_releaseSocket (
                     vos_printLog(VOS_LOG_DBG, "Closed socket %d\n", (int) iface[lIndex].sock);
                 }
                 iface[lIndex].sock = VOS_INVALID_SOCKET;
+                trdp_SockClearJoins(&iface[lIndex]);  /* closing left the groups */
             }
             else if (mcGroupUsed != VOS_INADDR_ANY) /* Check for MC usage (close socket will unjoin MC anyway) */
             {
                 /* remove MC group from socket list:
                     we do that only if the caller is the only user of this MC group on this socket! */
-                if (trdp_SockDelJoin(iface[lIndex].mcGroups, mcGroupUsed) == FALSE)
+                if (trdp_SockDelJoin(&iface[lIndex], mcGroupUsed) == FALSE)
                 {
                     vos_printLogStr(VOS_LOG_WARNING, "trdp_sockDelJoin() failed!\n");
                 }
@@ -1170,6 +1424,177 @@ UINT32  trdp_getSeqCnt (
     return 0;   /*    Not found, initial value is zero    */
 }
 
+/**********************************************************************************************************************/
+/** Hash a sender for the sequence counter table
+ *
+ *  @param[in]      srcIP               Source IP address
+ *  @param[in]      msgType             message type
+ *
+ *  @retval         hash value
+ */
+
+static UINT32 trdp_seqCntHash (
+    TRDP_IP_ADDR_T  srcIP,
+    TRDP_MSG_T      msgType)
+{
+    UINT32 hash = (srcIP ^ ((UINT32) msgType << 16u)) * 2654435761u;    /* Knuth's multiplicative hash */
+
+    return hash ^ (hash >> 16u);
+}
+
+/**********************************************************************************************************************/
+/** Find the sequence counter slot of a sender
+ *
+ *  @param[in]      pList               sequence counter table
+ *  @param[in]      srcIP               Source IP address
+ *  @param[in]      msgType             message type
+ *
+ *  @retval         pointer to the entry of the sender or to the free slot where it has to be entered
+ */
+
+static TRDP_SEQ_CNT_ENTRY_T *trdp_seqCntSlot (
+    TRDP_SEQ_CNT_LIST_T *pList,
+    TRDP_IP_ADDR_T      srcIP,
+    TRDP_MSG_T          msgType)
+{
+    UINT32  mask = pList->maxNoOfEntries - 1u;
+    UINT32  idx;
+
+    /* the table is at most half full, there is always a free slot */
+    for (idx = trdp_seqCntHash(srcIP, msgType) & mask;
+         pList->seq[idx].msgType != 0u;
+         idx = (idx + 1u) & mask)
+    {
+        if ((pList->seq[idx].srcIpAddr == srcIP) && (pList->seq[idx].msgType == msgType))
+        {
+            break;
+        }
+    }
+    return &pList->seq[idx];
+}
+
+/**********************************************************************************************************************/
+/** Allocate a sequence counter table and enter the senders of another one
+ *
+ *  @param[in]      pOldList            table to copy or NULL
+ *  @param[in]      size                number of slots (power of 2)
+ *
+ *  @retval         new table or NULL
+ */
+
+static TRDP_SEQ_CNT_LIST_T *trdp_seqCntAlloc (
+    const TRDP_SEQ_CNT_LIST_T   *pOldList,
+    UINT32                      size)
+{
+    TRDP_SEQ_CNT_LIST_T *pNewList = (TRDP_SEQ_CNT_LIST_T *) vos_memAlloc(sizeof(TRDP_SEQ_CNT_LIST_T) +
+                                                                         (size - 1u) * sizeof(TRDP_SEQ_CNT_ENTRY_T));
+    UINT32              idx;
+
+    if (pNewList == NULL)
+    {
+        return NULL;
+    }
+    pNewList->maxNoOfEntries = (UINT16) size;
+
+    if (pOldList != NULL)
+    {
+        /* rehash the used slots */
+        for (idx = 0u; idx < pOldList->maxNoOfEntries; idx++)
+        {
+            if (pOldList->seq[idx].msgType != 0u)
+            {
+                *trdp_seqCntSlot(pNewList, pOldList->seq[idx].srcIpAddr, pOldList->seq[idx].msgType) =
+                    pOldList->seq[idx];
+            }
+        }
+        pNewList->curNoOfEntries = pOldList->curNoOfEntries;
+    }
+    return pNewList;
+}
+
+/**********************************************************************************************************************/
+/** Initial size of the sequence counter table of a subscription
+ *
+ *  A subscription of a single source starts small. Those of any source or of a source range get room for all the
+ *  senders they may track (maxNumSources, or the size of the range if smaller), so the table is not grown on receive.
+ *
+ *  @param[in]      pElement            subscription element
+ *  @param[in]      maxNumSources       max. number of senders to track (pdDefault.maxNumSources)
+ *
+ *  @retval         number of slots (power of 2)
+ */
+
+static UINT32 trdp_seqCntStartSize (
+    const PD_ELE_T  *pElement,
+    UINT32          maxNumSources)
+{
+    UINT32  size    = TRDP_SEQ_CNT_MIN_ARRAY_SIZE;
+    UINT32  numSrc  = maxNumSources;
+
+    if ((pElement->addr.srcIpAddr != VOS_INADDR_ANY) && (pElement->addr.srcIpAddr2 == VOS_INADDR_ANY))
+    {
+        return size;
+    }
+    if ((pElement->addr.srcIpAddr != VOS_INADDR_ANY) &&
+        (pElement->addr.srcIpAddr2 - pElement->addr.srcIpAddr < numSrc))
+    {
+        numSrc = pElement->addr.srcIpAddr2 - pElement->addr.srcIpAddr + 1u;
+    }
+    /* at most half full */
+    while ((size < 2u * numSrc) && (size < 2u * TRDP_PD_MAX_NUM_SOURCES_LIMIT))
+    {
+        size <<= 1u;
+    }
+    return size;
+}
+
+/**********************************************************************************************************************/
+/** Upper limit of pdDefault.maxNumSources
+ *
+ *  The sequence counter table of a subscription has up to twice maxNumSources slots, the sender table of a multi
+ *  source subscription (TRDP_PD_SRC_LIST_T) up to maxNumSources entries. vos_memAlloc cannot hand out more than the
+ *  largest block of the memory pool (VOS_MEM_MAX_BLOCKSIZE) for either of them.
+ *
+ *  @retval         highest maxNumSources (power of 2, at most TRDP_PD_MAX_NUM_SOURCES_LIMIT)
+ */
+
+UINT32 trdp_maxNumSources (void)
+{
+    UINT32 limit = TRDP_PD_MAX_NUM_SOURCES_LIMIT;
+
+    while ((sizeof(TRDP_SEQ_CNT_LIST_T) + (2u * limit - 1u) * sizeof(TRDP_SEQ_CNT_ENTRY_T) > VOS_MEM_MAX_BLOCKSIZE) ||
+           (sizeof(TRDP_PD_SRC_LIST_T) + (limit - 1u) * sizeof(TRDP_PD_SRC_T) > VOS_MEM_MAX_BLOCKSIZE))
+    {
+        limit >>= 1u;
+    }
+    return limit;
+}
+
+/**********************************************************************************************************************/
+/** Find the sequence counter entry of a sender.
+ *
+ *  @param[in]      pElement            subscription element
+ *  @param[in]      srcIP               Source IP address
+ *  @param[in]      msgType             message type
+ *
+ *  @retval         entry of the sender, NULL if nothing was received from it yet
+ */
+
+TRDP_SEQ_CNT_ENTRY_T *trdp_findSequenceCounter (
+    const PD_ELE_T  *pElement,
+    TRDP_IP_ADDR_T  srcIP,
+    TRDP_MSG_T      msgType)
+{
+    TRDP_SEQ_CNT_ENTRY_T *pEntry;
+
+    if ((pElement == NULL) || (pElement->pSeqCntList == NULL))
+    {
+        return NULL;
+    }
+    pEntry = trdp_seqCntSlot(pElement->pSeqCntList, srcIP, msgType);
+    return (pEntry->msgType != 0u) ? pEntry : NULL;
+}
+
 /**********************************************************************************************************************/
 /** remove the sequence counter for the comID/source IP.
  *  The sequence counter should be reset if there was a packet time out.
@@ -1187,20 +1612,16 @@ void trdp_resetSequenceCounter (
     TRDP_IP_ADDR_T  srcIP,
     TRDP_MSG_T      msgType)
 {
-    int l_index;
+    TRDP_SEQ_CNT_ENTRY_T *pEntry;
 
     if (pElement == NULL || pElement->pSeqCntList == NULL)
     {
         return;
     }
-    /* Loop over entries */
-    for (l_index = 0; l_index < pElement->pSeqCntList->curNoOfEntries; ++l_index)
+    pEntry = trdp_seqCntSlot(pElement->pSeqCntList, srcIP, msgType);
+    if (pEntry->msgType != 0u)
     {
-        if ((srcIP == pElement->pSeqCntList->seq[l_index].srcIpAddr) &&
-            (msgType == pElement->pSeqCntList->seq[l_index].msgType))
-        {
-            pElement->pSeqCntList->seq[l_index].lastSeqCnt = 0;
-        }
+        pEntry->lastSeqCnt = 0;
     }
 }
 
@@ -1210,13 +1631,21 @@ void trdp_resetSequenceCounter (
  *  else if already received, return 1
  *  On memory error, return -1
  *
+ *  The senders are kept in an open addressing hash table, which is kept at most half full and doubled if needed.
+ *  Subscriptions of a single source start with TRDP_SEQ_CNT_MIN_ARRAY_SIZE slots, those of any source or of a source
+ *  range with room for the senders they may track (see trdp_seqCntStartSize). The number of senders is bound by
+ *  maxNumSources: packets of further senders are ignored (2) and reported once per subscription, the caller counts
+ *  them as missed packets.
+ *
  *  @param[in]      pElement            subscription element
  *  @param[in]      sequenceCounter     sequence counter to check
  *  @param[in]      srcIP               Source IP address
  *  @param[in]      msgType             type of the message
+ *  @param[in]      maxNumSources       max. number of senders to track (pdDefault.maxNumSources)
  *
  *  @retval         0 - no duplicate
- *                  1 - duplicate or old sequence counter
+ *                  1 - duplicate or old sequence counter: ignore the packet
+ *                  2 - sender beyond maxNumSources: ignore the packet
  *                 -1 - memory error
  */
 
@@ -1224,9 +1653,10 @@ int trdp_checkSequenceCounter (
     PD_ELE_T        *pElement,
     UINT32          sequenceCounter,
     TRDP_IP_ADDR_T  srcIP,
-    TRDP_MSG_T      msgType)
+    TRDP_MSG_T      msgType,
+    UINT32          maxNumSources)
 {
-    int l_index;
+    TRDP_SEQ_CNT_ENTRY_T *pEntry;
 
     if (pElement == NULL)
     {
@@ -1237,73 +1667,62 @@ int trdp_checkSequenceCounter (
     if (pElement->pSeqCntList == NULL)
     {
         /* Allocate some space */
-        pElement->pSeqCntList = (TRDP_SEQ_CNT_LIST_T *) vos_memAlloc(TRDP_SEQ_CNT_START_ARRAY_SIZE *
-                                                                     sizeof(TRDP_SEQ_CNT_ENTRY_T) +
-                                                                     sizeof(TRDP_SEQ_CNT_LIST_T));
+        pElement->pSeqCntList = trdp_seqCntAlloc(NULL, trdp_seqCntStartSize(pElement, maxNumSources));
         if (pElement->pSeqCntList == NULL)
         {
             return -1;
         }
-        pElement->pSeqCntList->maxNoOfEntries   = TRDP_SEQ_CNT_START_ARRAY_SIZE;
-        pElement->pSeqCntList->curNoOfEntries   = 0;
     }
-    /* Loop over entries */
-    for (l_index = 0; l_index < pElement->pSeqCntList->curNoOfEntries; ++l_index)
+
+    pEntry = trdp_seqCntSlot(pElement->pSeqCntList, srcIP, msgType);
+    if (pEntry->msgType != 0u)
     {
-        if ((srcIP == pElement->pSeqCntList->seq[l_index].srcIpAddr) &&
-            (msgType == pElement->pSeqCntList->seq[l_index].msgType))
+        /*        Is this packet a duplicate?    */
+        if ((pEntry->lastSeqCnt == 0) ||    /* first time after timeout */
+            (sequenceCounter > pEntry->lastSeqCnt))
         {
-            /*        Is this packet a duplicate?    */
-            if ((pElement->pSeqCntList->seq[l_index].lastSeqCnt == 0) ||    /* first time after timeout */
-                (sequenceCounter > pElement->pSeqCntList->seq[l_index].lastSeqCnt))
-            {
-                /*
-                 vos_printLog(VOS_LOG_DBG,
-                 "Rcv sequence: %u    last seq: %u\n",
-                 sequenceCounter,
-                 pElement->pSeqCntList->seq[l_index].lastSeqCnt);
-                 vos_printLog(VOS_LOG_DBG, "-> new PD data found (SrcIp: %s comId %u)\n", vos_ipDotted(
-                 srcIP), pElement->addr.comId);
-                 */
-                pElement->pSeqCntList->seq[l_index].lastSeqCnt = sequenceCounter;
-                return 0;
-            }
-            else
-            {
-                vos_printLog(VOS_LOG_DBG,
-                             "Rcv sequence: %u    last seq: %u\n",
-                             sequenceCounter,
-                             pElement->pSeqCntList->seq[l_index].lastSeqCnt);
-                vos_printLog(VOS_LOG_DBG, "-> duplicated PD data ignored (SrcIp: %s comId %u)\n", vos_ipDotted(
-                                 srcIP), pElement->addr.comId);
-                return 1;
-            }
+            pEntry->lastSeqCnt = sequenceCounter;
+            return 0;
+        }
+        else
+        {
+            vos_printLog(VOS_LOG_DBG,
+                         "Rcv sequence: %u    last seq: %u\n",
+                         sequenceCounter,
+                         pEntry->lastSeqCnt);
+            vos_printLog(VOS_LOG_INFO, "Old PD data ignored (SrcIp: %s comId %u)\n", vos_ipDotted(
+                             srcIP), pElement->addr.comId);
+            return 1;
         }
     }
 
-    /* Not found in list, add new entry */
-    if (pElement->pSeqCntList->curNoOfEntries >= pElement->pSeqCntList->maxNoOfEntries)
+    /* Not found in table, add new entry */
+    if (pElement->pSeqCntList->curNoOfEntries >= maxNumSources)
+    {
+        if ((pElement->privFlags & TRDP_SRC_OVERFLOW) == 0u)
+        {
+            pElement->privFlags |= TRDP_SRC_OVERFLOW;
+            vos_printLog(VOS_LOG_WARNING, "More than %u senders, PD of further senders ignored (SrcIp: %s comId %u)\n",
+                         maxNumSources, vos_ipDotted(srcIP), pElement->addr.comId);
+        }
+        return 2;
+    }
+    if ((pElement->pSeqCntList->curNoOfEntries + 1u) * 2u > pElement->pSeqCntList->maxNoOfEntries)
     {
         /* Allocate some more space */
-        UINT16 newSize = 2 * pElement->pSeqCntList->curNoOfEntries;
-        TRDP_SEQ_CNT_LIST_T *newList = (TRDP_SEQ_CNT_LIST_T *) vos_memAlloc(newSize * sizeof(TRDP_SEQ_CNT_ENTRY_T) +
-                                                                            sizeof(TRDP_SEQ_CNT_LIST_T));
+        TRDP_SEQ_CNT_LIST_T *newList = trdp_seqCntAlloc(pElement->pSeqCntList,
+                                                        2u * pElement->pSeqCntList->maxNoOfEntries);
         if (newList == NULL)
         {
             return -1;
         }
-
-        /* Copy old data into new, larger area */
-        memcpy(newList, pElement->pSeqCntList, pElement->pSeqCntList->maxNoOfEntries *
-               sizeof(TRDP_SEQ_CNT_ENTRY_T) +
-               sizeof(TRDP_SEQ_CNT_LIST_T));
         vos_memFree(pElement->pSeqCntList);     /* Free old area */
         pElement->pSeqCntList = newList;
-        pElement->pSeqCntList->maxNoOfEntries = newSize;
+        pEntry = trdp_seqCntSlot(pElement->pSeqCntList, srcIP, msgType);
     }
-    pElement->pSeqCntList->seq[pElement->pSeqCntList->curNoOfEntries].lastSeqCnt    = sequenceCounter;
-    pElement->pSeqCntList->seq[pElement->pSeqCntList->curNoOfEntries].srcIpAddr     = srcIP;
-    pElement->pSeqCntList->seq[pElement->pSeqCntList->curNoOfEntries].msgType       = msgType;
+    pEntry->lastSeqCnt  = sequenceCounter;
+    pEntry->srcIpAddr   = srcIP;
+    pEntry->msgType     = msgType;
     pElement->pSeqCntList->curNoOfEntries++;
     vos_printLog(VOS_LOG_DBG, "Rcv sequence: %u\n", sequenceCounter);
     vos_printLog(VOS_LOG_DBG, "*** new sequence entry (SrcIp: %s comId %u)\n", vos_ipDotted(
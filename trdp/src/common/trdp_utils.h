@@ -16,6 +16,10 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: trdp_findSequenceCounter
+ *      AG 2026-10-18: trdp_maxNumSources, trdp_checkSequenceCounter returns 2 for untracked senders
+ *      AG 2026-10-18: trdp_checkSequenceCounter bound by maxNumSources
+ *      AG 2026-10-18: Temporary comId index of PD queues (trdp_pdIndex...)
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
  *      BL 2017-11-28: Ticket #180 Filtering rules for DestinationURI does not follow the standard
  *      BL 2017-11-15: Ticket #1   Unjoin on unsubscribe/delListener (finally ;-)
@@ -47,6 +51,24 @@
  * TYPEDEFS
  */
 
+/** Link of a PD element in a comId index    */
+typedef struct
+{
+    PD_ELE_T    *pElement;
+    UINT32      next;               /**< next link of the bucket + 1, 0 = end   */
+} TRDP_PD_INDEX_LINK_T;
+
+/** Temporary comId index of PD elements, used to avoid queue scans when many elements are added at once   */
+typedef struct
+{
+    UINT32                  mask;       /**< number of buckets - 1                  */
+    UINT32                  *pHead;     /**< first link of each bucket + 1          */
+    UINT32                  *pTail;     /**< last link of each bucket + 1           */
+    TRDP_PD_INDEX_LINK_T    *pLink;     /**< links, one per indexed element         */
+    UINT32                  numLink;
+    UINT32                  maxLink;
+} TRDP_PD_INDEX_T;
+
 /*******************************************************************************
  * GLOBAL FUNCTIONS
  */
@@ -78,6 +100,23 @@ void    trdp_queueInsFirst (
     PD_ELE_T    * *pHead,
     PD_ELE_T    *pNew);
 
+TRDP_ERR_T  trdp_pdIndexInit (
+    TRDP_PD_INDEX_T *pIndex,
+    UINT32          maxElements);
+
+void        trdp_pdIndexFree (
+    TRDP_PD_INDEX_T *pIndex);
+
+void        trdp_pdIndexAdd (
+    TRDP_PD_INDEX_T *pIndex,
+    PD_ELE_T        *pElement,
+    BOOL8           first);
+
+PD_ELE_T    *trdp_pdIndexNext (
+    const TRDP_PD_INDEX_T   *pIndex,
+    UINT32                  comId,
+    UINT32                  *pIter);
+
 #if MD_SUPPORT
 MD_ELE_T    *trdp_MDqueueFindAddr (
     MD_ELE_T            *pHead,
@@ -109,21 +148,49 @@ INT32 trdp_getCurrentMaxSocketCnt(void);
 /** Handle the socket pool: Initialize it
  *
  *  @param[in]      iface          pointer to the socket pool
+ *  @param[in]      pNumJoin       counter of the joined multicast groups of the pool (statistics)
  */
 
 void trdp_initSockets(
-    TRDP_SOCKETS_T iface[]);
+    TRDP_SOCKETS_T  iface[],
+    UINT32          *pNumJoin);
 
 
 /**********************************************************************************************************************/
-/** ???
+/** Initialize the TCP stream receive buffers
  *
  *  @param[in]      appHandle          session handle
  */
 
-void trdp_initUncompletedTCP (
+void trdp_initTCPRcvBuffers (
     TRDP_APP_SESSION_T appHandle);
 
+/**********************************************************************************************************************/
+/** Discard the buffered TCP stream data of a socket and free its buffer
+ *
+ *  @param[in]      appHandle          session handle
+ *  @param[in]      sockIndex          index into the socket pool, TRDP_INVALID_SOCKET_INDEX for all
+ */
+
+void trdp_freeTCPRcvBuffer (
+    TRDP_APP_SESSION_T  appHandle,
+    INT32               sockIndex);
+
+/**********************************************************************************************************************/
+/** Find the sequence counter entry of a sender.
+ *
+ *  @param[in]      pElement            subscription element
+ *  @param[in]      srcIP               Source IP address
+ *  @param[in]      msgType             message type
+ *
+ *  @retval         entry of the sender, NULL if nothing was received from it yet
+ */
+
+TRDP_SEQ_CNT_ENTRY_T *trdp_findSequenceCounter (
+    const PD_ELE_T  *pElement,
+    TRDP_IP_ADDR_T  srcIP,
+    TRDP_MSG_T      msgType);
+
 /**********************************************************************************************************************/
 /** remove the sequence counter for the comID/source IP.
  *  The sequence counter should be reset if there was a packet time out.
@@ -265,9 +332,11 @@ UINT32 trdp_getSeqCnt (
  *  @param[in]      sequenceCounter     sequence counter to check
  *  @param[in]      srcIP               Source IP address
  *  @param[in]      msgType             type of the message
+ *  @param[in]      maxNumSources       max. number of senders to track (pdDefault.maxNumSources)
  *
  *  @retval         0 - no duplicate
- *                  1 - duplicate sequence counter
+ *                  1 - duplicate sequence counter: ignore the packet
+ *                  2 - sender beyond maxNumSources: ignore the packet
  *                 -1 - memory error
  */
 
@@ -275,8 +344,16 @@ int trdp_checkSequenceCounter (
     PD_ELE_T        *pElement,
     UINT32          sequenceCounter,
     TRDP_IP_ADDR_T  srcIP,
-    TRDP_MSG_T      msgType);
+    TRDP_MSG_T      msgType,
+    UINT32          maxNumSources);
+
+/**********************************************************************************************************************/
+/** Upper limit of pdDefault.maxNumSources: the sender tables must fit the largest memory block
+ *
+ *  @retval         highest maxNumSources
+ */
 
+UINT32 trdp_maxNumSources (void);
 
 /**********************************************************************************************************************/
 /** Check if listener URI is in addressing range of destination URI.
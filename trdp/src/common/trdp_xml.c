@@ -6,6 +6,8 @@
  *
  * @details         Hint: Missing optional elements must be handled using the count-function, otherwise following
  *                           elements will be following ignored!
+ *                  The document is mapped (or read) into memory and tokenized in one pass when it is opened. The
+ *                  token index links each element to its end, seeking and counting skip nested elements.
  *
  * @note            Project: TCNOpen TRDP prototype stack
  *
@@ -16,6 +18,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Memory mapped document, single pass tokenizer and element index
  *      SB 2018-11-07: Ticket #221 readXmlDatasets failed 
  *      BL 2016-07-06: Ticket #122 64Bit compatibility (+ compiler warnings)
  *      BL 2016-02-24: missing include (thanks to Robert)
@@ -31,54 +34,104 @@
 #include <string.h>
 #include <sys/types.h>
 
+#ifdef POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "trdp_xml.h"
 
 /***********************************************************************************************************************
  * DEFINES
  */
 
+#define XML_DOC_CALLER      0       /* document buffer provided by the caller   */
+#define XML_DOC_MAPPED      1       /* document file mapped into memory         */
+#define XML_DOC_ALLOC       2       /* document file read into heap memory      */
+
+#define XML_MIN_TOKENS      1024u   /* initial size of the token index, doubled as needed   */
+
 /***********************************************************************************************************************
  * TYPEDEFS
  */
 
+/* Character reader on the document, behaves like fgetc/ungetc/feof on a file */
+typedef struct
+{
+    const UINT8 *pDoc;
+    UINT32      size;
+    UINT32      pos;
+    int         eof;
+} XML_READER_T;
+
 /***********************************************************************************************************************
 *  LOCAL FUNCTIONS
 */
 
-/***********************************************************************************************************************
-NAME:       trdp_XMLNextToken
-ABSTRACT:   Returns next XML token.
-            Skips occurences of whitespace and <!...> and <?...>
-RETURNS:    TOK_OPEN ("<"), TOK_CLOSE (">"), TOK_OPEN_END = ("</"),
-            TOK_CLOSE_EMPTY = ("/>"), TOK_EQUAL = ("="), TOK_ID, TOK_EOF
-*/
 /**********************************************************************************************************************/
-/** Return next XML token.
+/** Read next character of the document
+ *
+ *  @param[in]      pRd         Pointer to reader
+ *
+ *  @retval         character or EOF
+ */
+static int trdp_XMLGetc (
+    XML_READER_T *pRd)
+{
+    if (pRd->pos < pRd->size)
+    {
+        return pRd->pDoc[pRd->pos++];
+    }
+    pRd->eof = 1;
+    return EOF;
+}
+
+/**********************************************************************************************************************/
+/** Push back the character read last
+ *
+ *  @param[in]      ch          character read last
+ *  @param[in]      pRd         Pointer to reader
+ */
+static void trdp_XMLUngetc (
+    int             ch,
+    XML_READER_T    *pRd)
+{
+    if ((ch != EOF) && (pRd->pos > 0u))
+    {
+        pRd->pos--;
+        pRd->eof = 0;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Scan next XML token of the document.
  *    Skips occurences of whitespace and <!...> and <?...>
  *
- *  @param[in]      pXML        Pointer to local data
+ *  @param[in]      pRd         Pointer to reader
+ *  @param[out]     pTok        Token index entry, the identifier is given by its position in the document
  *
  *  @retval         TOK_OPEN ("<"), TOK_CLOSE (">"), TOK_OPEN_END = ("</"),
  *                  TOK_CLOSE_EMPTY = ("/>"), TOK_EQUAL = ("="), TOK_ID, TOK_EOF
  *
  */
-static XML_TOKEN_T trdp_XMLNextToken (
-    XML_HANDLE_T *pXML)
+static XML_TOKEN_T trdp_XMLScanToken (
+    XML_READER_T    *pRd,
+    XML_TOKEN_REC_T *pTok)
 {
-    int     ch = 0;
-    char    *p;
+    int ch = 0;
 
     for (;;)
     {
         /* Skip whitespace */
-        while (!feof(pXML->infile) && (ch = fgetc(pXML->infile)) <= ' ') /*lint !e160 Lint objects a GNU warning
-                                                                           suppression macro - OK */
+        while (!pRd->eof && (ch = trdp_XMLGetc(pRd)) <= ' ')
         {
             ;
         }
 
         /* Check for EOF */
-        if (feof(pXML->infile)) /*lint !e611 Lint for VxWorks gets lost in macro defintions*/
+        if (pRd->eof)
         {
             return TOK_EOF;
         }
@@ -86,38 +139,34 @@ static XML_TOKEN_T trdp_XMLNextToken (
         /* Handle quoted identifiers */
         if (ch == '"')
         {
-            p = pXML->tokenValue;
-            while (!feof(pXML->infile) && (ch = fgetc(pXML->infile)) != '"') /*lint !e160 Lint objects a GNU warning
-                                                                               suppression macro - OK */
+            pTok->start = pRd->pos;
+            while (!pRd->eof && (ch = trdp_XMLGetc(pRd)) != '"')
             {
-                if (p < (pXML->tokenValue + MAX_TOK_LEN - 1))
+                if (pTok->len < (MAX_TOK_LEN - 1u))
                 {
-                    *(p++) = (char) ch;
+                    pTok->len++;
                 }
             }
-
-            *(p++) = 0;
             return TOK_ID;
         }
         else if (ch == '<')
         {
             /* Tag start character */
-            ch = fgetc(pXML->infile);    /*lint !e160 Lint objects a GNU warning suppression macro - OK */
+            ch = trdp_XMLGetc(pRd);
 
             if (ch == '?') /* Skip processing instruction */
             {
-                while (!feof(pXML->infile) && (ch = fgetc(pXML->infile))) /*lint !e160 Lint objects a GNU warning
-                                                                            suppression macro - OK */
+                while (!pRd->eof && (ch = trdp_XMLGetc(pRd)))
                 {
                     if (ch == '?')
                     {
-                        if ((ch = fgetc(pXML->infile)) == '>')
+                        if ((ch = trdp_XMLGetc(pRd)) == '>')
                         {
                             break;
                         }
                         else
                         {
-                            (void) ungetc(ch, pXML->infile);
+                            trdp_XMLUngetc(ch, pRd);
                         }
                     }
                 }
@@ -125,16 +174,14 @@ static XML_TOKEN_T trdp_XMLNextToken (
             else if (ch == '!')
             {
                 /* Is it a comment? */
-                if (!feof(pXML->infile) && (ch = fgetc(pXML->infile)))
+                if (!pRd->eof && (ch = trdp_XMLGetc(pRd)))
                 {
                     if (ch == '-')
                     {
-                        if ((ch = fgetc(pXML->infile) == '-'))
+                        if ((ch = (trdp_XMLGetc(pRd) == '-')))
                         {
                             int endTagCnt = 0;
-                            while (!feof(pXML->infile) && (ch = fgetc(pXML->infile))) /*lint !e160 Lint objects a GNU
-                                                                                        warning suppression macro - OK
-                                                                                        */
+                            while (!pRd->eof && (ch = trdp_XMLGetc(pRd)))
                             {
                                 if (ch == '-')
                                 {
@@ -151,25 +198,25 @@ static XML_TOKEN_T trdp_XMLNextToken (
                                 }
                             }
                             /* Exit on unexpected end-of-file */
-                            if (endTagCnt != 2 && feof(pXML->infile))
+                            if (endTagCnt != 2 && pRd->eof)
                             {
-                                pXML->error = TRDP_XML_PARSER_ERR;
+                                pTok->error = 1u;
                                 return TOK_EOF;
                             }
                         }
                     }
                     else
                     {
-                        while (!feof(pXML->infile) && (ch = fgetc(pXML->infile)) != '>')
+                        while (!pRd->eof && (ch = trdp_XMLGetc(pRd)) != '>')
                         {
                             ;
                         }
                     }
                 }
                 /* Exit on unexpected end-of-file */
-                if (feof(pXML->infile))
+                if (pRd->eof)
                 {
-                    pXML->error = TRDP_XML_PARSER_ERR;
+                    pTok->error = 1u;
                     return TOK_EOF;
                 }
             }
@@ -179,20 +226,20 @@ static XML_TOKEN_T trdp_XMLNextToken (
             }
             else
             {
-                (void) ungetc(ch, pXML->infile);
+                trdp_XMLUngetc(ch, pRd);
                 return TOK_OPEN;
             }
         }
         else if (ch == '/')
         {
-            ch = fgetc(pXML->infile); /*lint !e160 Lint objects a GNU warning suppression macro - OK */
+            ch = trdp_XMLGetc(pRd);
             if (ch == '>')
             {
                 return TOK_CLOSE_EMPTY;
             }
             else
             {
-                (void) ungetc(ch, pXML->infile);
+                trdp_XMLUngetc(ch, pRd);
             }
         }
         else if (ch == '>')
@@ -206,26 +253,24 @@ static XML_TOKEN_T trdp_XMLNextToken (
         else
         {
             /* Unquoted identifier */
-            p       = pXML->tokenValue;
-            *(p++)  = (char) ch;
-            while ((!feof(pXML->infile)) &&
-                   ((ch = fgetc(pXML->infile)) != '<') /*lint !e160 Lint objects a GNU warning suppression macro - OK */
+            pTok->start = pRd->pos - 1u;
+            pTok->len   = 1u;
+            while ((!pRd->eof) &&
+                   ((ch = trdp_XMLGetc(pRd)) != '<')
                    && (ch != '>')
                    && (ch != '=')
                    && (ch != '/')
                    && (ch > ' '))
             {
-                if (p < (pXML->tokenValue + MAX_TOK_LEN - 1u))
+                if (pTok->len < (MAX_TOK_LEN - 1u))
                 {
-                    *(p++) = (char) ch;
+                    pTok->len++;
                 }
             }
 
-            *(p++) = 0;
-
             if ((ch == '<') || (ch == '>') || (ch == '=') || (ch == '/'))
             {
-                (void) ungetc(ch, pXML->infile);
+                trdp_XMLUngetc(ch, pRd);
             }
 
             return TOK_ID;
@@ -233,6 +278,180 @@ static XML_TOKEN_T trdp_XMLNextToken (
     }
 }
 
+/**********************************************************************************************************************/
+/** Link the start of each element to the token following its end.
+ *    The depth is counted the way trdp_XMLNextTokenHl does, up to the first malformed tag.
+ *
+ *  @param[in]      pXML        Pointer to local data
+ *
+ *  @retval         none
+ */
+static void trdp_XMLLinkElements (
+    XML_HANDLE_T *pXML)
+{
+    XML_TOKEN_REC_T *pTokens    = pXML->pTokens;
+    UINT32          *pStack     = (UINT32 *) malloc(pXML->numTokens * sizeof(UINT32));
+    UINT32          sp          = 0u;
+    UINT32          lastId      = 0u;
+    UINT32          i           = 0u;
+
+    if (pStack == NULL)
+    {
+        return;     /* no links: elements are skipped token by token */
+    }
+
+    while (pTokens[i].token != TOK_EOF)
+    {
+        switch (pTokens[i].token)
+        {
+           case TOK_OPEN:
+               if (pTokens[i + 1u].token != TOK_ID)
+               {
+                   free(pStack);
+                   return;
+               }
+               pStack[sp++] = i;
+               lastId       = i + 1u;
+               i += 2u;
+               break;
+           case TOK_OPEN_END:
+               if (pTokens[i + 1u].token != TOK_ID)
+               {
+                   free(pStack);
+                   return;
+               }
+               lastId   = i + 1u;
+               i       += 2u;
+               if (sp > 0u)
+               {
+                   sp--;
+                   pTokens[pStack[sp]].next     = i;
+                   pTokens[pStack[sp]].lastId   = lastId;
+               }
+               break;
+           case TOK_CLOSE_EMPTY:
+               i++;
+               if (sp > 0u)
+               {
+                   sp--;
+                   pTokens[pStack[sp]].next     = i;
+                   pTokens[pStack[sp]].lastId   = lastId;
+               }
+               break;
+           case TOK_ID:
+               lastId = i;
+               i++;
+               break;
+           default:
+               i++;
+               break;
+        }
+    }
+    free(pStack);
+}
+
+/**********************************************************************************************************************/
+/** Tokenize the document in one pass and build the token index.
+ *
+ *  @param[in]      pXML        Pointer to local data
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory
+ */
+static TRDP_ERR_T trdp_XMLIndex (
+    XML_HANDLE_T *pXML)
+{
+    XML_READER_T    reader;
+    UINT32          size = XML_MIN_TOKENS;
+    XML_TOKEN_REC_T *pTok;
+
+    reader.pDoc = (const UINT8 *) pXML->pDoc;
+    reader.size = pXML->docSize;
+    reader.pos  = 0u;
+    reader.eof  = 0;
+
+    pXML->numTokens = 0u;
+    pXML->pTokens   = (XML_TOKEN_REC_T *) malloc(size * sizeof(XML_TOKEN_REC_T));
+
+    do
+    {
+        if (pXML->pTokens == NULL)
+        {
+            return TRDP_MEM_ERR;
+        }
+        if (pXML->numTokens == size)
+        {
+            XML_TOKEN_REC_T *pNew = (XML_TOKEN_REC_T *) realloc(pXML->pTokens, 2u * size * sizeof(XML_TOKEN_REC_T));
+            if (pNew == NULL)
+            {
+                free(pXML->pTokens);
+                pXML->pTokens = NULL;
+                return TRDP_MEM_ERR;
+            }
+            pXML->pTokens   = pNew;
+            size           *= 2u;
+        }
+        pTok = &pXML->pTokens[pXML->numTokens++];
+        memset(pTok, 0, sizeof(XML_TOKEN_REC_T));
+        pTok->token = (UINT32) trdp_XMLScanToken(&reader, pTok);
+    }
+    while (pTok->token != TOK_EOF);
+
+    trdp_XMLLinkElements(pXML);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Copy an identifier of the token index into tokenValue
+ *
+ *  @param[in]      pXML        Pointer to local data
+ *  @param[in]      pTok        Token index entry of the identifier
+ */
+static void trdp_XMLGetId (
+    XML_HANDLE_T            *pXML,
+    const XML_TOKEN_REC_T   *pTok)
+{
+    UINT32 i;
+
+    for (i = 0u; i < pTok->len; i++)
+    {
+        /* an unterminated quote at the end of the document reads EOF into the value */
+        pXML->tokenValue[i] = ((pTok->start + i) < pXML->docSize) ? pXML->pDoc[pTok->start + i] : (char) EOF;
+    }
+    pXML->tokenValue[i] = 0;
+}
+
+/**********************************************************************************************************************/
+/** Return next XML token from the token index.
+ *
+ *  @param[in]      pXML        Pointer to local data
+ *
+ *  @retval         TOK_OPEN ("<"), TOK_CLOSE (">"), TOK_OPEN_END = ("</"),
+ *                  TOK_CLOSE_EMPTY = ("/>"), TOK_EQUAL = ("="), TOK_ID, TOK_EOF
+ *
+ */
+static XML_TOKEN_T trdp_XMLNextToken (
+    XML_HANDLE_T *pXML)
+{
+    const XML_TOKEN_REC_T *pTok = &pXML->pTokens[pXML->curToken];
+
+    if (pTok->token == TOK_EOF)
+    {
+        if (pTok->error != 0u)
+        {
+            pXML->error = TRDP_XML_PARSER_ERR;
+        }
+        return TOK_EOF;
+    }
+
+    pXML->curToken++;
+    if (pTok->token == TOK_ID)
+    {
+        trdp_XMLGetId(pXML, pTok);
+    }
+    return (XML_TOKEN_T) pTok->token;
+}
+
 /**********************************************************************************************************************/
 /** Return next high level XML token.
  *    Any Id is stored in pXML->tokenValue
@@ -300,25 +519,127 @@ static XML_TOKEN_T trdp_XMLNextTokenHl (
 
 /**********************************************************************************************************************/
 /** Opens the XML parsing.
+ *    The file is mapped into memory (read on systems without mmap) and tokenized.
  *
  *  @param[in]      pXML        Pointer to local data
  *  @param[in]      file        Pathname of XML file
  *
- *  @retval         none
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_IO_ERR     file could not be read
+ *  @retval         TRDP_MEM_ERR    out of memory
  */
 TRDP_ERR_T trdp_XMLOpen (
     XML_HANDLE_T    *pXML,
     const char      *file)
 {
-    if ((pXML->infile = fopen(file, "r+b")) == NULL)
+    TRDP_ERR_T err;
+
+    memset(pXML, 0, sizeof(XML_HANDLE_T));
+
+#ifdef POSIX
     {
-        return TRDP_IO_ERR;
+        struct stat fileStat;
+        int         fd = open(file, O_RDONLY);
+
+        if (fd == -1)
+        {
+            return TRDP_IO_ERR;
+        }
+        if (fstat(fd, &fileStat) == -1)
+        {
+            (void) close(fd);
+            return TRDP_IO_ERR;
+        }
+        if (fileStat.st_size > 0)
+        {
+            void *pMap = mmap(NULL, (size_t) fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (pMap == MAP_FAILED)
+            {
+                (void) close(fd);
+                return TRDP_IO_ERR;
+            }
+            pXML->pDoc      = (const char *) pMap;
+            pXML->docSize   = (UINT32) fileStat.st_size;
+            pXML->docSource = XML_DOC_MAPPED;
+        }
+        (void) close(fd);
     }
+#else
+    {
+        FILE    *infile = fopen(file, "rb");
+        long    size;
 
-    pXML->tagDepth      = 0;
-    pXML->tagDepthSeek  = 0;
-    pXML->error         = TRDP_NO_ERR;
-    return TRDP_NO_ERR;
+        if (infile == NULL)
+        {
+            return TRDP_IO_ERR;
+        }
+        if ((fseek(infile, 0, SEEK_END) != 0) || ((size = ftell(infile)) < 0) || (fseek(infile, 0, SEEK_SET) != 0))
+        {
+            fclose(infile);
+            return TRDP_IO_ERR;
+        }
+        if (size > 0)
+        {
+            char *pDoc = (char *) malloc((size_t) size);
+
+            if (pDoc == NULL)
+            {
+                fclose(infile);
+                return TRDP_MEM_ERR;
+            }
+            if (fread(pDoc, 1u, (size_t) size, infile) != (size_t) size)
+            {
+                free(pDoc);
+                fclose(infile);
+                return TRDP_IO_ERR;
+            }
+            pXML->pDoc      = pDoc;
+            pXML->docSize   = (UINT32) size;
+            pXML->docSource = XML_DOC_ALLOC;
+        }
+        fclose(infile);
+    }
+#endif
+
+    err = trdp_XMLIndex(pXML);
+    if (err != TRDP_NO_ERR)
+    {
+        trdp_XMLClose(pXML);
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** Opens the XML parsing of a document in memory.
+ *    The buffer must stay valid until trdp_XMLClose is called.
+ *
+ *  @param[in]      pXML        Pointer to local data
+ *  @param[in]      pBuffer     XML document
+ *  @param[in]      bufSize     Size of the document
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory
+ */
+TRDP_ERR_T trdp_XMLOpenBuffer (
+    XML_HANDLE_T    *pXML,
+    const char      *pBuffer,
+    UINT32          bufSize)
+{
+    TRDP_ERR_T err;
+
+    memset(pXML, 0, sizeof(XML_HANDLE_T));
+
+    pXML->pDoc      = pBuffer;
+    pXML->docSize   = (pBuffer != NULL) ? bufSize : 0u;
+    pXML->docSource = XML_DOC_CALLER;
+
+    err = trdp_XMLIndex(pXML);
+    if (err != TRDP_NO_ERR)
+    {
+        trdp_XMLClose(pXML);
+    }
+    return err;
 }
 
 /**********************************************************************************************************************/
@@ -331,16 +652,13 @@ TRDP_ERR_T trdp_XMLOpen (
 void trdp_XMLRewind (
     XML_HANDLE_T *pXML)
 {
-    if (pXML->infile == NULL)
+    if (pXML->pTokens == NULL)
     {
         pXML->error = TRDP_XML_PARSER_ERR;
     }
-    else if (fseek(pXML->infile, 0, SEEK_SET) == -1)
-    {
-        pXML->error = TRDP_IO_ERR;
-    }
     else
     {
+        pXML->curToken      = 0u;
         pXML->tagDepth      = 0;
         pXML->tagDepthSeek  = 0;
         pXML->error         = TRDP_NO_ERR;
@@ -357,7 +675,28 @@ void trdp_XMLRewind (
 void trdp_XMLClose (
     XML_HANDLE_T *pXML)
 {
-    fclose(pXML->infile);
+    if (pXML->pTokens != NULL)
+    {
+        free(pXML->pTokens);
+        pXML->pTokens = NULL;
+    }
+    if (pXML->pDoc != NULL)
+    {
+#ifdef POSIX
+        if (pXML->docSource == XML_DOC_MAPPED)
+        {
+            (void) munmap((void *) pXML->pDoc, pXML->docSize);
+        }
+#endif
+        if (pXML->docSource == XML_DOC_ALLOC)
+        {
+            free((void *) pXML->pDoc);
+        }
+        pXML->pDoc = NULL;
+    }
+    pXML->docSize   = 0u;
+    pXML->numTokens = 0u;
+    pXML->curToken  = 0u;
 }
 
 /**********************************************************************************************************************/
@@ -397,6 +736,17 @@ int trdp_XMLSeekStartTagAny (
             vos_strncpy(tag, pXML->tokenTag, (UINT32) maxlen);
             ret = 0;
         }
+        else if ((token == TOK_START_TAG) && (pXML->tagDepth > pXML->tagDepthSeek) &&
+                 (pXML->pTokens[pXML->curToken - 2u].next != 0u))
+        {
+            /* Deeper element: continue after its end, as if it had been read token by token */
+            const XML_TOKEN_REC_T *pOpen = &pXML->pTokens[pXML->curToken - 2u];
+
+            trdp_XMLGetId(pXML, &pXML->pTokens[pOpen->lastId]);
+            vos_strncpy(pXML->tokenTag, pXML->tokenValue, MAX_TAG_LEN);
+            pXML->curToken = pOpen->next;
+            pXML->tagDepth--;
+        }
         /* else ignore */
     }
 
@@ -444,8 +794,7 @@ int trdp_XMLCountStartTag (
     char            buf[MAX_TAG_LEN + 1u];
     int             count = 0;
 
-    XML_HANDLE_T    safe        = *pXML;
-    off_t           last_read   = ftell(pXML->infile);
+    XML_HANDLE_T    safe = *pXML;
 
     do
     {
@@ -458,7 +807,6 @@ int trdp_XMLCountStartTag (
     while (ret == 0);
 
     *pXML = safe;
-    fseek(pXML->infile, (long) last_read, SEEK_SET);
     return count;
 }
 
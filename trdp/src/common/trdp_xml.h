@@ -16,6 +16,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Document held in memory (mapped or buffer), tokenized once into an index
  *      BL 2016-02-11: Ticket #102: Replacing libxml2
  *
  */
@@ -65,14 +66,30 @@ typedef enum
     TOK_ATTRIBUTE       /* "<" character    */
 } XML_TOKEN_T;
 
+/* Token index entry, the document is tokenized once when opened */
+typedef struct XML_TOKEN_REC
+{
+    UINT32  token;      /* XML_TOKEN_T (low level token)    */
+    UINT32  start;      /* TOK_ID: offset of the identifier in the document  */
+    UINT32  len;        /* TOK_ID: length of the identifier (truncated as tokenValue)  */
+    UINT32  next;       /* TOK_OPEN: index of the token after the end of this element, 0 if unknown   */
+    UINT32  lastId;     /* TOK_OPEN: index of the last TOK_ID of this element (next != 0)   */
+    UINT32  error;      /* TOK_EOF: unexpected end of file    */
+} XML_TOKEN_REC_T;
+
 typedef struct XML_HANDLE
 {
-    FILE    *infile;
-    char    tokenValue[MAX_TOK_LEN];
-    int     tagDepth;
-    int     tagDepthSeek;
-    char    tokenTag[MAX_TAG_LEN + 1];
-    int     error;
+    const char      *pDoc;          /* document text    */
+    UINT32          docSize;        /* size of the document text */
+    int             docSource;      /* document mapped, read into memory or provided by the caller */
+    XML_TOKEN_REC_T *pTokens;       /* token index  */
+    UINT32          numTokens;      /* number of tokens in the index, the last one is TOK_EOF  */
+    UINT32          curToken;       /* index of the next token to be returned   */
+    char            tokenValue[MAX_TOK_LEN];
+    int             tagDepth;
+    int             tagDepthSeek;
+    char            tokenTag[MAX_TAG_LEN + 1];
+    int             error;
 } XML_HANDLE_T, *TRDP_XML_HANDLE_T;
 
 /*******************************************************************************
@@ -81,6 +98,9 @@ typedef struct XML_HANDLE
 
 TRDP_ERR_T  trdp_XMLOpen (XML_HANDLE_T  *pXML,
                           const char    *file);
+TRDP_ERR_T  trdp_XMLOpenBuffer (XML_HANDLE_T    *pXML,
+                                const char      *pBuffer,
+                                UINT32          bufSize);
 void        trdp_XMLClose (XML_HANDLE_T *pXML);
 int         trdp_XMLCountStartTag (
     XML_HANDLE_T    *pXML,
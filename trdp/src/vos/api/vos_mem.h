@@ -17,6 +17,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: VOS_MEM_MAX_BLOCKSIZE
  *      BL 2017-05-08: Compiler warnings, doxygen comment errors
  */
 
@@ -45,6 +46,7 @@ extern "C" {
 
 #define VOS_MEM_MAX_PREALLOCATE     10u  /**< Max blocks to pre-allocate */
 #define VOS_MEM_NBLOCKSIZES         15u  /**< No of pre-defined block sizes */
+#define VOS_MEM_MAX_BLOCKSIZE       131072u  /**< Largest of the pre-defined block sizes */
 
 /** Queue policy matching pthread/Posix defines    */
 typedef enum
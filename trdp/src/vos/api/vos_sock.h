@@ -16,6 +16,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Vectored send (vos_sockSendUDPv, vos_sockSendTCPv)
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
  *      BL 2018-03-06: 64Bit endian swap added
  *      BL 2017-05-22: Ticket #122: Addendum for 64Bit compatibility (VOS_TIME_T -> VOS_TIMEVAL_T)
@@ -107,6 +108,8 @@ extern "C" {
 
 #define VOS_INVALID_SOCKET  -1      /**< Invalid socket number */
 
+#define VOS_MAX_IOV_CNT     4       /**< The maximum number of buffers gathered by one vectored send */
+
 #define VOS_INADDR_ANY      INADDR_ANY
 
 #define VOS_DEFAULT_IFACE   cDefaultIface
@@ -135,6 +138,13 @@ typedef struct
 
 typedef fd_set VOS_FDS_T;
 
+/** Buffer descriptor for vectored (gather) sending  */
+typedef struct
+{
+    const UINT8 *pBuffer;   /**< start of the buffer                                */
+    UINT32      size;       /**< number of bytes to send from this buffer           */
+} VOS_IOVEC_T;
+
 typedef struct
 {
     CHAR8           name[VOS_MAX_IF_NAME_SIZE]; /**< interface adapter name         */
@@ -456,6 +466,31 @@ EXT_DECL VOS_ERR_T vos_sockSendUDP (
     UINT32      ipAddress,
     UINT16      port);
 
+/**********************************************************************************************************************/
+/** Send UDP data gathered from several buffers.
+ *  The buffers are sent as one datagram to the given address and port, without copying them together first.
+ *
+ *  @param[in]      sock               socket descriptor
+ *  @param[in]      iov                array of buffers to send
+ *  @param[in]      iovCnt             number of buffers (1...VOS_MAX_IOV_CNT)
+ *  @param[out]     pSize              no of bytes sent
+ *  @param[in]      ipAddress          destination IP
+ *  @param[in]      port               destination port
+ *
+ *  @retval         VOS_NO_ERR         no error
+ *  @retval         VOS_PARAM_ERR      parameter out of range/invalid
+ *  @retval         VOS_IO_ERR         data could not be sent
+ *  @retval         VOS_BLOCK_ERR      Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPv (
+    SOCKET              sock,
+    const VOS_IOVEC_T   iov[],
+    UINT32              iovCnt,
+    UINT32              *pSize,
+    UINT32              ipAddress,
+    UINT16              port);
+
 /**********************************************************************************************************************/
 /** Receive UDP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -584,6 +619,28 @@ EXT_DECL VOS_ERR_T vos_sockSendTCP (
     const UINT8 *pBuffer,
     UINT32      *pSize);
 
+/**********************************************************************************************************************/
+/** Send TCP data gathered from several buffers.
+ *  The buffers are written to the stream in order, without copying them together first.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      iov             array of buffers to send
+ *  @param[in]      iovCnt          number of buffers (1...VOS_MAX_IOV_CNT)
+ *  @param[out]     pSize           no of bytes sent
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_NOCONN_ERR  no TCP connection
+ *  @retval         VOS_BLOCK_ERR   call would have blocked in blocking mode, data partially sent
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendTCPv (
+    SOCKET              sock,
+    const VOS_IOVEC_T   iov[],
+    UINT32              iovCnt,
+    UINT32              *pSize);
+
 /**********************************************************************************************************************/
 /** Receive TCP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -16,6 +16,11 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: VOS_ATOMIC_FETCH_ADD, acquire/release load and store, VOS_THREAD_LOCAL
+ *      AG 2026-10-18: VOS_MEMORY_BARRIER
+ *      AG 2026-10-18: VOS_ATOMIC_ counter macros, VOS_CACHE_LINE_SIZE
+ *      AG 2026-10-18: vos_getTimeNs and nanosecond conversions
+ *      AG 2026-10-18: vos_cyclicThreadEx: absolute deadlines, catch-up/skip policy and statistics
  *      BL 2017-05-22: Ticket #122: Addendum for 64Bit compatibility (VOS_TIME_T -> VOS_TIMEVAL_T)
  */
 
@@ -54,6 +59,28 @@ extern "C" {
 /** Timeout value to wait forever for a semaphore */
 #define VOS_SEMA_WAIT_FOREVER  0xFFFFFFFFU
 
+/** Number of slots of the cyclic thread execution time histogram  */
+#define VOS_CYCLIC_HIST_SIZE   16u
+
+/** Conversions between the nanosecond time base and us / timeval  */
+#define VOS_NS_PER_USEC         1000u
+#define VOS_NS_PER_SEC          1000000000u
+#define VOS_NS_FROM_USEC(us)    ((VOS_TIME_NS_T)(us) * VOS_NS_PER_USEC)
+#define VOS_NS_TO_USEC(ns)      ((ns) / VOS_NS_PER_USEC)
+#define VOS_NS_FROM_TIMEVAL(pTv)                                                \
+    (((VOS_TIME_NS_T)(pTv)->tv_sec * VOS_NS_PER_SEC) +                          \
+     ((VOS_TIME_NS_T)(pTv)->tv_usec * VOS_NS_PER_USEC))
+#define VOS_NS_TO_TIMEVAL(pTv, ns)                                              \
+    do {                                                                        \
+        (pTv)->tv_sec   = (long)((ns) / VOS_NS_PER_SEC);                        \
+        (pTv)->tv_usec  = (long)(((ns) % VOS_NS_PER_SEC) / VOS_NS_PER_USEC);    \
+    } while (0)
+
+/** Size of a cache line, used to keep data of different writers apart  */
+#ifndef VOS_CACHE_LINE_SIZE
+#define VOS_CACHE_LINE_SIZE     64u
+#endif
+
 #if (defined(WIN32) || defined(WIN64))
 #include <winsock2.h>
 #else
@@ -97,6 +124,40 @@ extern "C" {
 #endif
 
 
+/** Atomic operations on UINT32 counters.
+ *  Relaxed ordering: the counters are statistics, they need no ordering with other data, but a reader in another
+ *  thread must neither see torn values nor lose increments.
+ *  VOS_MEMORY_BARRIER orders all memory accesses before it against all accesses after it (full fence).
+ *  VOS_ATOMIC_STORE_RELEASE / VOS_ATOMIC_LOAD_ACQUIRE publish data written before the store to a reader which
+ *  loads the stored value (single writer, e.g. the head index of a ring buffer).
+ *  VOS_THREAD_LOCAL declares a variable with one instance per thread; it is left undefined if the compiler
+ *  has no support for it.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define VOS_ATOMIC_ADD(pCnt, val)       ((void) __atomic_fetch_add((pCnt), (val), __ATOMIC_RELAXED))
+#define VOS_ATOMIC_SUB(pCnt, val)       ((void) __atomic_fetch_sub((pCnt), (val), __ATOMIC_RELAXED))
+#define VOS_ATOMIC_FETCH_ADD(pCnt, val) __atomic_fetch_add((pCnt), (val), __ATOMIC_RELAXED)
+#define VOS_ATOMIC_LOAD(pCnt)           __atomic_load_n((pCnt), __ATOMIC_RELAXED)
+#define VOS_ATOMIC_STORE(pCnt, val)     __atomic_store_n((pCnt), (val), __ATOMIC_RELAXED)
+#define VOS_ATOMIC_LOAD_ACQUIRE(pCnt)   __atomic_load_n((pCnt), __ATOMIC_ACQUIRE)
+#define VOS_ATOMIC_STORE_RELEASE(pCnt, val) __atomic_store_n((pCnt), (val), __ATOMIC_RELEASE)
+#define VOS_MEMORY_BARRIER()            __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define VOS_THREAD_LOCAL                __thread
+#elif defined(_MSC_VER)
+#define VOS_ATOMIC_ADD(pCnt, val)       ((void) InterlockedExchangeAdd((volatile LONG *)(pCnt), (LONG)(val)))
+#define VOS_ATOMIC_SUB(pCnt, val)       ((void) InterlockedExchangeAdd((volatile LONG *)(pCnt), -(LONG)(val)))
+#define VOS_ATOMIC_FETCH_ADD(pCnt, val) ((UINT32) InterlockedExchangeAdd((volatile LONG *)(pCnt), (LONG)(val)))
+#define VOS_ATOMIC_LOAD(pCnt)           (*(volatile UINT32 *)(pCnt))
+#define VOS_ATOMIC_STORE(pCnt, val)     ((void) InterlockedExchange((volatile LONG *)(pCnt), (LONG)(val)))
+#define VOS_ATOMIC_LOAD_ACQUIRE(pCnt)   (*(volatile UINT32 *)(pCnt))    /* volatile has acquire semantics */
+#define VOS_ATOMIC_STORE_RELEASE(pCnt, val) ((void) InterlockedExchange((volatile LONG *)(pCnt), (LONG)(val)))
+#define VOS_MEMORY_BARRIER()            MemoryBarrier()
+#define VOS_THREAD_LOCAL                __declspec(thread)
+#else
+/* A read-modify-write through volatile is not atomic, the statistics would lose increments */
+#error "VOS_ATOMIC_ADD/SUB/LOAD/STORE are not defined for this compiler"
+#endif
+
 /***********************************************************************************************************************
  * TYPEDEFS
  */
@@ -123,6 +184,28 @@ typedef enum
 } VOS_SEMA_STATE_T;
 
 
+/** Handling of deadlines missed by a cyclic thread    */
+typedef enum
+{
+    VOS_CYCLIC_SKIP     = 0,            /**< Missed deadlines are dropped, next call on the next deadline ahead  */
+    VOS_CYCLIC_CATCH_UP = 1             /**< Missed deadlines are called back to back until in time again       */
+} VOS_CYCLIC_POLICY_T;
+
+/** Statistics of a cyclic thread, written by the thread only, all times in us    */
+typedef struct
+{
+    UINT32  interval;                   /**< configured interval                                    */
+    UINT32  cycles;                     /**< number of calls of the thread function                 */
+    UINT32  overruns;                   /**< calls which returned after the next deadline           */
+    UINT32  skipped;                    /**< deadlines dropped by VOS_CYCLIC_SKIP                   */
+    UINT32  maxLateness;                /**< max. delay of a call behind its deadline               */
+    UINT32  avgLateness;                /**< average delay of a call behind its deadline            */
+    UINT32  maxExecTime;                /**< max. runtime of the thread function                    */
+    UINT32  execTimeHist[VOS_CYCLIC_HIST_SIZE]; /**< runtimes, slot 0: < 1us, slot n: < 2^n us,
+                                                     last slot: all longer runtimes                 */
+    UINT64  sumLateness;                /**< sum of all delays, base of avgLateness                 */
+} VOS_CYCLIC_STATISTICS_T;
+
 /** Hidden mutex handle definition    */
 typedef struct VOS_MUTEX *VOS_MUTEX_T;
 
@@ -208,6 +291,27 @@ EXT_DECL void vos_cyclicThread (
     VOS_THREAD_FUNC_T   pFunction,
     void                *pArguments);
 
+/**********************************************************************************************************************/
+/** Cyclic thread functions with deadline policy and statistics.
+ *  The thread function is called on absolute deadlines (start + n * interval), the period does not drift with
+ *  wake-up latency or runtime. Deadlines missed due to an overrun are handled according to policy.
+ *  The statistics are written by the calling thread only, a reader in another thread may see a cycle in progress.
+ *
+ *  @param[in]      interval        Interval for cyclic threads in us (incl. runtime)
+ *  @param[in]      policy          Handling of missed deadlines
+ *  @param[out]     pStatistics     Pointer to statistics, cleared on entry (optional)
+ *  @param[in]      pFunction       Pointer to the thread function
+ *  @param[in]      pArguments      Pointer to the thread function parameters
+ *  @retval         void
+ */
+
+EXT_DECL void vos_cyclicThreadEx (
+    UINT32                  interval,
+    VOS_CYCLIC_POLICY_T     policy,
+    VOS_CYCLIC_STATISTICS_T *pStatistics,
+    VOS_THREAD_FUNC_T       pFunction,
+    void                    *pArguments);
+
 /**********************************************************************************************************************/
 /** Terminate a thread.
  *  This call will terminate the thread with the given threadId and release all resources. Depending on the
@@ -277,6 +381,16 @@ EXT_DECL VOS_ERR_T vos_threadSelf (
 EXT_DECL void vos_getTime (
     VOS_TIMEVAL_T *pTime);
 
+/**********************************************************************************************************************/
+/** Return the current monotonic time in ns
+ *  Same time base as vos_getTime(), cheaper to compare and to add to than VOS_TIMEVAL_T
+ *
+ *  @retval         time in ns
+ */
+
+EXT_DECL VOS_TIME_NS_T vos_getTimeNs (
+    void);
+
 
 /**********************************************************************************************************************/
 /** Get a time-stamp string.
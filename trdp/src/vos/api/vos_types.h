@@ -16,6 +16,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: VOS_TIME_NS_T, 64 bit nanosecond time
  *      BL 2018-06-25: Ticket #202: vos_mutexTrylock return value
  *      BL 2018-05-03: no inline if < C99
  *      BL 2017-11-17: Undone: Ticket #169 Encapsulate declaration of packed structures within a macro
@@ -237,6 +238,11 @@ typedef struct
  */
 typedef struct timeval VOS_TIMEVAL_T;
 
+/** Monotonic time in ns (same time base as VOS_TIMEVAL_T from vos_getTime()).
+ *      Relative or absolute, depending on usage; 0 means 'not set' for absolute times
+ */
+typedef UINT64 VOS_TIME_NS_T;
+
 #ifndef TIMEDATE32
 #define TIMEDATE32  UINT32
 #endif
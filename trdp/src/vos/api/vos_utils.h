@@ -16,6 +16,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Log level threshold (vos_setLogLevel, VOS_LOG_MAX_LEVEL), checked before formatting
  *     AHW 2018-11-28: Doxygen comment errors
  *      BL 2017-05-08: Compiler warnings, doxygen comment errors
  *      BL 2017-02-08: Ticket #142: Compiler warnings / MISRA-C 2012 issues
@@ -45,6 +46,19 @@ extern "C" {
 
 extern VOS_PRINT_DBG_T gPDebugFunction;
 extern void *gRefCon;
+extern VOS_LOG_T gVosLogLevel;
+
+/** Highest log level compiled in (0 = VOS_LOG_ERROR ... 3 = VOS_LOG_DBG).
+    Calls with a higher level are removed by the compiler, VOS_LOG_USR output is always kept. */
+#ifndef VOS_LOG_MAX_LEVEL
+#define VOS_LOG_MAX_LEVEL       3
+#endif
+
+/** TRUE if output of this level is compiled in, passes the runtime threshold and has a receiver.
+    Evaluated before the arguments of the log call, so suppressed output costs one compare. */
+#define VOS_LOG_ENABLED(level)                                                              \
+    (((((level) <= VOS_LOG_MAX_LEVEL) && ((level) <= gVosLogLevel)) || ((level) == VOS_LOG_USR)) \
+     && (gPDebugFunction != NULL))
 
 /** String size definitions for the debug output functions */
 #define VOS_MAX_PRNT_STR_SIZE   256u         /**< Max. size of the debug/error string of debug function */
@@ -71,7 +85,7 @@ extern void *gRefCon;
 #endif
 
 /** Debug output macro without formatting options */
-#define vos_printLogStr(level, string)  {if (gPDebugFunction != NULL)         \
+#define vos_printLogStr(level, string)  {if (VOS_LOG_ENABLED(level))          \
                                          {gPDebugFunction(gRefCon,            \
                                                           (level),            \
                                                           vos_getTimeStamp(), \
@@ -82,7 +96,7 @@ extern void *gRefCon;
 /** Debug output macro with formatting options */
 #if (defined (WIN32) || defined (WIN64))
     #define vos_printLog(level, format, ...)                                   \
-    {if (gPDebugFunction != NULL)                                              \
+    {if (VOS_LOG_ENABLED(level))                                               \
      {   char str[VOS_MAX_PRNT_STR_SIZE];                                      \
          (void) _snprintf_s(str, sizeof(str), _TRUNCATE, format, __VA_ARGS__); \
          vos_printLogStr(level, str);                                          \
@@ -90,7 +104,7 @@ extern void *gRefCon;
     }
 #elif defined(__clang__)
     #define vos_printLog(level, format, ...)                    \
-    {if (gPDebugFunction != NULL)                               \
+    {if (VOS_LOG_ENABLED(level))                                \
      {   char str[VOS_MAX_PRNT_STR_SIZE];                       \
          (void)snprintf(str, sizeof(str), format, __VA_ARGS__); \
          vos_printLogStr(level, str);                           \
@@ -98,7 +112,7 @@ extern void *gRefCon;
     }
 #else
     #define vos_printLog(level, format, args ...)            \
-    {if (gPDebugFunction != NULL)                            \
+    {if (VOS_LOG_ENABLED(level))                             \
      {   char str[VOS_MAX_PRNT_STR_SIZE];                    \
          (void) snprintf(str, sizeof(str), format, ## args); \
          vos_printLogStr(level, str);                        \
@@ -210,6 +224,27 @@ EXT_DECL VOS_ERR_T vos_init (
     void            *pRefCon,
     VOS_PRINT_DBG_T pDebugOutput);
 
+/**********************************************************************************************************************/
+/** Set the log level threshold.
+ *  Output of a higher level (less severe) is dropped before it is formatted. VOS_LOG_USR output is always passed.
+ *  The default is VOS_LOG_DBG (all output).
+ *
+ *  @param[in]        level             highest level to pass to the debug output function
+ *  @retval           VOS_NO_ERR        no error
+ *  @retval           VOS_PARAM_ERR     unknown level
+ */
+
+EXT_DECL VOS_ERR_T vos_setLogLevel (
+    VOS_LOG_T level);
+
+/**********************************************************************************************************************/
+/** Return the log level threshold.
+ *
+ *  @retval           current threshold
+ */
+
+EXT_DECL VOS_LOG_T vos_getLogLevel (void);
+
 /**********************************************************************************************************************/
 /** DeInitialize the vos library.
  *  Should be called last after TRDP stack/application does not use any VOS function anymore.
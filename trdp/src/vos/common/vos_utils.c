@@ -17,6 +17,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: vos_setLogLevel / vos_getLogLevel
  *      BL 2017-05-08: Compiler warnings
  *      BL 2017-02-27: #142 Compiler warnings / MISRA-C 2012 issues
  *      BL 2016-08-17: parentheses added (compiler warning)
@@ -56,6 +57,7 @@
 
 VOS_PRINT_DBG_T gPDebugFunction = NULL;
 void *gRefCon = NULL;
+VOS_LOG_T gVosLogLevel = VOS_LOG_DBG;
 
 /***********************************************************************************************************************
  *  LOCALS
@@ -451,6 +453,37 @@ VOS_ERR_T vos_init (
     return vos_sockInit();
 }
 
+/**********************************************************************************************************************/
+/** Set the log level threshold.
+ *  Output of a higher level (less severe) is dropped before it is formatted. VOS_LOG_USR output is always passed.
+ *
+ *  @param[in]        level             highest level to pass to the debug output function
+ *  @retval           VOS_NO_ERR        no error
+ *  @retval           VOS_PARAM_ERR     unknown level
+ */
+
+EXT_DECL VOS_ERR_T vos_setLogLevel (
+    VOS_LOG_T level)
+{
+    if (level > VOS_LOG_USR)
+    {
+        return VOS_PARAM_ERR;
+    }
+    gVosLogLevel = level;
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Return the log level threshold.
+ *
+ *  @retval           current threshold
+ */
+
+EXT_DECL VOS_LOG_T vos_getLogLevel (void)
+{
+    return gVosLogLevel;
+}
+
 /**********************************************************************************************************************/
 /** DeInitialize the vos library.
  *  Should be called last after TRDP stack/application does not use any VOS function anymore.
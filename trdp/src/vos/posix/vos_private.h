@@ -16,6 +16,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: VOS_SHRD keeps size and creator of the shared memory area
  */
 
 #ifndef VOS_PRIVATE_H
@@ -57,6 +58,8 @@ struct VOS_SHRD
 {
     INT32   fd;                     /* File descriptor */
     CHAR8   *sharedMemoryName;      /* shared memory Name */
+    UINT32  size;                   /* size of the mapping */
+    BOOL8   created;                /* TRUE if this process created the area */
 };
 
 VOS_ERR_T   vos_mutexLocalCreate (struct VOS_MUTEX *pMutex);
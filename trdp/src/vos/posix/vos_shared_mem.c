@@ -16,6 +16,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Attach to an existing area without clearing it, close unmaps and only the creator unlinks
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
  *      BL 2018-05-03: Ticket #193 Unused parameter warnings
  *      BL 2016-07-06: Ticket #122 64Bit compatibility (+ compiler warnings)
@@ -89,55 +90,98 @@ EXT_DECL VOS_ERR_T vos_sharedOpen (
     UINT8       * *ppMemoryArea,
     UINT32      *pSize)
 {
-    VOS_ERR_T       ret         = VOS_MEM_ERR;
     mode_t          PERMISSION  = 0666;      /* Shared Memory permission is rw-rw-rw- */
-    static INT32    fd;                      /* Shared Memory file descriptor */
+    INT32           fd;                      /* Shared Memory file descriptor */
     struct    stat  sharedMemoryStat;        /* Shared Memory Stat */
+    BOOL8           created     = TRUE;
+    UINT8           *pArea;
 
-    /* Shared Memory Open */
-    fd = shm_open(pKey, O_CREAT | O_RDWR, PERMISSION);
+    if ((pKey == NULL) || (pHandle == NULL) || (ppMemoryArea == NULL) || (pSize == NULL))
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    /* Shared Memory Create, or Open if it exists already */
+    fd = shm_open(pKey, O_CREAT | O_EXCL | O_RDWR, PERMISSION);
+    if ((fd == -1) && (errno == EEXIST))
+    {
+        created = FALSE;
+        fd      = shm_open(pKey, O_RDWR, PERMISSION);
+    }
     if (fd == -1)
     {
         vos_printLogStr(VOS_LOG_ERROR, "Shared Memory Create failed\n");
-        return ret;
+        return VOS_MEM_ERR;
     }
-    /* Shared Memory acquire */
-    if (ftruncate(fd, (off_t )*pSize) == -1)
+    /* Shared Memory acquire, an existing area keeps its size */
+    if (created && (ftruncate(fd, (off_t )*pSize) == -1))
     {
         vos_printLogStr(VOS_LOG_ERROR, "Shared Memory Acquire failed\n");
-        return ret;
+        (void) close(fd);
+        (void) shm_unlink(pKey);
+        return VOS_MEM_ERR;
     }
     /* Get Shared Memory Stats */
-    (void) fstat(fd, &sharedMemoryStat);
-    if (sharedMemoryStat.st_size != (off_t )*pSize)
+    if ((fstat(fd, &sharedMemoryStat) == -1) ||
+        (sharedMemoryStat.st_size == 0) ||
+        (created && (sharedMemoryStat.st_size != (off_t )*pSize)))
     {
         vos_printLogStr(VOS_LOG_ERROR, "Shared Memory Size failed\n");
-        return ret;
+        (void) close(fd);
+        if (created)
+        {
+            (void) shm_unlink(pKey);
+        }
+        return VOS_MEM_ERR;
     }
 
     /* Mapping Shared Memory */
-    *ppMemoryArea = (UINT8*) mmap(NULL, (size_t) sharedMemoryStat.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-    if (*ppMemoryArea == MAP_FAILED)
+    pArea = (UINT8 *) mmap(NULL, (size_t) sharedMemoryStat.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (pArea == (UINT8 *) MAP_FAILED)
     {
         vos_printLogStr(VOS_LOG_ERROR, "Shared Memory memory-mapping failed\n");
-        return ret;
+        (void) close(fd);
+        if (created)
+        {
+            (void) shm_unlink(pKey);
+        }
+        return VOS_MEM_ERR;
+    }
+    /* Initialize Shared Memory, but not the contents of somebody else */
+    if (created)
+    {
+        memset(pArea, 0, (size_t) sharedMemoryStat.st_size);
     }
-    /* Initialize Shared Memory */
-    memset(*ppMemoryArea, 0, sharedMemoryStat.st_size);
     /* Handle */
     *pHandle = (VOS_SHRD_T) vos_memAlloc(sizeof (struct VOS_SHRD));
-    if (*pHandle == NULL)
+    if (*pHandle != NULL)
     {
-        vos_printLogStr(VOS_LOG_ERROR, "Shared Memory Handle create failed\n");
-        return ret;
+        (*pHandle)->sharedMemoryName = (CHAR8 *) vos_memAlloc((UINT32) strlen(pKey) + 1u);
     }
-    else
+    if ((*pHandle == NULL) || ((*pHandle)->sharedMemoryName == NULL))
     {
-        (*pHandle)->fd = fd;
+        vos_printLogStr(VOS_LOG_ERROR, "Shared Memory Handle create failed\n");
+        if (*pHandle != NULL)
+        {
+            vos_memFree(*pHandle);
+            *pHandle = NULL;
+        }
+        (void) munmap(pArea, (size_t) sharedMemoryStat.st_size);
+        (void) close(fd);
+        if (created)
+        {
+            (void) shm_unlink(pKey);
+        }
+        return VOS_MEM_ERR;
     }
+    strcpy((*pHandle)->sharedMemoryName, pKey);
+    (*pHandle)->fd      = fd;
+    (*pHandle)->size    = (UINT32) sharedMemoryStat.st_size;
+    (*pHandle)->created = created;
 
-    ret = VOS_NO_ERR;
-    return ret;
+    *ppMemoryArea   = pArea;
+    *pSize          = (UINT32) sharedMemoryStat.st_size;
+    return VOS_NO_ERR;
 }
 
 /**********************************************************************************************************************/
@@ -156,17 +200,29 @@ EXT_DECL VOS_ERR_T vos_sharedClose (
     VOS_SHRD_T  handle,
     const UINT8 *pMemoryArea)
 {
-    pMemoryArea = pMemoryArea;
+    VOS_ERR_T ret = VOS_NO_ERR;
 
+    if (handle == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+    if ((pMemoryArea != NULL) && (munmap((void *) pMemoryArea, (size_t) handle->size) == -1))
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "Shared Memory unmap failed\n");
+        ret = VOS_MEM_ERR;
+    }
     if (close(handle->fd) == -1)
     {
         vos_printLogStr(VOS_LOG_ERROR, "Shared Memory file close failed\n");
-        return VOS_MEM_ERR;
+        ret = VOS_MEM_ERR;
     }
-    if (shm_unlink(handle->sharedMemoryName) == -1)
+    /* Only the creator removes the name, attached processes just detach */
+    if (handle->created && (shm_unlink(handle->sharedMemoryName) == -1))
     {
         vos_printLogStr(VOS_LOG_ERROR, "Shared Memory unLink failed\n");
-        return VOS_MEM_ERR;
+        ret = VOS_MEM_ERR;
     }
-    return VOS_NO_ERR;
+    vos_memFree(handle->sharedMemoryName);
+    vos_memFree(handle);
+    return ret;
 }
@@ -16,6 +16,8 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: vos_getTimeNs, 64 bit nanosecond monotonic time
+ *      AG 2026-10-18: vos_cyclicThread sleeps until absolute deadlines (clock_nanosleep), vos_cyclicThreadEx
  *      BL 2018-06-25: Ticket #202: vos_mutexTrylock return value
  *      BL 2018-05-03: Ticket #194: Platform independent format specifiers in vos_printLog
  *      BL 2018-04-18: Ticket #195: Invalid thread handle (SEGFAULT)
@@ -39,6 +41,8 @@
 #include <unistd.h>
 #include <errno.h>
 #include <sys/time.h>
+#include <time.h>
+#include <string.h>
 #include <limits.h>
 #include <pthread.h>
 #include <semaphore.h>
@@ -134,6 +138,7 @@ int sem_init (sem_t *pSema, int flags, unsigned int mode)
 /**********************************************************************************************************************/
 /** Cyclic thread functions.
  *  Wrapper for cyclic threads. The thread function will be called cyclically with interval.
+ *  Missed deadlines are skipped, see vos_cyclicThreadEx.
  *
  *  @param[in]      interval        Interval for cyclic threads in us (incl. runtime)
  *  @param[in]      pFunction       Pointer to the thread function
@@ -144,61 +149,143 @@ int sem_init (sem_t *pSema, int flags, unsigned int mode)
 #define NSECS_PER_USEC  1000u
 #define USECS_PER_MSEC  1000u
 #define MSECS_PER_SEC   1000u
+#define NSECS_PER_SEC   1000000000u
 
-/* This define holds the max amount os seconds to get stored in 32bit holding micro seconds        */
-/* It is the result when using the common time struct with tv_sec and tv_usec as on a 32 bit value */
-/* so far 0..999999 gets used for the tv_usec field as per definition, then 0xFFF0BDC0 usec        */
-/* are remaining to represent the seconds, which in turn give 0x10C5 seconds or in decimal 4293    */
-#define MAXSEC_FOR_USECPRESENTATION  4293
+/* Clock of the cyclic thread deadlines, same time base as vos_getTimeNs() */
+#ifdef CLOCK_MONOTONIC
+#define VOS_CYCLIC_CLOCK    CLOCK_MONOTONIC
+#else
+#define VOS_CYCLIC_CLOCK    CLOCK_REALTIME
+#endif
 
 EXT_DECL void vos_cyclicThread (
     UINT32              interval,
     VOS_THREAD_FUNC_T   pFunction,
     void                *pArguments)
 {
-    VOS_TIMEVAL_T   priorCall;
-    VOS_TIMEVAL_T   afterCall;
+    vos_cyclicThreadEx(interval, VOS_CYCLIC_SKIP, NULL, pFunction, pArguments);
+}
+
+/**********************************************************************************************************************/
+/** Sleep until an absolute time of the cyclic thread clock
+ *
+ *  @param[in]      deadline        time in ns
+ */
+
+static void vos_cyclicSleepUntil (
+    UINT64 deadline)
+{
+#ifdef __APPLE__
+    UINT64 now = vos_getTimeNs();
+
+    /* no clock_nanosleep, fall back to a relative delay */
+    if (deadline > now)
+    {
+        (void) vos_threadDelay((UINT32)((deadline - now) / NSECS_PER_USEC));
+    }
+#else
+    struct timespec wakeup;
+
+    wakeup.tv_sec   = (time_t)(deadline / NSECS_PER_SEC);
+    wakeup.tv_nsec  = (long)(deadline % NSECS_PER_SEC);
+
+    /* returns at once if the deadline has already passed */
+    while (clock_nanosleep(VOS_CYCLIC_CLOCK, TIMER_ABSTIME, &wakeup, NULL) == EINTR)
+    {
+        ;
+    }
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Cyclic thread functions with deadline policy and statistics.
+ *  The thread function is called on absolute deadlines (start + n * interval), the period does not drift with
+ *  wake-up latency or runtime. Deadlines missed due to an overrun are handled according to policy.
+ *
+ *  @param[in]      interval        Interval for cyclic threads in us (incl. runtime)
+ *  @param[in]      policy          Handling of missed deadlines
+ *  @param[out]     pStatistics     Pointer to statistics, cleared on entry (optional)
+ *  @param[in]      pFunction       Pointer to the thread function
+ *  @param[in]      pArguments      Pointer to the thread function parameters
+ *  @retval         void
+ */
+
+EXT_DECL void vos_cyclicThreadEx (
+    UINT32                  interval,
+    VOS_CYCLIC_POLICY_T     policy,
+    VOS_CYCLIC_STATISTICS_T *pStatistics,
+    VOS_THREAD_FUNC_T       pFunction,
+    void                    *pArguments)
+{
+    const UINT64    period = (UINT64) interval * NSECS_PER_USEC;
+    UINT64          deadline;
+    UINT64          priorCall;
+    UINT64          afterCall;
+    UINT64          missed;
+    UINT32          lateness;
     UINT32          execTime;
-    UINT32          waitingTime;
+    UINT32          slot;
+
+    if (pStatistics != NULL)
+    {
+        memset(pStatistics, 0, sizeof(VOS_CYCLIC_STATISTICS_T));
+        pStatistics->interval = interval;
+    }
+
+    deadline = vos_getTimeNs();
     for (;; )
     {
-        vos_getTime(&priorCall);  /* get initial time */
-        pFunction(pArguments);    /* perform thread function */
-        vos_getTime(&afterCall);  /* get time after function ghas returned */
-        /* subtract in the pattern after - prior to get the runtime of function() */
-        vos_subTime(&afterCall, &priorCall);
-        /* afterCall holds now the time difference within a structure not compatible with interval */
-        /* check if UINT32 fits to hold the waiting time value */
-        if (afterCall.tv_sec <= MAXSEC_FOR_USECPRESENTATION)
+        priorCall = vos_getTimeNs();    /* get initial time */
+        pFunction(pArguments);          /* perform thread function */
+        afterCall = vos_getTimeNs();    /* get time after function has returned */
+
+        lateness    = (priorCall > deadline) ? (UINT32)((priorCall - deadline) / NSECS_PER_USEC) : 0u;
+        execTime    = (UINT32)((afterCall - priorCall) / NSECS_PER_USEC);
+        deadline    += period;
+
+        if (afterCall >= deadline)
         {
-            /*           sec to usec conversion value normalized from 0 .. 999999*/
-            execTime =
-                ((UINT32) ((UINT32)afterCall.tv_sec * MSECS_PER_SEC * USECS_PER_MSEC) + (UINT32)afterCall.tv_usec);
-            if (execTime > interval)
+            /*severe error: cyclic task time violated*/
+            missed = 0u;
+            if ((policy == VOS_CYCLIC_SKIP) && (period > 0u))
             {
-                /*severe error: cyclic task time violated*/
-                waitingTime = 0U;
-                /* Log the runtime violation */
-                vos_printLog(VOS_LOG_ERROR,
-                             "cyclic thread with interval %u usec was running  %u usec\n",
-                             (unsigned int)interval, (unsigned int)execTime);
+                /* continue on the next deadline ahead, the grid is kept */
+                missed      = (afterCall - deadline) / period + 1u;
+                deadline    += missed * period;
             }
-            else
+            /* Log the deadline violation (runtime or late call) */
+            vos_printLog(VOS_LOG_ERROR,
+                         "cyclic thread with interval %u usec was running  %u usec, %u usec late\n",
+                         (unsigned int)interval, (unsigned int)execTime, (unsigned int)lateness);
+            if (pStatistics != NULL)
             {
-                waitingTime = interval - execTime;
+                pStatistics->overruns++;
+                pStatistics->skipped += (UINT32) missed;
             }
         }
-        else
+
+        if (pStatistics != NULL)
         {
-            /* seems a very critical overflow has happened - or simply a misconfiguration */
-            /* as a rough first guess use zero waiting time here */
-            waitingTime = 0U;
-            /* Have this value range violation logged */
-            vos_printLog(VOS_LOG_ERROR,
-                         "cyclic thread with interval %u usec exceeded time out by running %ld sec\n",
-                         (unsigned int)interval, (long)afterCall.tv_sec);
+            pStatistics->cycles++;
+            pStatistics->sumLateness    += lateness;
+            pStatistics->avgLateness    = (UINT32)(pStatistics->sumLateness / pStatistics->cycles);
+            if (lateness > pStatistics->maxLateness)
+            {
+                pStatistics->maxLateness = lateness;
+            }
+            if (execTime > pStatistics->maxExecTime)
+            {
+                pStatistics->maxExecTime = execTime;
+            }
+            /* slot n counts runtimes below 2^n us */
+            for (slot = 0u; (slot < VOS_CYCLIC_HIST_SIZE - 1u) && ((execTime >> slot) != 0u); slot++)
+            {
+                ;
+            }
+            pStatistics->execTimeHist[slot]++;
         }
-        (void) vos_threadDelay(waitingTime);
+
+        vos_cyclicSleepUntil(deadline);
         pthread_testcancel();
     }
 }
@@ -567,6 +654,27 @@ EXT_DECL void vos_getTime (
     }
 }
 
+/**********************************************************************************************************************/
+/** Return the current monotonic time in ns
+ *
+ *  @retval         time in ns, same time base as vos_getTime()
+ */
+
+EXT_DECL VOS_TIME_NS_T vos_getTimeNs (void)
+{
+#ifndef CLOCK_MONOTONIC
+    struct timeval myTime;
+
+    (void)gettimeofday(&myTime, NULL);
+    return ((VOS_TIME_NS_T) myTime.tv_sec * NSECS_PER_SEC) + ((VOS_TIME_NS_T) myTime.tv_usec * NSECS_PER_USEC);
+#else
+    struct timespec currentTime;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &currentTime);
+    return ((VOS_TIME_NS_T) currentTime.tv_sec * NSECS_PER_SEC) + (VOS_TIME_NS_T) currentTime.tv_nsec;
+#endif
+}
+
 /**********************************************************************************************************************/
 /** Get a time-stamp string.
  *  Get a time-stamp string for debugging in the form "yyyymmdd-hh:mm:ss.ms"
@@ -16,6 +16,7 @@
  *
  * $Id$*
  *
+ *      AG 2026-10-18: vos_sockSendUDPv / vos_sockSendTCPv (gather send) added
  *      BL 2018-11-26: Ticket #208: Mapping corrected after complaint (Bit 2 was set for prio 2 & 4)
  *      BL 2018-07-13: Ticket #208: VOS socket options: QoS/ToS field priority handling needs update
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
@@ -985,6 +986,89 @@ EXT_DECL VOS_ERR_T vos_sockSendUDP (
     return VOS_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Send UDP data gathered from several buffers.
+ *  The buffers are sent as one datagram to the given address and port, without copying them together first.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      iov             array of buffers to send
+ *  @param[in]      iovCnt          number of buffers (1...VOS_MAX_IOV_CNT)
+ *  @param[out]     pSize           no of bytes sent
+ *  @param[in]      ipAddress       destination IP
+ *  @param[in]      port            destination port
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPv (
+    SOCKET              sock,
+    const VOS_IOVEC_T   iov[],
+    UINT32              iovCnt,
+    UINT32              *pSize,
+    UINT32              ipAddress,
+    UINT16              port)
+{
+    struct sockaddr_in  destAddr;
+    struct iovec        vec[VOS_MAX_IOV_CNT];
+    struct msghdr       msg;
+    ssize_t             sendSize = 0;
+    UINT32              i;
+
+    if (sock == -1 || iov == NULL || pSize == NULL || iovCnt == 0u || iovCnt > VOS_MAX_IOV_CNT)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    *pSize = 0;
+
+    /*      We send UDP packets to the address  */
+    memset(&destAddr, 0, sizeof(destAddr));
+    destAddr.sin_family         = AF_INET;
+    destAddr.sin_addr.s_addr    = vos_htonl(ipAddress);
+    destAddr.sin_port           = vos_htons(port);
+
+    for (i = 0u; i < iovCnt; i++)
+    {
+        vec[i].iov_base = (caddr_t) iov[i].pBuffer;
+        vec[i].iov_len  = iov[i].size;
+    }
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name    = (caddr_t) &destAddr;
+    msg.msg_namelen = sizeof(destAddr);
+    msg.msg_iov     = vec;
+    msg.msg_iovlen  = iovCnt;
+
+    do
+    {
+        sendSize = sendmsg(sock, &msg, 0);
+
+        if (sendSize >= 0)
+        {
+            *pSize += (UINT32) sendSize;
+        }
+
+        if (sendSize == -1 && errno == EWOULDBLOCK)
+        {
+            return VOS_BLOCK_ERR;
+        }
+    }
+    while (sendSize == -1 && errno == EINTR);
+
+    if (sendSize == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_ERROR, "sendmsg() to %s:%u failed (Err: %s)\n",
+                     inet_ntoa(destAddr.sin_addr), (unsigned int)port, buff);
+        return VOS_IO_ERR;
+    }
+    return VOS_NO_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Receive UDP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -1404,6 +1488,103 @@ EXT_DECL VOS_ERR_T vos_sockSendTCP (
     return VOS_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Send TCP data gathered from several buffers.
+ *  The buffers are written to the stream in order, without copying them together first.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      iov             array of buffers to send
+ *  @param[in]      iovCnt          number of buffers (1...VOS_MAX_IOV_CNT)
+ *  @param[out]     pSize           no of bytes sent
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_NOCONN_ERR  no TCP connection
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendTCPv (
+    SOCKET              sock,
+    const VOS_IOVEC_T   iov[],
+    UINT32              iovCnt,
+    UINT32              *pSize)
+{
+    struct iovec    vec[VOS_MAX_IOV_CNT];
+    struct msghdr   msg;
+    ssize_t         sendSize    = 0;
+    size_t          bufferSize  = 0;
+    UINT32          i;
+
+    if (sock == -1 || iov == NULL || pSize == NULL || iovCnt == 0u || iovCnt > VOS_MAX_IOV_CNT)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    *pSize = 0;
+
+    for (i = 0u; i < iovCnt; i++)
+    {
+        vec[i].iov_base = (caddr_t) iov[i].pBuffer;
+        vec[i].iov_len  = iov[i].size;
+        bufferSize     += iov[i].size;
+    }
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov     = vec;
+    msg.msg_iovlen  = iovCnt;
+
+    /* Keep on sending until we got rid of all data or we received an unrecoverable error */
+    do
+    {
+        sendSize = sendmsg(sock, &msg, 0);
+        if (sendSize > 0)
+        {
+            size_t sent = (size_t) sendSize;
+
+            bufferSize  -= sent;
+            *pSize      += (UINT32) sent;
+
+            /* Skip the buffers (or parts of) already sent */
+            while ((msg.msg_iovlen > 0) && (sent >= msg.msg_iov->iov_len))
+            {
+                sent -= msg.msg_iov->iov_len;
+                msg.msg_iov++;
+                msg.msg_iovlen--;
+            }
+            if (sent > 0)
+            {
+                msg.msg_iov->iov_base   = (caddr_t) ((UINT8 *) msg.msg_iov->iov_base + sent);
+                msg.msg_iov->iov_len   -= sent;
+            }
+        }
+        if (sendSize == -1 && errno == EWOULDBLOCK)
+        {
+            return VOS_BLOCK_ERR;
+        }
+    }
+    while (bufferSize && !(sendSize == -1 && errno != EINTR));
+
+    if (sendSize == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_WARNING, "sendmsg() failed (Err: %s)\n", buff);
+
+        if ((errno == ENOTCONN)
+            || (errno == ECONNREFUSED)
+            || (errno == EHOSTUNREACH))
+        {
+            return VOS_NOCONN_ERR;
+        }
+        else
+        {
+            return VOS_IO_ERR;
+        }
+    }
+    return VOS_NO_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Receive TCP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -16,6 +16,8 @@
  *
  * $Id$*
  *
+ *      AG 2026-10-18: vos_getTimeNs
+ *      AG 2026-10-18: vos_cyclicThreadEx (fallback to vos_cyclicThread)
  *      BL 2018-10-29: Ticket #215: use CLOCK_MONOTONIC if available
  *      BL 2018-06-25: Ticket #202: vos_mutexTrylock return value
  *      BL 2018-05-03: Ticket #195: Invalid thread handle (SEGFAULT)
@@ -141,6 +143,35 @@ void vos_cyclicThread (
     }
 }
 
+/**********************************************************************************************************************/
+/** Cyclic thread functions with deadline policy and statistics.
+ *  Absolute deadlines are not implemented for this target: the thread runs as vos_cyclicThread,
+ *  policy is ignored and the statistics stay cleared.
+ *
+ *  @param[in]      interval        Interval for cyclic threads in us (incl. runtime)
+ *  @param[in]      policy          Handling of missed deadlines (ignored)
+ *  @param[out]     pStatistics     Pointer to statistics, cleared on entry (optional)
+ *  @param[in]      pFunction       Pointer to the thread function
+ *  @param[in]      pArguments      Pointer to the thread function parameters
+ *  @retval         void
+ */
+
+EXT_DECL void vos_cyclicThreadEx (
+    UINT32                  interval,
+    VOS_CYCLIC_POLICY_T     policy,
+    VOS_CYCLIC_STATISTICS_T *pStatistics,
+    VOS_THREAD_FUNC_T       pFunction,
+    void                    *pArguments)
+{
+    (void) policy;
+    if (pStatistics != NULL)
+    {
+        memset(pStatistics, 0, sizeof(VOS_CYCLIC_STATISTICS_T));
+        pStatistics->interval = interval;
+    }
+    vos_cyclicThread(interval, pFunction, pArguments);
+}
+
 /**********************************************************************************************************************/
 /** Initialize the thread library.
  *  Must be called once before any other call (why?)
@@ -383,6 +414,20 @@ EXT_DECL void vos_getTime (
     }
 }
 
+/**********************************************************************************************************************/
+/** Return the current monotonic time in ns
+ *
+ *  @retval         time in ns, same time base as vos_getTime()
+ */
+
+EXT_DECL VOS_TIME_NS_T vos_getTimeNs (void)
+{
+    VOS_TIMEVAL_T now;
+
+    vos_getTime(&now);
+    return VOS_NS_FROM_TIMEVAL(&now);
+}
+
 /**********************************************************************************************************************/
 /** Get a time-stamp string.
  *  Get a time-stamp string for debugging in the form "yyyymmdd-hh:mm:ss.ms"
@@ -17,6 +17,7 @@
  *
  * $Id$*
  *
+ *      AG 2026-10-18: vos_sockSendUDPv / vos_sockSendTCPv (gather send) added
  *      BL 2018-11-26: Ticket #208: Mapping corrected after complaint (Bit 2 was set for prio 2 & 4)
  *      SB 2018-07-20: Ticket #209: vos_getInterfaces returning incorrect "name" and "linkState" on windows (requires
  *                                  at least windows vista now).
@@ -1142,6 +1143,88 @@ EXT_DECL VOS_ERR_T vos_sockSendUDP (
 
 
 
+/**********************************************************************************************************************/
+/** Send UDP data gathered from several buffers.
+ *  The buffers are sent as one datagram to the given address and port, without copying them together first.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      iov             array of buffers to send
+ *  @param[in]      iovCnt          number of buffers (1...VOS_MAX_IOV_CNT)
+ *  @param[out]     pSize           no of bytes sent
+ *  @param[in]      ipAddress       destination IP
+ *  @param[in]      port            destination port
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPv (
+    SOCKET              sock,
+    const VOS_IOVEC_T   iov[],
+    UINT32              iovCnt,
+    UINT32              *pSize,
+    UINT32              ipAddress,
+    UINT16              port)
+{
+    struct sockaddr_in  destAddr;
+    WSABUF              wsabuf[VOS_MAX_IOV_CNT];
+    DWORD               sendSize    = 0;
+    int                 res         = 0;
+    int                 err         = 0;
+    UINT32              i;
+
+    if ((sock == (SOCKET)INVALID_SOCKET)
+        || (iov == NULL)
+        || (pSize == NULL)
+        || (iovCnt == 0u)
+        || (iovCnt > VOS_MAX_IOV_CNT))
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    *pSize = 0;
+
+    /*      We send UDP packets to the address  */
+    memset(&destAddr, 0, sizeof(destAddr));
+    destAddr.sin_family         = AF_INET;
+    destAddr.sin_addr.s_addr    = vos_htonl(ipAddress);
+    destAddr.sin_port           = vos_htons(port);
+
+    for (i = 0u; i < iovCnt; i++)
+    {
+        wsabuf[i].buf   = (CHAR *) iov[i].pBuffer;
+        wsabuf[i].len   = iov[i].size;
+    }
+
+    do
+    {
+        res = WSASendTo(sock, wsabuf, (DWORD) iovCnt, &sendSize, 0,
+                        (struct sockaddr *) &destAddr, sizeof(destAddr), NULL, NULL);
+        err = WSAGetLastError();
+
+        if (res == 0)
+        {
+            *pSize += (UINT32) sendSize;
+        }
+
+        if (res == SOCKET_ERROR && err == WSAEWOULDBLOCK)
+        {
+            return VOS_BLOCK_ERR;
+        }
+    }
+    while (res == SOCKET_ERROR && err == WSAEINTR);
+
+    if (res == SOCKET_ERROR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "WSASendTo() to %s:%u failed (Err: %d)\n",
+                     inet_ntoa(destAddr.sin_addr), port, err);
+        return VOS_IO_ERR;
+    }
+    return VOS_NO_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Receive UDP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -1562,6 +1645,103 @@ EXT_DECL VOS_ERR_T vos_sockSendTCP (
     return VOS_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Send TCP data gathered from several buffers.
+ *  The buffers are written to the stream in order, without copying them together first.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      iov             array of buffers to send
+ *  @param[in]      iovCnt          number of buffers (1...VOS_MAX_IOV_CNT)
+ *  @param[out]     pSize           no of bytes sent
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_NOCONN_ERR  no TCP connection
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendTCPv (
+    SOCKET              sock,
+    const VOS_IOVEC_T   iov[],
+    UINT32              iovCnt,
+    UINT32              *pSize)
+{
+    WSABUF  wsabuf[VOS_MAX_IOV_CNT];
+    WSABUF  *pBuf       = wsabuf;
+    DWORD   bufCnt      = (DWORD) iovCnt;
+    DWORD   sendSize    = 0;
+    UINT32  bufferSize  = 0;
+    int     res         = 0;
+    int     err         = 0;
+    UINT32  i;
+
+    if ((sock == (SOCKET)INVALID_SOCKET)
+        || (iov == NULL)
+        || (pSize == NULL)
+        || (iovCnt == 0u)
+        || (iovCnt > VOS_MAX_IOV_CNT))
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    *pSize = 0;
+
+    for (i = 0u; i < iovCnt; i++)
+    {
+        wsabuf[i].buf   = (CHAR *) iov[i].pBuffer;
+        wsabuf[i].len   = iov[i].size;
+        bufferSize     += iov[i].size;
+    }
+
+    /*    Keep on sending until we got rid of all data or we received an unrecoverable error    */
+    do
+    {
+        res = WSASend(sock, pBuf, bufCnt, &sendSize, 0, NULL, NULL);
+        err = WSAGetLastError();
+
+        if (res == 0)
+        {
+            bufferSize  -= (UINT32) sendSize;
+            *pSize      += (UINT32) sendSize;
+
+            /* Skip the buffers (or parts of) already sent */
+            while ((bufCnt > 0) && (sendSize >= pBuf->len))
+            {
+                sendSize -= pBuf->len;
+                pBuf++;
+                bufCnt--;
+            }
+            if (sendSize > 0)
+            {
+                pBuf->buf   += sendSize;
+                pBuf->len   -= sendSize;
+            }
+        }
+
+        if (res == SOCKET_ERROR && err == WSAEWOULDBLOCK)
+        {
+            return VOS_BLOCK_ERR;
+        }
+    }
+    while (bufferSize && !(res == SOCKET_ERROR && err != WSAEINTR));
+
+    if (res == SOCKET_ERROR)
+    {
+        vos_printLog(VOS_LOG_WARNING, "WSASend() failed (Err: %d)\n", err);
+
+        if (err == WSAENOTCONN)
+        {
+            return VOS_NOCONN_ERR;
+        }
+        else
+        {
+            return VOS_IO_ERR;
+        }
+    }
+    return VOS_NO_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Receive TCP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
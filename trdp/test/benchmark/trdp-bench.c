@@ -0,0 +1,1029 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-bench.c
+ *
+ * @brief           TRDP throughput and latency benchmarks on one host
+ *
+ * @details         Measures over loopback (or multicast, option -t) with two sessions on two local addresses:
+ *                  - PD publish throughput versus number of published telegrams
+ *                  - PD receive dispatch cost versus number of subscriptions
+ *                  - tlp_put/tlp_get latency with several application threads and a running process thread
+ *                  - MD request/reply round trip time and sessions/s over UDP and TCP
+ *                  - marshalling/unmarshalling throughput
+ *                  The results are written as CSV (default: stdout) and/or JSON, one record per measured value.
+ *                  All runs use fixed telegram counts, sizes and durations (scaled by -s), so results of two builds
+ *                  on the same host can be compared directly.
+ *
+ * @note            Project: TRDP
+ *
+ * @author          TCNOpen TRDP contributors
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen TRDP contributors, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+
+/***********************************************************************************************************************
+ * INCLUDES
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <unistd.h>
+#include <sys/select.h>
+
+#include "trdp_if_light.h"
+#include "tau_marshall.h"
+#include "vos_sock.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION             "1.0"
+
+#define BENCH_MAX_RESULTS       256u
+#define BENCH_COMID_BASE        30000u          /* PD comIds BENCH_COMID_BASE... */
+#define BENCH_MD_COMID          31000u
+#define BENCH_DS_COMID          32000u          /* marshalling dataset and comId */
+#define BENCH_PD_INTERVAL       10000u          /* shortest allowed PD cycle (TRDP_TIMER_GRANULARITY) */
+#define BENCH_PD_DATA_SIZE      64u
+#define BENCH_MD_DATA_SIZE      256u
+#define BENCH_MD_WINDOW         16u             /* outstanding requests in the pipelined MD run */
+#define BENCH_MD_TIMEOUT        1000000u        /* reply timeout in us */
+#define BENCH_MAX_THREADS       8u
+#define BENCH_MAX_POLL          10000u          /* max. select() wait in us */
+
+/** One measured value */
+typedef struct
+{
+    const char  *bench;                 /* benchmark name */
+    const char  *param;                 /* name of the varied parameter */
+    UINT32      paramValue;             /* value of the varied parameter */
+    const char  *metric;                /* what was measured */
+    double      value;                  /* result */
+    const char  *unit;                  /* unit of the result */
+} BENCH_RESULT_T;
+
+/** One MD request in flight */
+typedef struct
+{
+    VOS_TIME_NS_T   sent;               /* time of tlm_request */
+    VOS_TIME_NS_T   rtt;                /* round trip time, 0 until the reply arrived */
+    BOOL8           failed;             /* time out or error */
+} BENCH_MD_REQ_T;
+
+/** Worker of the tlp_put/tlp_get run */
+typedef struct
+{
+    TRDP_APP_SESSION_T  pubSession;
+    TRDP_APP_SESSION_T  subSession;
+    TRDP_PUB_T          pubHandle;
+    TRDP_SUB_T          subHandle;
+    UINT32              loops;
+    UINT32              *pPutNs;        /* latency of each tlp_put */
+    UINT32              *pGetNs;        /* latency of each tlp_get */
+} BENCH_WORKER_T;
+
+/** Native layout of the marshalling dataset, natural alignment as expected by tau_marshall */
+typedef struct
+{
+    UINT8   u8;
+    UINT16  u16;
+    UINT32  u32;
+    INT64   i64;
+    REAL32  r32;
+    REAL64  r64;
+    CHAR8   str[16];
+    UINT32  arr32[32];
+    INT16   arr16[16];
+} BENCH_DS_T;
+
+/***********************************************************************************************************************
+ * LOCALS
+ */
+static TRDP_IP_ADDR_T   gIpA        = 0x7F000001u;         /* 127.0.0.1 sender / caller */
+static TRDP_IP_ADDR_T   gIpB        = 0x7F000002u;         /* 127.0.0.2 receiver / replier */
+static TRDP_IP_ADDR_T   gDestMC     = 0u;                   /* multicast group, 0: unicast to gIpB */
+static UINT32           gScale      = 1u;                   /* duration / loop multiplier */
+static int              gVerbose    = FALSE;
+
+static BENCH_RESULT_T   gResult[BENCH_MAX_RESULTS];
+static UINT32           gNumResults = 0u;
+
+static UINT8            gData[TRDP_MAX_MD_DATA_SIZE];
+
+/* MD run state, written by the callbacks (called from tlc_process in the driving thread) */
+static BENCH_MD_REQ_T   *gpMdReq    = NULL;
+static UINT32           gMdDone     = 0u;
+static UINT32           gMdFailed   = 0u;
+
+/* put/get run state */
+static volatile BOOL8   gProcessRun = FALSE;
+static volatile BOOL8   gProcessStop = FALSE;
+static volatile BOOL8   gWorkersGo  = FALSE;
+static UINT32           gWorkersDone = 0u;
+
+static TRDP_DATASET_T   gDataSetBench =
+{
+    BENCH_DS_COMID,     /*    dataset/com ID  */
+    0,                  /*    reserved        */
+    9,                  /*    No of elements  */
+    {                   /*    TRDP_DATASET_ELEMENT_T[]    */
+        {TRDP_UINT8, 1, NULL, NULL, 0, 0, NULL},
+        {TRDP_UINT16, 1, NULL, NULL, 0, 0, NULL},
+        {TRDP_UINT32, 1, NULL, NULL, 0, 0, NULL},
+        {TRDP_INT64, 1, NULL, NULL, 0, 0, NULL},
+        {TRDP_REAL32, 1, NULL, NULL, 0, 0, NULL},
+        {TRDP_REAL64, 1, NULL, NULL, 0, 0, NULL},
+        {TRDP_CHAR8, 16, NULL, NULL, 0, 0, NULL},
+        {TRDP_UINT32, 32, NULL, NULL, 0, 0, NULL},
+        {TRDP_INT16, 16, NULL, NULL, 0, 0, NULL}
+    }
+};
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void bench_log (void *pRefCon, TRDP_LOG_T category, const CHAR8 *pTime, const CHAR8 *pFile,
+                       UINT16 lineNumber, const CHAR8 *pMsgStr);
+static void bench_record (const char *bench, const char *param, UINT32 paramValue, const char *metric,
+                          double value, const char *unit);
+
+
+/**********************************************************************************************************************/
+/** Log errors only, the measurements must not be disturbed by console output
+ */
+static void bench_log (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    (void) pRefCon;
+    (void) pTime;
+    if (category == VOS_LOG_ERROR)
+    {
+        fprintf(stderr, "%s:%d %s", strrchr(pFile, '/') ? strrchr(pFile, '/') + 1 : pFile, lineNumber, pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Store one result
+ */
+static void bench_record (
+    const char  *bench,
+    const char  *param,
+    UINT32      paramValue,
+    const char  *metric,
+    double      value,
+    const char  *unit)
+{
+    if (gNumResults < BENCH_MAX_RESULTS)
+    {
+        gResult[gNumResults].bench      = bench;
+        gResult[gNumResults].param      = param;
+        gResult[gNumResults].paramValue = paramValue;
+        gResult[gNumResults].metric     = metric;
+        gResult[gNumResults].value      = value;
+        gResult[gNumResults].unit       = unit;
+        gNumResults++;
+    }
+    if (gVerbose)
+    {
+        fprintf(stderr, "%-12s %s=%-5u %-16s %14.3f %s\n", bench, param, paramValue, metric, value, unit);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Sort helper for the latency percentiles
+ */
+static int bench_cmpU32 (
+    const void  *pA,
+    const void  *pB)
+{
+    UINT32 a = *(const UINT32 *) pA;
+    UINT32 b = *(const UINT32 *) pB;
+
+    return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+/**********************************************************************************************************************/
+/** Record mean, median, 99th percentile and maximum of a set of samples (ns), the array gets sorted
+ */
+static void bench_recordLatency (
+    const char  *bench,
+    const char  *param,
+    UINT32      paramValue,
+    const char  *what,
+    UINT32      *pSamples,
+    UINT32      count)
+{
+    static char names[BENCH_MAX_RESULTS][32];
+    static UINT32 numNames = 0u;
+    double      sum = 0.0;
+    UINT32      i;
+    const char  *suffix[4] = {"mean", "p50", "p99", "max"};
+    double      value[4];
+
+    if (count == 0u)
+    {
+        return;
+    }
+    qsort(pSamples, count, sizeof(UINT32), bench_cmpU32);
+    for (i = 0u; i < count; i++)
+    {
+        sum += pSamples[i];
+    }
+    value[0]    = sum / count;
+    value[1]    = pSamples[count / 2u];
+    value[2]    = pSamples[(UINT32) (((UINT64) count * 99u) / 100u)];
+    value[3]    = pSamples[count - 1u];
+
+    for (i = 0u; (i < 4u) && (numNames < BENCH_MAX_RESULTS); i++)
+    {
+        (void) snprintf(names[numNames], sizeof(names[0]), "%s_%s", what, suffix[i]);
+        bench_record(bench, param, paramValue, names[numNames], value[i] / 1000.0, "us");
+        numNames++;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Open the sending and the receiving session
+ */
+static TRDP_ERR_T bench_open (
+    TRDP_APP_SESSION_T *pSessionA,
+    TRDP_APP_SESSION_T *pSessionB)
+{
+    TRDP_ERR_T err;
+
+    err = tlc_openSession(pSessionA, gIpA, 0u, NULL, NULL, NULL, NULL);
+    if (err == TRDP_NO_ERR)
+    {
+        err = tlc_openSession(pSessionB, gIpB, 0u, NULL, NULL, NULL, NULL);
+        if (err != TRDP_NO_ERR)
+        {
+            (void) tlc_closeSession(*pSessionA);
+        }
+    }
+    if (err != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "tlc_openSession failed (Err: %d)\n", err);
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** One select() and one tlc_process pass for both sessions, returns the time spent in tlc_process per session
+ *  The select() waits at most maxPollUs. MD sends and time outs do not shorten the interval of tlc_getInterval,
+ *  so the MD runs poll with 0 while a session is pending, or each hop would wait for the select() time out.
+ */
+static void bench_poll (
+    TRDP_APP_SESSION_T  sessionA,
+    TRDP_APP_SESSION_T  sessionB,
+    UINT32              maxPollUs,
+    VOS_TIME_NS_T       *pBusyA,
+    VOS_TIME_NS_T       *pBusyB)
+{
+    TRDP_FDS_T      rfds;
+    TRDP_FDS_T      rfdsB;
+    INT32           noDesc  = 0;
+    INT32           rv;
+    INT32           rvB;
+    TRDP_TIME_T     tv;
+    TRDP_TIME_T     tvB;
+    TRDP_TIME_T     max_tv;
+    VOS_TIME_NS_T   t0;
+    VOS_TIME_NS_T   t1;
+
+    max_tv.tv_sec   = 0;
+    max_tv.tv_usec  = (INT32) maxPollUs;
+    FD_ZERO(&rfds);
+    (void) tlc_getInterval(sessionA, &tv, &rfds, &noDesc);
+    (void) tlc_getInterval(sessionB, &tvB, &rfds, &noDesc);
+    if (vos_cmpTime(&tvB, &tv) < 0)
+    {
+        tv = tvB;
+    }
+    if (vos_cmpTime(&tv, &max_tv) > 0)
+    {
+        tv = max_tv;
+    }
+    rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+    rfdsB   = rfds;
+    rvB     = rv;
+
+    t0 = vos_getTimeNs();
+    (void) tlc_process(sessionA, &rfds, &rv);
+    t1 = vos_getTimeNs();
+    (void) tlc_process(sessionB, &rfdsB, &rvB);
+    if (pBusyA != NULL)
+    {
+        *pBusyA += t1 - t0;
+    }
+    if (pBusyB != NULL)
+    {
+        *pBusyB += vos_getTimeNs() - t1;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Drive both sessions for a while
+ */
+static void bench_run (
+    TRDP_APP_SESSION_T  sessionA,
+    TRDP_APP_SESSION_T  sessionB,
+    UINT32              durationUs,
+    VOS_TIME_NS_T       *pBusyA,
+    VOS_TIME_NS_T       *pBusyB)
+{
+    VOS_TIME_NS_T end = vos_getTimeNs() + VOS_NS_FROM_USEC(durationUs);
+
+    while (vos_getTimeNs() < end)
+    {
+        bench_poll(sessionA, sessionB, BENCH_MAX_POLL, pBusyA, pBusyB);
+    }
+}
+
+/**********************************************************************************************************************/
+/** PD publish throughput versus number of published telegrams
+ *  All telegrams are sent with the shortest cycle. The send cost is the time spent in the sender's tlc_process per
+ *  sent packet, passes without a due telegram included.
+ */
+static void bench_pdPublish (
+    UINT32 numTelegrams)
+{
+    TRDP_APP_SESSION_T  sessionA;
+    TRDP_APP_SESSION_T  sessionB;
+    TRDP_PUB_T          pubHandle;
+    TRDP_STATISTICS_T   before;
+    TRDP_STATISTICS_T   after;
+    VOS_TIME_NS_T       busyA   = 0u;
+    VOS_TIME_NS_T       start;
+    VOS_TIME_NS_T       elapsed;
+    UINT32              sent;
+    UINT32              i;
+    TRDP_ERR_T          err     = TRDP_NO_ERR;
+
+    if (bench_open(&sessionA, &sessionB) != TRDP_NO_ERR)
+    {
+        return;
+    }
+    for (i = 0u; (i < numTelegrams) && (err == TRDP_NO_ERR); i++)
+    {
+        err = tlp_publish(sessionA, &pubHandle, NULL, NULL, BENCH_COMID_BASE + i, 0u, 0u, 0u,
+                          (gDestMC != 0u) ? gDestMC : gIpB, BENCH_PD_INTERVAL, 0u, TRDP_FLAGS_NONE, NULL,
+                          gData, BENCH_PD_DATA_SIZE);
+    }
+    if (err != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "tlp_publish failed (Err: %d)\n", err);
+    }
+    else
+    {
+        bench_run(sessionA, sessionB, 100000u, NULL, NULL);                 /* settle */
+        (void) tlc_getStatistics(sessionA, &before);
+        start = vos_getTimeNs();
+        bench_run(sessionA, sessionB, 1000000u * gScale, &busyA, NULL);
+        elapsed = vos_getTimeNs() - start;
+        (void) tlc_getStatistics(sessionA, &after);
+
+        sent = after.pd.numSend - before.pd.numSend;
+        bench_record("pd_publish", "telegrams", numTelegrams, "packets_per_s",
+                     (double) sent * 1e9 / (double) elapsed, "1/s");
+        if (sent > 0u)
+        {
+            bench_record("pd_publish", "telegrams", numTelegrams, "send_cost",
+                         (double) busyA / (double) sent, "ns/packet");
+            bench_record("pd_publish", "telegrams", numTelegrams, "capacity",
+                         (double) sent * 1e9 / (double) busyA, "1/s");
+        }
+    }
+    (void) tlc_closeSession(sessionA);
+    (void) tlc_closeSession(sessionB);
+}
+
+/**********************************************************************************************************************/
+/** PD receive dispatch cost versus number of subscriptions
+ *  The sender publishes up to 100 of the subscribed telegrams, the last ones subscribed.
+ */
+static void bench_pdReceive (
+    UINT32 numSubs)
+{
+    TRDP_APP_SESSION_T  sessionA;
+    TRDP_APP_SESSION_T  sessionB;
+    TRDP_PUB_T          pubHandle;
+    TRDP_SUB_T          subHandle;
+    TRDP_STATISTICS_T   before;
+    TRDP_STATISTICS_T   after;
+    VOS_TIME_NS_T       busyB   = 0u;
+    UINT32              numPub  = (numSubs < 100u) ? numSubs : 100u;
+    UINT32              received;
+    UINT32              i;
+    TRDP_ERR_T          err     = TRDP_NO_ERR;
+
+    if (bench_open(&sessionA, &sessionB) != TRDP_NO_ERR)
+    {
+        return;
+    }
+    for (i = 0u; (i < numSubs) && (err == TRDP_NO_ERR); i++)
+    {
+        err = tlp_subscribe(sessionB, &subHandle, NULL, NULL, BENCH_COMID_BASE + i, 0u, 0u, 0u, 0u,
+                            gDestMC, TRDP_FLAGS_NONE, TRDP_TIMER_FOREVER, TRDP_TO_KEEP_LAST_VALUE);
+    }
+    for (i = numSubs - numPub; (i < numSubs) && (err == TRDP_NO_ERR); i++)
+    {
+        err = tlp_publish(sessionA, &pubHandle, NULL, NULL, BENCH_COMID_BASE + i, 0u, 0u, 0u,
+                          (gDestMC != 0u) ? gDestMC : gIpB, BENCH_PD_INTERVAL, 0u, TRDP_FLAGS_NONE, NULL,
+                          gData, BENCH_PD_DATA_SIZE);
+    }
+    if (err != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "tlp_subscribe/tlp_publish failed (Err: %d)\n", err);
+    }
+    else
+    {
+        bench_run(sessionA, sessionB, 100000u, NULL, NULL);                 /* settle */
+        (void) tlc_getStatistics(sessionB, &before);
+        bench_run(sessionA, sessionB, 1000000u * gScale, NULL, &busyB);
+        (void) tlc_getStatistics(sessionB, &after);
+
+        received = after.pd.numRcv - before.pd.numRcv;
+        bench_record("pd_receive", "subscriptions", numSubs, "packets", (double) received, "1");
+        if (received > 0u)
+        {
+            bench_record("pd_receive", "subscriptions", numSubs, "dispatch_cost",
+                         (double) busyB / (double) received, "ns/packet");
+        }
+    }
+    (void) tlc_closeSession(sessionA);
+    (void) tlc_closeSession(sessionB);
+}
+
+/**********************************************************************************************************************/
+/** Process thread of the put/get run: keeps both sessions sending and receiving
+ */
+static void bench_processThread (
+    void *pArg)
+{
+    TRDP_APP_SESSION_T *pSessions = (TRDP_APP_SESSION_T *) pArg;
+
+    while (!gProcessStop)
+    {
+        bench_poll(pSessions[0], pSessions[1], BENCH_MAX_POLL, NULL, NULL);
+    }
+    gProcessRun = FALSE;
+}
+
+/**********************************************************************************************************************/
+/** Application thread of the put/get run
+ */
+static void bench_workerThread (
+    void *pArg)
+{
+    BENCH_WORKER_T  *pWorker = (BENCH_WORKER_T *) pArg;
+    TRDP_PD_INFO_T  pdInfo;
+    UINT8           buffer[BENCH_PD_DATA_SIZE];
+    UINT32          size;
+    VOS_TIME_NS_T   t0;
+    VOS_TIME_NS_T   t1;
+    VOS_TIME_NS_T   t2;
+    UINT32          i;
+
+    while (!gWorkersGo)
+    {
+        vos_threadDelay(1000u);
+    }
+    for (i = 0u; i < pWorker->loops; i++)
+    {
+        size    = sizeof(buffer);
+        gData[0] = (UINT8) i;
+        t0 = vos_getTimeNs();
+        (void) tlp_put(pWorker->pubSession, pWorker->pubHandle, gData, BENCH_PD_DATA_SIZE);
+        t1 = vos_getTimeNs();
+        (void) tlp_get(pWorker->subSession, pWorker->subHandle, &pdInfo, buffer, &size);
+        t2 = vos_getTimeNs();
+        pWorker->pPutNs[i]  = (UINT32) (t1 - t0);
+        pWorker->pGetNs[i]  = (UINT32) (t2 - t1);
+    }
+    VOS_ATOMIC_ADD(&gWorkersDone, 1u);
+}
+
+/**********************************************************************************************************************/
+/** tlp_put/tlp_get latency with several application threads competing with the process thread for the session lock
+ */
+static void bench_putGet (
+    UINT32 numThreads)
+{
+    TRDP_APP_SESSION_T  sessions[2];
+    BENCH_WORKER_T      worker[BENCH_MAX_THREADS];
+    VOS_THREAD_T        threadId;
+    UINT32              loops   = 20000u * gScale;
+    UINT32              *pPut   = NULL;
+    UINT32              *pGet   = NULL;
+    UINT32              i;
+    TRDP_ERR_T          err     = TRDP_NO_ERR;
+
+    if (bench_open(&sessions[0], &sessions[1]) != TRDP_NO_ERR)
+    {
+        return;
+    }
+    pPut    = (UINT32 *) malloc(numThreads * loops * sizeof(UINT32));
+    pGet    = (UINT32 *) malloc(numThreads * loops * sizeof(UINT32));
+    if ((pPut == NULL) || (pGet == NULL))
+    {
+        fprintf(stderr, "out of memory\n");
+        err = TRDP_MEM_ERR;
+    }
+    for (i = 0u; (i < numThreads) && (err == TRDP_NO_ERR); i++)
+    {
+        worker[i].pubSession    = sessions[0];
+        worker[i].subSession    = sessions[1];
+        worker[i].loops         = loops;
+        worker[i].pPutNs        = pPut + i * loops;
+        worker[i].pGetNs        = pGet + i * loops;
+        err = tlp_publish(sessions[0], &worker[i].pubHandle, NULL, NULL, BENCH_COMID_BASE + i, 0u, 0u, 0u,
+                          gIpB, BENCH_PD_INTERVAL, 0u, TRDP_FLAGS_NONE, NULL, gData, BENCH_PD_DATA_SIZE);
+        if (err == TRDP_NO_ERR)
+        {
+            err = tlp_subscribe(sessions[1], &worker[i].subHandle, NULL, NULL, BENCH_COMID_BASE + i, 0u, 0u,
+                                0u, 0u, 0u, TRDP_FLAGS_NONE, TRDP_TIMER_FOREVER, TRDP_TO_KEEP_LAST_VALUE);
+        }
+    }
+    if (err != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "put/get setup failed (Err: %d)\n", err);
+    }
+    else
+    {
+        gProcessStop    = FALSE;
+        gProcessRun     = TRUE;
+        gWorkersGo      = FALSE;
+        gWorkersDone    = 0u;
+        (void) vos_threadCreate(&threadId, "benchProcess", VOS_THREAD_POLICY_OTHER, 0u, 0u, 0u,
+                                bench_processThread, sessions);
+        for (i = 0u; i < numThreads; i++)
+        {
+            (void) vos_threadCreate(&threadId, "benchWorker", VOS_THREAD_POLICY_OTHER, 0u, 0u, 0u,
+                                    bench_workerThread, &worker[i]);
+        }
+        vos_threadDelay(100000u);                                           /* settle */
+        gWorkersGo = TRUE;
+        while (VOS_ATOMIC_LOAD(&gWorkersDone) < numThreads)
+        {
+            vos_threadDelay(10000u);
+        }
+        gProcessStop = TRUE;
+        while (gProcessRun)
+        {
+            vos_threadDelay(1000u);
+        }
+
+        bench_recordLatency("pd_put_get", "threads", numThreads, "put", pPut, numThreads * loops);
+        bench_recordLatency("pd_put_get", "threads", numThreads, "get", pGet, numThreads * loops);
+    }
+    free(pPut);
+    free(pGet);
+    (void) tlc_closeSession(sessions[0]);
+    (void) tlc_closeSession(sessions[1]);
+}
+
+/**********************************************************************************************************************/
+/** MD callback of both sessions: the replier answers requests, the caller takes the time of the reply
+ */
+static void bench_mdCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    BENCH_MD_REQ_T *pReq = (BENCH_MD_REQ_T *) pMsg->pUserRef;
+
+    (void) pRefCon;
+    (void) pData;
+
+    if (pMsg->msgType == TRDP_MSG_MR)
+    {
+        (void) tlm_reply(appHandle, &pMsg->sessionId, pMsg->comId, 0u, NULL, gData, dataSize);
+    }
+    else if ((pReq != NULL) && (pReq->rtt == 0u) && !pReq->failed)
+    {
+        if ((pMsg->msgType == TRDP_MSG_MP) && (pMsg->resultCode == TRDP_NO_ERR))
+        {
+            pReq->rtt = vos_getTimeNs() - pReq->sent;
+            if (pReq->rtt == 0u)
+            {
+                pReq->rtt = 1u;
+            }
+        }
+        else
+        {
+            pReq->failed = TRUE;
+            gMdFailed++;
+        }
+        gMdDone++;
+    }
+}
+
+/**********************************************************************************************************************/
+/** MD request/reply round trips, one after the other (window 1) and pipelined (window BENCH_MD_WINDOW)
+ */
+static void bench_md (
+    BOOL8 tcp,
+    UINT32 window)
+{
+    TRDP_APP_SESSION_T  sessionA;
+    TRDP_APP_SESSION_T  sessionB;
+    TRDP_LIS_T          listenHandle;
+    TRDP_UUID_T         sessionId;
+    TRDP_FLAGS_T        flags   = (TRDP_FLAGS_T) (TRDP_FLAGS_CALLBACK | (tcp ? TRDP_FLAGS_TCP : 0u));
+    const char          *bench  = tcp ? "md_tcp" : "md_udp";
+    UINT32              count   = 1000u * gScale;
+    UINT32              issued  = 0u;
+    UINT32              *pRtt   = NULL;
+    UINT32              numRtt  = 0u;
+    VOS_TIME_NS_T       start;
+    VOS_TIME_NS_T       elapsed;
+    VOS_TIME_NS_T       deadline;
+    UINT32              i;
+    TRDP_ERR_T          err;
+
+    if (bench_open(&sessionA, &sessionB) != TRDP_NO_ERR)
+    {
+        return;
+    }
+    gpMdReq = (BENCH_MD_REQ_T *) calloc(count, sizeof(BENCH_MD_REQ_T));
+    pRtt    = (UINT32 *) malloc(count * sizeof(UINT32));
+    gMdDone     = 0u;
+    gMdFailed   = 0u;
+
+    err = tlm_addListener(sessionB, &listenHandle, NULL, bench_mdCallback, TRUE, BENCH_MD_COMID, 0u, 0u,
+                          0u, VOS_INADDR_ANY, VOS_INADDR_ANY, flags, NULL, NULL);
+    if ((err != TRDP_NO_ERR) || (gpMdReq == NULL) || (pRtt == NULL))
+    {
+        fprintf(stderr, "MD setup failed (Err: %d)\n", err);
+    }
+    else
+    {
+        start       = vos_getTimeNs();
+        deadline    = start + VOS_NS_FROM_USEC(BENCH_MD_TIMEOUT) * 2u * count;
+        while ((gMdDone < count) && (vos_getTimeNs() < deadline))
+        {
+            while ((issued < count) && (issued - gMdDone < window))
+            {
+                gpMdReq[issued].sent = vos_getTimeNs();
+                err = tlm_request(sessionA, &gpMdReq[issued], bench_mdCallback, &sessionId, BENCH_MD_COMID, 0u, 0u,
+                                  0u, gIpB, flags, 1u, BENCH_MD_TIMEOUT, NULL, gData, BENCH_MD_DATA_SIZE,
+                                  NULL, NULL);
+                if (err != TRDP_NO_ERR)
+                {
+                    gpMdReq[issued].failed = TRUE;
+                    gMdFailed++;
+                    gMdDone++;
+                }
+                issued++;
+            }
+            /* requests or replies in flight: do not wait for the select() time out */
+            bench_poll(sessionA, sessionB, (issued > gMdDone) ? 0u : BENCH_MAX_POLL, NULL, NULL);
+        }
+        elapsed = vos_getTimeNs() - start;
+
+        for (i = 0u; i < issued; i++)
+        {
+            if (gpMdReq[i].rtt != 0u)
+            {
+                pRtt[numRtt++] = (UINT32) gpMdReq[i].rtt;
+            }
+        }
+        bench_record(bench, "window", window, "sessions_per_s", (double) numRtt * 1e9 / (double) elapsed, "1/s");
+        bench_record(bench, "window", window, "failed", (double) (gMdFailed + count - gMdDone), "1");
+        bench_recordLatency(bench, "window", window, "rtt", pRtt, numRtt);
+        (void) tlm_delListener(sessionB, listenHandle);
+    }
+    /* let the sessions finish before the next run */
+    bench_run(sessionA, sessionB, 10000u, NULL, NULL);
+
+    free(pRtt);
+    free(gpMdReq);
+    gpMdReq = NULL;
+    (void) tlc_closeSession(sessionA);
+    (void) tlc_closeSession(sessionB);
+}
+
+/**********************************************************************************************************************/
+/** Marshalling and unmarshalling throughput (native size of the dataset per second)
+ */
+static void bench_marshall (void)
+{
+    TRDP_COMID_DSID_MAP_T   comIdMap[]  = {{BENCH_DS_COMID, BENCH_DS_COMID}};
+    TRDP_DATASET_T          *pDatasets[] = {&gDataSetBench};
+    void                    *pRefCon    = NULL;
+    BENCH_DS_T              src;
+    BENCH_DS_T              copy;
+    UINT8                   wire[sizeof(BENCH_DS_T) * 2u];
+    UINT32                  wireSize;
+    UINT32                  copySize;
+    UINT32                  loops       = 200000u * gScale;
+    UINT32                  i;
+    VOS_TIME_NS_T           start;
+    VOS_TIME_NS_T           elapsed;
+    TRDP_ERR_T              err;
+
+    err = tau_initMarshall(&pRefCon, 1u, comIdMap, 1u, pDatasets);
+    if (err != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "tau_initMarshall failed (Err: %d)\n", err);
+        return;
+    }
+
+    memset(&src, 0, sizeof(src));
+    src.u8  = 0x12u;
+    src.u16 = 0x3456u;
+    src.u32 = 0x789ABCDEu;
+    src.i64 = -1234567890123LL;
+    src.r32 = 3.5f;
+    src.r64 = -2.25;
+    vos_strncpy(src.str, "benchmark", sizeof(src.str));
+    for (i = 0u; i < 32u; i++)
+    {
+        src.arr32[i] = i * 0x01010101u;
+    }
+    for (i = 0u; i < 16u; i++)
+    {
+        src.arr16[i] = (INT16) (i * -7);
+    }
+
+    /* the dataset layout must match, or the numbers are meaningless */
+    wireSize    = sizeof(wire);
+    copySize    = sizeof(copy);
+    memset(&copy, 0, sizeof(copy));
+    if ((tau_marshall(pRefCon, BENCH_DS_COMID, (UINT8 *) &src, sizeof(src), wire, &wireSize, NULL) != TRDP_NO_ERR)
+        || (tau_unmarshall(pRefCon, BENCH_DS_COMID, wire, wireSize, (UINT8 *) &copy, &copySize, NULL) != TRDP_NO_ERR)
+        || (memcmp(&src, &copy, sizeof(src)) != 0))
+    {
+        fprintf(stderr, "marshalling round trip failed\n");
+        return;
+    }
+
+    start = vos_getTimeNs();
+    for (i = 0u; i < loops; i++)
+    {
+        wireSize = sizeof(wire);
+        (void) tau_marshall(pRefCon, BENCH_DS_COMID, (UINT8 *) &src, sizeof(src), wire, &wireSize, NULL);
+    }
+    elapsed = vos_getTimeNs() - start;
+    bench_record("marshall", "bytes", (UINT32) sizeof(src), "marshall",
+                 (double) sizeof(src) * loops * 1e3 / (double) elapsed, "MB/s");
+
+    start = vos_getTimeNs();
+    for (i = 0u; i < loops; i++)
+    {
+        copySize = sizeof(copy);
+        (void) tau_unmarshall(pRefCon, BENCH_DS_COMID, wire, wireSize, (UINT8 *) &copy, &copySize, NULL);
+    }
+    elapsed = vos_getTimeNs() - start;
+    bench_record("marshall", "bytes", (UINT32) sizeof(src), "unmarshall",
+                 (double) sizeof(src) * loops * 1e3 / (double) elapsed, "MB/s");
+}
+
+/**********************************************************************************************************************/
+/** Write the results as CSV
+ */
+static void bench_writeCsv (
+    FILE *fp)
+{
+    UINT32 i;
+
+    fprintf(fp, "benchmark,parameter,value,metric,result,unit\n");
+    for (i = 0u; i < gNumResults; i++)
+    {
+        fprintf(fp, "%s,%s,%u,%s,%.3f,%s\n", gResult[i].bench, gResult[i].param, gResult[i].paramValue,
+                gResult[i].metric, gResult[i].value, gResult[i].unit);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Write the results and the run conditions as JSON
+ */
+static void bench_writeJson (
+    FILE *fp)
+{
+    const TRDP_VERSION_T    *pVersion = tlc_getVersion();
+    char                    host[64] = "";
+    char                    date[32] = "";
+    time_t                  now = time(NULL);
+    UINT32                  i;
+
+    (void) gethostname(host, sizeof(host) - 1u);
+    (void) strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"tool\": \"trdp-bench\",\n  \"toolVersion\": \"%s\",\n", APP_VERSION);
+    fprintf(fp, "  \"trdpVersion\": \"%u.%u.%u.%u\",\n", pVersion->ver, pVersion->rel, pVersion->upd, pVersion->evo);
+    fprintf(fp, "  \"date\": \"%s\",\n  \"host\": \"%s\",\n", date, host);
+    fprintf(fp, "  \"scale\": %u,\n  \"transport\": \"%s\",\n", gScale, (gDestMC != 0u) ? "multicast" : "unicast");
+    fprintf(fp, "  \"results\": [\n");
+    for (i = 0u; i < gNumResults; i++)
+    {
+        fprintf(fp, "    {\"benchmark\": \"%s\", \"parameter\": \"%s\", \"value\": %u, "
+                "\"metric\": \"%s\", \"result\": %.3f, \"unit\": \"%s\"}%s\n",
+                gResult[i].bench, gResult[i].param, gResult[i].paramValue,
+                gResult[i].metric, gResult[i].value, gResult[i].unit, (i + 1u < gNumResults) ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+}
+
+/**********************************************************************************************************************/
+/** Parse a dotted IP address
+ */
+static BOOL8 bench_parseIp (
+    const char      *pStr,
+    TRDP_IP_ADDR_T  *pIp)
+{
+    unsigned int ip[4];
+
+    if (sscanf(pStr, "%u.%u.%u.%u", &ip[3], &ip[2], &ip[1], &ip[0]) < 4)
+    {
+        return FALSE;
+    }
+    *pIp = (ip[3] << 24) | (ip[2] << 16) | (ip[1] << 8) | ip[0];
+    return TRUE;
+}
+
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("Runs the TRDP benchmarks on this host and prints the results.\n"
+           "Arguments are:\n"
+           "-o <own IP address>    sender/caller address (default 127.0.0.1)\n"
+           "-i <own IP address>    receiver/replier address (default 127.0.0.2)\n"
+           "-t <multicast group>   send PD to this group instead of unicast\n"
+           "-s <scale>             multiply durations and loop counts (default 1)\n"
+           "-c <file>              write CSV to file ('-' = stdout, default)\n"
+           "-j <file>              write JSON to file\n"
+           "-b <list>              benchmarks to run (default all): p = PD publish, u = PD receive,\n"
+           "                       k = tlp_put/tlp_get, m = MD request/reply, d = dataset marshalling\n"
+           "-V                     print each result while running\n"
+           "-v                     print version and quit\n"
+           "-h                     this list\n"
+           );
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    static const UINT32 numPd[]         = {1u, 10u, 100u, 1000u};
+    static const UINT32 numThreads[]    = {1u, 2u, 4u};
+    const char          *pCsvName       = "-";
+    const char          *pJsonName      = NULL;
+    const char          *pSelect        = "pumdk";
+    FILE                *fp;
+    TRDP_ERR_T          err;
+    UINT32              i;
+    int                 ch;
+
+    while ((ch = getopt(argc, argv, "o:i:t:s:c:j:b:Vvh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'o':
+               if (!bench_parseIp(optarg, &gIpA))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'i':
+               if (!bench_parseIp(optarg, &gIpB))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 't':
+               if (!bench_parseIp(optarg, &gDestMC))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 's':
+               if ((sscanf(optarg, "%u", &gScale) < 1) || (gScale == 0u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'c':
+               pCsvName = optarg;
+               break;
+           case 'j':
+               pJsonName = optarg;
+               break;
+           case 'b':
+               pSelect = optarg;
+               break;
+           case 'V':
+               gVerbose = TRUE;
+               break;
+           case 'v':
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               exit(0);
+           case 'h':
+           case '?':
+           default:
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    /* for benchmarking we use dynamic memory allocation (heap) */
+    err = tlc_init(bench_log, NULL, NULL);
+    if (err != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "tlc_init failed (Err: %d)\n", err);
+        return 1;
+    }
+    for (i = 0u; i < sizeof(gData); i++)
+    {
+        gData[i] = (UINT8) i;
+    }
+
+    if (strchr(pSelect, 'p') != NULL)
+    {
+        for (i = 0u; i < sizeof(numPd) / sizeof(numPd[0]); i++)
+        {
+            bench_pdPublish(numPd[i]);
+        }
+    }
+    if (strchr(pSelect, 'u') != NULL)
+    {
+        for (i = 0u; i < sizeof(numPd) / sizeof(numPd[0]); i++)
+        {
+            bench_pdReceive(numPd[i]);
+        }
+    }
+    if (strchr(pSelect, 'k') != NULL)
+    {
+        for (i = 0u; i < sizeof(numThreads) / sizeof(numThreads[0]); i++)
+        {
+            bench_putGet(numThreads[i]);
+        }
+    }
+    if (strchr(pSelect, 'm') != NULL)
+    {
+        bench_md(FALSE, 1u);
+        bench_md(FALSE, BENCH_MD_WINDOW);
+        bench_md(TRUE, 1u);
+        bench_md(TRUE, BENCH_MD_WINDOW);
+    }
+    if (strchr(pSelect, 'd') != NULL)
+    {
+        bench_marshall();
+    }
+
+    (void) tlc_terminate();
+
+    if (pCsvName != NULL)
+    {
+        fp = (strcmp(pCsvName, "-") == 0) ? stdout : fopen(pCsvName, "w");
+        if (fp == NULL)
+        {
+            fprintf(stderr, "cannot write %s\n", pCsvName);
+            return 1;
+        }
+        bench_writeCsv(fp);
+        if (fp != stdout)
+        {
+            (void) fclose(fp);
+        }
+    }
+    if (pJsonName != NULL)
+    {
+        fp = fopen(pJsonName, "w");
+        if (fp == NULL)
+        {
+            fprintf(stderr, "cannot write %s\n", pJsonName);
+            return 1;
+        }
+        bench_writeJson(fp);
+        (void) fclose(fp);
+    }
+    return 0;
+}
@@ -0,0 +1,219 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-trace2json.c
+ *
+ * @brief           Convert a TRDP trace dump into the Chrome trace event format
+ *
+ * @details         Reads a file written by tlc_dumpTrace (library built with TRACE=TRUE) and writes JSON for
+ *                  chrome://tracing or ui.perfetto.dev. Every session (own IP address) becomes a process, every
+ *                  tracing thread a thread. Spans are complete events ("X"), the others instant events ("i").
+ *                  Times are given in us relative to the oldest record.
+ *
+ * @note            Project: TRDP
+ *
+ * @author          TCNOpen TRDP contributors
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen TRDP contributors, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+
+/***********************************************************************************************************************
+ * INCLUDES
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trdp_types.h"
+
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION     "1.0"
+#define MAX_SESSIONS    64u
+
+
+/**********************************************************************************************************************/
+/** Name and category of an event
+ */
+static void eventName (
+    UINT16      event,
+    const char  **ppName,
+    const char  **ppCat)
+{
+    static const char *names[] =
+    {
+        "unknown", "process", "PD send", "PD receive", "PD callback", "PD timeout",
+        "MD send", "MD receive", "MD callback", "MD timeout", "MD state"
+    };
+
+    *ppName = (event < sizeof(names) / sizeof(names[0])) ? names[event] : names[0];
+    *ppCat  = (event == TRDP_TRACE_PROCESS) ? "process" : ((event <= TRDP_TRACE_PD_TIMEOUT) ? "pd" : "md");
+}
+
+/**********************************************************************************************************************/
+/** Write the event specific value
+ */
+static void writeInfo (
+    FILE                    *fp,
+    const TRDP_TRACE_REC_T  *pRec)
+{
+    switch (pRec->event)
+    {
+       case TRDP_TRACE_PD_SEND:
+       case TRDP_TRACE_PD_RECEIVE:
+       case TRDP_TRACE_MD_SEND:
+       case TRDP_TRACE_MD_RECEIVE:
+           fprintf(fp, ", \"msgType\": \"%c%c\"", (char) (pRec->info >> 8), (char) (pRec->info & 0xFFu));
+           break;
+       case TRDP_TRACE_PD_CALLBACK:
+       case TRDP_TRACE_MD_CALLBACK:
+       case TRDP_TRACE_MD_TIMEOUT:
+           fprintf(fp, ", \"result\": %d", (int) (INT16) pRec->info);
+           break;
+       case TRDP_TRACE_MD_STATE:
+           fprintf(fp, ", \"state\": %u", (unsigned int) pRec->info);
+           break;
+       default:
+           break;
+    }
+}
+
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("Converts a trace dump of tlc_dumpTrace into Chrome/Perfetto trace JSON.\n"
+           "%s <dump file> [<json file>]   (default output: stdout)\n"
+           "-v  print version and quit\n"
+           "-h  this text\n", appName);
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_TRACE_FILE_T   header;
+    TRDP_TRACE_REC_T    *pRec;
+    UINT32              sessions[MAX_SESSIONS];
+    UINT32              numSessions = 0u;
+    UINT64              start       = ~(UINT64) 0u;
+    FILE                *fpIn;
+    FILE                *fpOut      = stdout;
+    const char          *pName;
+    const char          *pCat;
+    const char          *pSep       = "";
+    UINT32              i;
+    UINT32              j;
+
+    if ((argc < 2) || (strcmp(argv[1], "-h") == 0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    if (strcmp(argv[1], "-v") == 0)
+    {
+        printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+        return 0;
+    }
+
+    fpIn = fopen(argv[1], "rb");
+    if (fpIn == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+    if ((fread(&header, sizeof(header), 1u, fpIn) != 1u)
+        || (header.magic != TRDP_TRACE_FILE_MAGIC)
+        || (header.version != TRDP_TRACE_FILE_VERSION)
+        || (header.recordSize != sizeof(TRDP_TRACE_REC_T)))
+    {
+        fprintf(stderr, "%s is no TRDP trace dump of this version\n", argv[1]);
+        (void) fclose(fpIn);
+        return 1;
+    }
+    pRec = (TRDP_TRACE_REC_T *) malloc((header.numRecords + 1u) * sizeof(TRDP_TRACE_REC_T));
+    if ((pRec == NULL)
+        || (fread(pRec, sizeof(TRDP_TRACE_REC_T), header.numRecords, fpIn) != header.numRecords))
+    {
+        fprintf(stderr, "cannot read the records of %s\n", argv[1]);
+        (void) fclose(fpIn);
+        free(pRec);
+        return 1;
+    }
+    (void) fclose(fpIn);
+
+    if (argc > 2)
+    {
+        fpOut = fopen(argv[2], "w");
+        if (fpOut == NULL)
+        {
+            fprintf(stderr, "cannot write %s\n", argv[2]);
+            free(pRec);
+            return 1;
+        }
+    }
+
+    for (i = 0u; i < header.numRecords; i++)
+    {
+        if (pRec[i].time < start)
+        {
+            start = pRec[i].time;
+        }
+        for (j = 0u; (j < numSessions) && (sessions[j] != pRec[i].session); j++)
+        {
+            ;
+        }
+        if ((j == numSessions) && (numSessions < MAX_SESSIONS))
+        {
+            sessions[numSessions++] = pRec[i].session;
+        }
+    }
+
+    fprintf(fpOut, "{\"displayTimeUnit\": \"ns\",\n \"otherData\": {\"lostRecords\": %u},\n \"traceEvents\": [\n",
+            header.numLost);
+    for (j = 0u; j < numSessions; j++)
+    {
+        fprintf(fpOut, "%s  {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %u, "
+                "\"args\": {\"name\": \"TRDP session %u.%u.%u.%u\"}}",
+                pSep, sessions[j], (sessions[j] >> 24) & 0xFFu, (sessions[j] >> 16) & 0xFFu,
+                (sessions[j] >> 8) & 0xFFu, sessions[j] & 0xFFu);
+        pSep = ",\n";
+    }
+    for (i = 0u; i < header.numRecords; i++)
+    {
+        eventName(pRec[i].event, &pName, &pCat);
+        fprintf(fpOut, "%s  {\"name\": \"%s\", \"cat\": \"%s\", \"pid\": %u, \"tid\": %u, \"ts\": %.3f, ",
+                pSep, pName, pCat, pRec[i].session, pRec[i].thread, (double) (pRec[i].time - start) / 1000.0);
+        if ((pRec[i].duration != 0u) || (pRec[i].event == TRDP_TRACE_PROCESS)
+            || (pRec[i].event == TRDP_TRACE_PD_CALLBACK) || (pRec[i].event == TRDP_TRACE_MD_CALLBACK))
+        {
+            fprintf(fpOut, "\"ph\": \"X\", \"dur\": %.3f, ", (double) pRec[i].duration / 1000.0);
+        }
+        else
+        {
+            fprintf(fpOut, "\"ph\": \"i\", \"s\": \"t\", ");
+        }
+        fprintf(fpOut, "\"args\": {\"comId\": %u, \"seqCnt\": %u", pRec[i].comId, pRec[i].seqCnt);
+        writeInfo(fpOut, &pRec[i]);
+        fprintf(fpOut, "}}");
+        pSep = ",\n";
+    }
+    fprintf(fpOut, "\n]}\n");
+
+    if (fpOut != stdout)
+    {
+        (void) fclose(fpOut);
+    }
+    free(pRec);
+    return 0;
+}
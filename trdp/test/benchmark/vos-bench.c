@@ -0,0 +1,891 @@
+/**********************************************************************************************************************/
+/**
+ * @file            vos-bench.c
+ *
+ * @brief           Microbenchmarks of the VOS primitives
+ *
+ * @details         Measures the cost of the VOS functions every TRDP hot path depends on:
+ *                  - vos_memAlloc/vos_memFree per block size class, from the memory pool and from the heap,
+ *                    and with several threads allocating concurrently
+ *                  - vos_queueSend/vos_queueReceive with several producer threads
+ *                  - vos_mutexLock/vos_mutexUnlock with several contending threads
+ *                  - vos_semaGive -> vos_semaTake wakeup latency between two threads
+ *                  - vos_crc32/vos_sc32 throughput
+ *                  - vos_getTime/vos_getTimeNs/vos_getTimeStamp cost
+ *                  The results are written in the same CSV/JSON format as trdp-bench. Loop counts are fixed
+ *                  (scaled by -s), the thread counts can be chosen with -n.
+ *
+ * @note            Project: TRDP
+ *
+ * @author          TCNOpen TRDP contributors
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen TRDP contributors, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+
+/***********************************************************************************************************************
+ * INCLUDES
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <unistd.h>
+
+#include "vos_types.h"
+#include "vos_mem.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION             "1.0"
+
+#define BENCH_MAX_RESULTS       512u
+#define BENCH_MAX_THREADS       16u
+#define BENCH_MEM_AREA          (16u * 1024u * 1024u)   /* size of the memory pool */
+#define BENCH_MEM_BATCH         16u                     /* blocks held at a time per size class */
+#define BENCH_MEM_MT_SIZE       256u                    /* block size of the concurrent run */
+#define BENCH_QUEUE_LEN         1024u
+
+/** One measured value */
+typedef struct
+{
+    const char  *bench;                 /* benchmark name */
+    const char  *param;                 /* name of the varied parameter */
+    UINT32      paramValue;             /* value of the varied parameter */
+    const char  *metric;                /* what was measured */
+    double      value;                  /* result */
+    const char  *unit;                  /* unit of the result */
+} BENCH_RESULT_T;
+
+/** Worker of the multi threaded runs */
+typedef struct
+{
+    UINT32      loops;
+    UINT32      blockSize;              /* memory run */
+    VOS_QUEUE_T queue;                  /* queue run */
+    VOS_MUTEX_T mutex;                  /* mutex run */
+    UINT32      *pCounter;              /* mutex run: shared counter protected by mutex */
+    UINT32      failed;                 /* failed operations */
+} BENCH_WORKER_T;
+
+/***********************************************************************************************************************
+ * LOCALS
+ */
+static UINT32           gScale      = 1u;                   /* loop multiplier */
+static int              gVerbose    = FALSE;
+static volatile BOOL8   gQuiet      = FALSE;                /* suppress the expected 'queue full' errors */
+static UINT32           gThreads[BENCH_MAX_THREADS] = {1u, 2u, 4u};
+static UINT32           gNumThreads = 3u;
+
+static BENCH_RESULT_T   gResult[BENCH_MAX_RESULTS];
+static UINT32           gNumResults = 0u;
+
+static UINT8            gData[65536];
+
+/* thread start/stop synchronisation */
+static volatile BOOL8   gWorkersGo  = FALSE;
+static UINT32           gWorkersDone = 0u;
+
+/* semaphore ping-pong */
+static VOS_SEMA_T       gSemaPing;
+static VOS_SEMA_T       gSemaPong;
+static volatile VOS_TIME_NS_T gGiveTime = 0u;
+static UINT32           *gpWakeNs   = NULL;
+static UINT32           gWakeLoops  = 0u;
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void bench_log (void *pRefCon, VOS_LOG_T category, const CHAR8 *pTime, const CHAR8 *pFile,
+                       UINT16 lineNumber, const CHAR8 *pMsgStr);
+static void bench_record (const char *bench, const char *param, UINT32 paramValue, const char *metric,
+                          double value, const char *unit);
+
+
+/**********************************************************************************************************************/
+/** Log errors only, the measurements must not be disturbed by console output
+ */
+static void bench_log (
+    void        *pRefCon,
+    VOS_LOG_T   category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    (void) pRefCon;
+    (void) pTime;
+    if ((category == VOS_LOG_ERROR) && !gQuiet)
+    {
+        fprintf(stderr, "%s:%d %s", strrchr(pFile, '/') ? strrchr(pFile, '/') + 1 : pFile, lineNumber, pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Store one result
+ */
+static void bench_record (
+    const char  *bench,
+    const char  *param,
+    UINT32      paramValue,
+    const char  *metric,
+    double      value,
+    const char  *unit)
+{
+    if (gNumResults < BENCH_MAX_RESULTS)
+    {
+        gResult[gNumResults].bench      = bench;
+        gResult[gNumResults].param      = param;
+        gResult[gNumResults].paramValue = paramValue;
+        gResult[gNumResults].metric     = metric;
+        gResult[gNumResults].value      = value;
+        gResult[gNumResults].unit       = unit;
+        gNumResults++;
+    }
+    if (gVerbose)
+    {
+        fprintf(stderr, "%-12s %s=%-6u %-16s %14.3f %s\n", bench, param, paramValue, metric, value, unit);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Sort helper for the latency percentiles
+ */
+static int bench_cmpU32 (
+    const void  *pA,
+    const void  *pB)
+{
+    UINT32 a = *(const UINT32 *) pA;
+    UINT32 b = *(const UINT32 *) pB;
+
+    return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+/**********************************************************************************************************************/
+/** Start numThreads threads running pFunc on their worker, release them together and return the elapsed time
+ */
+static VOS_TIME_NS_T bench_runThreads (
+    VOS_THREAD_FUNC_T   pFunc,
+    BENCH_WORKER_T      *pWorker,
+    UINT32              numThreads)
+{
+    VOS_THREAD_T    threadId;
+    VOS_TIME_NS_T   start;
+    UINT32          i;
+
+    gWorkersGo      = FALSE;
+    gWorkersDone    = 0u;
+    for (i = 0u; i < numThreads; i++)
+    {
+        if (vos_threadCreate(&threadId, "benchWorker", VOS_THREAD_POLICY_OTHER, 0u, 0u, 0u,
+                             pFunc, &pWorker[i]) != VOS_NO_ERR)
+        {
+            fprintf(stderr, "vos_threadCreate failed\n");
+            VOS_ATOMIC_ADD(&gWorkersDone, 1u);
+        }
+    }
+    vos_threadDelay(50000u);                                                /* let all threads reach the start */
+    start       = vos_getTimeNs();
+    gWorkersGo  = TRUE;
+    while (VOS_ATOMIC_LOAD(&gWorkersDone) < numThreads)
+    {
+        vos_threadDelay(100u);
+    }
+    return vos_getTimeNs() - start;
+}
+
+/**********************************************************************************************************************/
+/** Wait for the start signal of bench_runThreads
+ */
+static void bench_waitGo (void)
+{
+    while (!gWorkersGo)
+    {
+        (void) vos_threadDelay(0u);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Allocate and free the worker's block size in batches
+ */
+static UINT32 bench_memLoop (
+    UINT32  blockSize,
+    UINT32  loops)
+{
+    UINT8   *p[BENCH_MEM_BATCH];
+    UINT32  failed = 0u;
+    UINT32  i;
+    UINT32  j;
+
+    for (i = 0u; i < loops; i++)
+    {
+        for (j = 0u; j < BENCH_MEM_BATCH; j++)
+        {
+            p[j] = vos_memAlloc(blockSize);
+        }
+        for (j = 0u; j < BENCH_MEM_BATCH; j++)
+        {
+            if (p[j] == NULL)
+            {
+                failed++;
+            }
+            else
+            {
+                vos_memFree(p[j]);
+            }
+        }
+    }
+    return failed;
+}
+
+static void bench_memThread (
+    void *pArg)
+{
+    BENCH_WORKER_T *pWorker = (BENCH_WORKER_T *) pArg;
+
+    bench_waitGo();
+    pWorker->failed = bench_memLoop(pWorker->blockSize, pWorker->loops);
+    VOS_ATOMIC_ADD(&gWorkersDone, 1u);
+}
+
+/**********************************************************************************************************************/
+/** vos_memAlloc/vos_memFree per block size class, from the pool and from the heap, then concurrently from the pool
+ */
+static void bench_mem (void)
+{
+    static const UINT32 blockSize[VOS_MEM_NBLOCKSIZES] = VOS_MEM_BLOCKSIZES;
+    BENCH_WORKER_T      worker[BENCH_MAX_THREADS];
+    UINT32              loops   = 2000u * gScale;
+    UINT32              failed;
+    UINT32              pass;
+    UINT32              i;
+    VOS_TIME_NS_T       start;
+    VOS_TIME_NS_T       elapsed;
+
+    for (pass = 0u; pass < 2u; pass++)
+    {
+        vos_memDelete(NULL);
+        if (((pass == 0u) ? vos_memInit(NULL, BENCH_MEM_AREA, NULL) : vos_memInit(NULL, 0u, NULL)) != VOS_NO_ERR)
+        {
+            fprintf(stderr, "vos_memInit failed\n");
+            continue;
+        }
+        for (i = 0u; i < VOS_MEM_NBLOCKSIZES; i++)
+        {
+            (void) bench_memLoop(blockSize[i], 1u);                         /* carve the blocks from the pool */
+            start   = vos_getTimeNs();
+            failed  = bench_memLoop(blockSize[i], loops);
+            elapsed = vos_getTimeNs() - start;
+            bench_record((pass == 0u) ? "mem_pool" : "mem_heap", "size", blockSize[i], "alloc_free",
+                         (double) elapsed / ((double) loops * BENCH_MEM_BATCH), "ns/op");
+            if (failed != 0u)
+            {
+                bench_record((pass == 0u) ? "mem_pool" : "mem_heap", "size", blockSize[i], "failed",
+                             (double) failed, "1");
+            }
+        }
+    }
+
+    /* concurrent allocation from the pool */
+    vos_memDelete(NULL);
+    if (vos_memInit(NULL, BENCH_MEM_AREA, NULL) != VOS_NO_ERR)
+    {
+        fprintf(stderr, "vos_memInit failed\n");
+        return;
+    }
+    for (i = 0u; i < gNumThreads; i++)
+    {
+        UINT32 t;
+        for (t = 0u; t < gThreads[i]; t++)
+        {
+            worker[t].loops     = loops;
+            worker[t].blockSize = BENCH_MEM_MT_SIZE;
+            worker[t].failed    = 0u;
+        }
+        elapsed = bench_runThreads(bench_memThread, worker, gThreads[i]);
+        failed  = 0u;
+        for (t = 0u; t < gThreads[i]; t++)
+        {
+            failed += worker[t].failed;
+        }
+        bench_record("mem_pool_mt", "threads", gThreads[i], "alloc_free",
+                     (double) elapsed / ((double) loops * BENCH_MEM_BATCH * gThreads[i]), "ns/op");
+        bench_record("mem_pool_mt", "threads", gThreads[i], "ops_per_s",
+                     (double) loops * BENCH_MEM_BATCH * gThreads[i] * 1e9 / (double) elapsed, "1/s");
+        if (failed != 0u)
+        {
+            bench_record("mem_pool_mt", "threads", gThreads[i], "failed", (double) failed, "1");
+        }
+    }
+    vos_memDelete(NULL);
+    (void) vos_memInit(NULL, 0u, NULL);
+}
+
+/**********************************************************************************************************************/
+/** Queue producer, retries while the queue is full
+ */
+static void bench_queueThread (
+    void *pArg)
+{
+    BENCH_WORKER_T  *pWorker = (BENCH_WORKER_T *) pArg;
+    UINT32          i;
+    VOS_ERR_T       err;
+
+    bench_waitGo();
+    for (i = 0u; i < pWorker->loops; i++)
+    {
+        while ((err = vos_queueSend(pWorker->queue, gData, 1u)) == VOS_QUEUE_FULL_ERR)
+        {
+            pWorker->failed++;
+            (void) vos_threadDelay(0u);
+        }
+        if (err != VOS_NO_ERR)
+        {
+            break;
+        }
+    }
+    VOS_ATOMIC_ADD(&gWorkersDone, 1u);
+}
+
+/**********************************************************************************************************************/
+/** vos_queueSend/vos_queueReceive, uncontended in one thread and with several producers and one consumer
+ */
+static void bench_queue (void)
+{
+    BENCH_WORKER_T  worker[BENCH_MAX_THREADS];
+    VOS_QUEUE_T     queue;
+    VOS_THREAD_T    threadId;
+    UINT32          loops   = 200000u * gScale;
+    UINT32          total;
+    UINT32          received;
+    UINT32          full;
+    UINT32          size;
+    UINT8           *pData;
+    UINT32          i;
+    UINT32          t;
+    VOS_TIME_NS_T   start;
+    VOS_TIME_NS_T   elapsed;
+
+    if (vos_queueCreate(VOS_QUEUE_POLICY_FIFO, BENCH_QUEUE_LEN, &queue) != VOS_NO_ERR)
+    {
+        fprintf(stderr, "vos_queueCreate failed\n");
+        return;
+    }
+
+    /* one thread, no contention */
+    start = vos_getTimeNs();
+    for (i = 0u; i < loops; i++)
+    {
+        (void) vos_queueSend(queue, gData, 1u);
+        (void) vos_queueReceive(queue, &pData, &size, 0u);
+    }
+    elapsed = vos_getTimeNs() - start;
+    bench_record("queue", "producers", 0u, "send_receive", (double) elapsed / (double) loops, "ns/msg");
+
+    /* producers against the consumer in this thread */
+    for (i = 0u; i < gNumThreads; i++)
+    {
+        total = loops * gThreads[i];
+        for (t = 0u; t < gThreads[i]; t++)
+        {
+            worker[t].loops     = loops;
+            worker[t].queue     = queue;
+            worker[t].failed    = 0u;
+        }
+        gWorkersGo      = FALSE;
+        gWorkersDone    = 0u;
+        gQuiet          = TRUE;
+        for (t = 0u; t < gThreads[i]; t++)
+        {
+            (void) vos_threadCreate(&threadId, "benchProducer", VOS_THREAD_POLICY_OTHER, 0u, 0u, 0u,
+                                    bench_queueThread, &worker[t]);
+        }
+        vos_threadDelay(50000u);
+        received    = 0u;
+        start       = vos_getTimeNs();
+        gWorkersGo  = TRUE;
+        while (received < total)
+        {
+            if (vos_queueReceive(queue, &pData, &size, 100000u) == VOS_NO_ERR)
+            {
+                received++;
+            }
+            else if (VOS_ATOMIC_LOAD(&gWorkersDone) == gThreads[i])
+            {
+                break;                                                      /* a producer gave up */
+            }
+        }
+        elapsed = vos_getTimeNs() - start;
+        while (VOS_ATOMIC_LOAD(&gWorkersDone) < gThreads[i])
+        {
+            vos_threadDelay(1000u);
+        }
+        gQuiet  = FALSE;
+        full    = 0u;
+        for (t = 0u; t < gThreads[i]; t++)
+        {
+            full += worker[t].failed;
+        }
+        bench_record("queue", "producers", gThreads[i], "msgs_per_s", (double) received * 1e9 / (double) elapsed,
+                     "1/s");
+        bench_record("queue", "producers", gThreads[i], "queue_full", (double) full, "1");
+        if (received < total)
+        {
+            bench_record("queue", "producers", gThreads[i], "lost", (double) (total - received), "1");
+        }
+    }
+    (void) vos_queueDestroy(queue);
+}
+
+/**********************************************************************************************************************/
+/** Mutex contender, increments the shared counter under the lock
+ */
+static void bench_mutexThread (
+    void *pArg)
+{
+    BENCH_WORKER_T  *pWorker = (BENCH_WORKER_T *) pArg;
+    UINT32          i;
+
+    bench_waitGo();
+    for (i = 0u; i < pWorker->loops; i++)
+    {
+        if (vos_mutexLock(pWorker->mutex) != VOS_NO_ERR)
+        {
+            pWorker->failed++;
+            continue;
+        }
+        (*pWorker->pCounter)++;
+        (void) vos_mutexUnlock(pWorker->mutex);
+    }
+    VOS_ATOMIC_ADD(&gWorkersDone, 1u);
+}
+
+/**********************************************************************************************************************/
+/** vos_mutexLock/vos_mutexUnlock with 1..n contending threads, the shared counter proves mutual exclusion
+ */
+static void bench_mutex (void)
+{
+    BENCH_WORKER_T  worker[BENCH_MAX_THREADS];
+    VOS_MUTEX_T     mutex;
+    UINT32          counter;
+    UINT32          loops   = 500000u * gScale;
+    UINT32          i;
+    UINT32          t;
+    VOS_TIME_NS_T   elapsed;
+
+    if (vos_mutexCreate(&mutex) != VOS_NO_ERR)
+    {
+        fprintf(stderr, "vos_mutexCreate failed\n");
+        return;
+    }
+    for (i = 0u; i < gNumThreads; i++)
+    {
+        counter = 0u;
+        for (t = 0u; t < gThreads[i]; t++)
+        {
+            worker[t].loops     = loops;
+            worker[t].mutex     = mutex;
+            worker[t].pCounter  = &counter;
+            worker[t].failed    = 0u;
+        }
+        elapsed = bench_runThreads(bench_mutexThread, worker, gThreads[i]);
+        bench_record("mutex", "threads", gThreads[i], "lock_unlock",
+                     (double) elapsed / ((double) loops * gThreads[i]), "ns/op");
+        if (counter != loops * gThreads[i])
+        {
+            bench_record("mutex", "threads", gThreads[i], "lost_updates", (double) (loops * gThreads[i] - counter),
+                         "1");
+        }
+    }
+    vos_mutexDelete(mutex);
+}
+
+/**********************************************************************************************************************/
+/** Semaphore ping-pong partner: take ping, note the wakeup latency, give pong
+ */
+static void bench_semaThread (
+    void *pArg)
+{
+    UINT32 i;
+
+    (void) pArg;
+    for (i = 0u; i < gWakeLoops; i++)
+    {
+        if (vos_semaTake(gSemaPing, VOS_SEMA_WAIT_FOREVER) != VOS_NO_ERR)
+        {
+            break;
+        }
+        gpWakeNs[i] = (UINT32) (vos_getTimeNs() - gGiveTime);
+        vos_semaGive(gSemaPong);
+    }
+    VOS_ATOMIC_ADD(&gWorkersDone, 1u);
+}
+
+/**********************************************************************************************************************/
+/** vos_semaGive -> vos_semaTake wakeup latency of a waiting thread
+ */
+static void bench_sema (void)
+{
+    static const char   *metric[4] = {"wakeup_mean", "wakeup_p50", "wakeup_p99", "wakeup_max"};
+    VOS_THREAD_T        threadId;
+    UINT32              loops = 20000u * gScale;
+    double              value[4];
+    double              sum = 0.0;
+    UINT32              i;
+
+    gpWakeNs = (UINT32 *) calloc(loops, sizeof(UINT32));
+    if ((gpWakeNs == NULL)
+        || (vos_semaCreate(&gSemaPing, VOS_SEMA_EMPTY) != VOS_NO_ERR)
+        || (vos_semaCreate(&gSemaPong, VOS_SEMA_EMPTY) != VOS_NO_ERR))
+    {
+        fprintf(stderr, "semaphore setup failed\n");
+        free(gpWakeNs);
+        return;
+    }
+    gWakeLoops      = loops;
+    gWorkersDone    = 0u;
+    (void) vos_threadCreate(&threadId, "benchSema", VOS_THREAD_POLICY_OTHER, 0u, 0u, 0u, bench_semaThread, NULL);
+    vos_threadDelay(50000u);
+    for (i = 0u; i < loops; i++)
+    {
+        gGiveTime = vos_getTimeNs();
+        vos_semaGive(gSemaPing);
+        if (vos_semaTake(gSemaPong, 1000000u) != VOS_NO_ERR)
+        {
+            fprintf(stderr, "semaphore ping-pong timed out\n");
+            loops = i;
+            break;
+        }
+    }
+    while ((VOS_ATOMIC_LOAD(&gWorkersDone) == 0u) && (loops == gWakeLoops))
+    {
+        vos_threadDelay(1000u);
+    }
+    if (loops > 0u)
+    {
+        qsort(gpWakeNs, loops, sizeof(UINT32), bench_cmpU32);
+        for (i = 0u; i < loops; i++)
+        {
+            sum += gpWakeNs[i];
+        }
+        value[0]    = sum / loops;
+        value[1]    = gpWakeNs[loops / 2u];
+        value[2]    = gpWakeNs[(UINT32) (((UINT64) loops * 99u) / 100u)];
+        value[3]    = gpWakeNs[loops - 1u];
+        for (i = 0u; i < 4u; i++)
+        {
+            bench_record("sema", "threads", 2u, metric[i], value[i] / 1000.0, "us");
+        }
+    }
+    vos_semaDelete(gSemaPing);
+    vos_semaDelete(gSemaPong);
+    free(gpWakeNs);
+    gpWakeNs = NULL;
+}
+
+/**********************************************************************************************************************/
+/** vos_crc32 and vos_sc32 throughput for a PD sized, a maximum PD and a large MD sized buffer
+ */
+static void bench_crc (void)
+{
+    static const UINT32 sizes[] = {64u, 1432u, 65536u};
+    UINT32              i;
+    UINT32              j;
+    UINT32              loops;
+    UINT32              crc = 0u;
+    VOS_TIME_NS_T       start;
+    VOS_TIME_NS_T       elapsed;
+
+    for (i = 0u; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        loops   = (64u * 1024u * 1024u / sizes[i]) * gScale;                /* 64 MB per run */
+
+        start   = vos_getTimeNs();
+        for (j = 0u; j < loops; j++)
+        {
+            crc ^= vos_crc32(0xFFFFFFFFu, gData, sizes[i]);
+        }
+        elapsed = vos_getTimeNs() - start;
+        bench_record("crc32", "bytes", sizes[i], "throughput",
+                     (double) sizes[i] * loops * 1e3 / (double) elapsed, "MB/s");
+
+        start   = vos_getTimeNs();
+        for (j = 0u; j < loops; j++)
+        {
+            crc ^= vos_sc32(0xFFFFFFFFu, gData, sizes[i]);
+        }
+        elapsed = vos_getTimeNs() - start;
+        bench_record("sc32", "bytes", sizes[i], "throughput",
+                     (double) sizes[i] * loops * 1e3 / (double) elapsed, "MB/s");
+    }
+    if (crc == 0x12345678u)
+    {
+        printf(" ");                                                        /* keep the loops from being dropped */
+    }
+}
+
+/**********************************************************************************************************************/
+/** Cost of the VOS time functions
+ */
+static void bench_time (void)
+{
+    UINT32          loops = 1000000u * gScale;
+    UINT32          i;
+    VOS_TIMEVAL_T   tv;
+    VOS_TIME_NS_T   start;
+    VOS_TIME_NS_T   elapsed;
+    VOS_TIME_NS_T   sink = 0u;
+
+    start = vos_getTimeNs();
+    for (i = 0u; i < loops; i++)
+    {
+        vos_getTime(&tv);
+    }
+    elapsed = vos_getTimeNs() - start;
+    bench_record("time", "call", 0u, "vos_getTime", (double) elapsed / (double) loops, "ns/call");
+
+    start = vos_getTimeNs();
+    for (i = 0u; i < loops; i++)
+    {
+        sink += vos_getTimeNs();
+    }
+    elapsed = vos_getTimeNs() - start;
+    bench_record("time", "call", 0u, "vos_getTimeNs", (double) elapsed / (double) loops, "ns/call");
+
+    loops /= 10u;
+    start = vos_getTimeNs();
+    for (i = 0u; i < loops; i++)
+    {
+        sink += (VOS_TIME_NS_T) vos_getTimeStamp()[0];
+    }
+    elapsed = vos_getTimeNs() - start;
+    bench_record("time", "call", 0u, "vos_getTimeStamp", (double) elapsed / (double) loops, "ns/call");
+    if (sink == 0u)
+    {
+        printf(" ");                                                        /* keep the loops from being dropped */
+    }
+}
+
+/**********************************************************************************************************************/
+/** Write the results as CSV
+ */
+static void bench_writeCsv (
+    FILE *fp)
+{
+    UINT32 i;
+
+    fprintf(fp, "benchmark,parameter,value,metric,result,unit\n");
+    for (i = 0u; i < gNumResults; i++)
+    {
+        fprintf(fp, "%s,%s,%u,%s,%.3f,%s\n", gResult[i].bench, gResult[i].param, gResult[i].paramValue,
+                gResult[i].metric, gResult[i].value, gResult[i].unit);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Write the results and the run conditions as JSON
+ */
+static void bench_writeJson (
+    FILE *fp)
+{
+    char    host[64] = "";
+    char    date[32] = "";
+    time_t  now = time(NULL);
+    UINT32  i;
+
+    (void) gethostname(host, sizeof(host) - 1u);
+    (void) strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"tool\": \"vos-bench\",\n  \"toolVersion\": \"%s\",\n", APP_VERSION);
+    fprintf(fp, "  \"vosVersion\": \"%s\",\n", vos_getVersionString());
+    fprintf(fp, "  \"date\": \"%s\",\n  \"host\": \"%s\",\n", date, host);
+    fprintf(fp, "  \"scale\": %u,\n  \"cpus\": %ld,\n", gScale, sysconf(_SC_NPROCESSORS_ONLN));
+    fprintf(fp, "  \"results\": [\n");
+    for (i = 0u; i < gNumResults; i++)
+    {
+        fprintf(fp, "    {\"benchmark\": \"%s\", \"parameter\": \"%s\", \"value\": %u, "
+                "\"metric\": \"%s\", \"result\": %.3f, \"unit\": \"%s\"}%s\n",
+                gResult[i].bench, gResult[i].param, gResult[i].paramValue,
+                gResult[i].metric, gResult[i].value, gResult[i].unit, (i + 1u < gNumResults) ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+}
+
+/**********************************************************************************************************************/
+/** Parse the comma separated list of thread counts
+ */
+static BOOL8 bench_parseThreads (
+    const char *pStr)
+{
+    char            *pEnd;
+    unsigned long   n;
+
+    gNumThreads = 0u;
+    while (*pStr != '\0')
+    {
+        n = strtoul(pStr, &pEnd, 10);
+        if ((pEnd == pStr) || (n == 0u) || (n > BENCH_MAX_THREADS) || (gNumThreads >= BENCH_MAX_THREADS))
+        {
+            return FALSE;
+        }
+        gThreads[gNumThreads++] = (UINT32) n;
+        pStr = (*pEnd == ',') ? pEnd + 1 : pEnd;
+        if ((*pEnd != ',') && (*pEnd != '\0'))
+        {
+            return FALSE;
+        }
+    }
+    return (gNumThreads > 0u) ? TRUE : FALSE;
+}
+
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("Runs the VOS microbenchmarks on this host and prints the results.\n"
+           "Arguments are:\n"
+           "-n <list>              comma separated thread counts of the concurrent runs (default 1,2,4, max. %u)\n"
+           "-s <scale>             multiply loop counts (default 1)\n"
+           "-c <file>              write CSV to file ('-' = stdout, default)\n"
+           "-j <file>              write JSON to file\n"
+           "-b <list>              benchmarks to run (default all): a = memory, q = queue, x = mutex,\n"
+           "                       w = semaphore wakeup, c = CRC, t = time\n"
+           "-V                     print each result while running\n"
+           "-v                     print version and quit\n"
+           "-h                     this list\n",
+           BENCH_MAX_THREADS);
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    const char  *pCsvName   = "-";
+    const char  *pJsonName  = NULL;
+    const char  *pSelect    = "aqxwct";
+    FILE        *fp;
+    UINT32      i;
+    int         ch;
+
+    while ((ch = getopt(argc, argv, "n:s:c:j:b:Vvh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'n':
+               if (!bench_parseThreads(optarg))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 's':
+               if ((sscanf(optarg, "%u", &gScale) < 1) || (gScale == 0u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'c':
+               pCsvName = optarg;
+               break;
+           case 'j':
+               pJsonName = optarg;
+               break;
+           case 'b':
+               pSelect = optarg;
+               break;
+           case 'V':
+               gVerbose = TRUE;
+               break;
+           case 'v':
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               exit(0);
+           case 'h':
+           case '?':
+           default:
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    if ((vos_init(NULL, bench_log) != VOS_NO_ERR) || (vos_memInit(NULL, 0u, NULL) != VOS_NO_ERR))
+    {
+        fprintf(stderr, "vos_init failed\n");
+        return 1;
+    }
+    /* bench_log drops everything but errors; skip formatting and time stamping of the debug output as well,
+       vos_memAlloc/vos_memFree log every call at VOS_LOG_DBG */
+    (void) vos_setLogLevel(VOS_LOG_ERROR);
+    for (i = 0u; i < sizeof(gData); i++)
+    {
+        gData[i] = (UINT8) i;
+    }
+
+    if (strchr(pSelect, 'a') != NULL)
+    {
+        bench_mem();
+    }
+    if (strchr(pSelect, 'q') != NULL)
+    {
+        bench_queue();
+    }
+    if (strchr(pSelect, 'x') != NULL)
+    {
+        bench_mutex();
+    }
+    if (strchr(pSelect, 'w') != NULL)
+    {
+        bench_sema();
+    }
+    if (strchr(pSelect, 'c') != NULL)
+    {
+        bench_crc();
+    }
+    if (strchr(pSelect, 't') != NULL)
+    {
+        bench_time();
+    }
+
+    vos_terminate();
+
+    if (pCsvName != NULL)
+    {
+        fp = (strcmp(pCsvName, "-") == 0) ? stdout : fopen(pCsvName, "w");
+        if (fp == NULL)
+        {
+            fprintf(stderr, "cannot write %s\n", pCsvName);
+            return 1;
+        }
+        bench_writeCsv(fp);
+        if (fp != stdout)
+        {
+            (void) fclose(fp);
+        }
+    }
+    if (pJsonName != NULL)
+    {
+        fp = fopen(pJsonName, "w");
+        if (fp == NULL)
+        {
+            fprintf(stderr, "cannot write %s\n", pJsonName);
+            return 1;
+        }
+        bench_writeJson(fp);
+        (void) fclose(fp);
+    }
+    return 0;
+}
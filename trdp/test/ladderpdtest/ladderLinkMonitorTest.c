@@ -0,0 +1,186 @@
+/**********************************************************************************************************************/
+/**
+ * @file            ladderLinkMonitorTest.c
+ *
+ * @brief           Test of the TAUL link monitor event path
+ *
+ * @details         Installs a fake link monitor backend by tau_setLinkMonitor and checks the state reported by
+ *                  tau_checkLinkUpDown and tau_getLinkEvent for link events and for a lost event (overrun).
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          TCNOpen TRDP contributors
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen TRDP contributors, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#ifdef TRDP_OPTION_LADDER
+/***********************************************************************************************************************
+ * INCLUDES
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "trdp_if_light.h"
+#include "tau_ladder.h"
+
+/***********************************************************************************************************************
+ * DEFINES
+ */
+#define FAKE_IF1    "fake1"
+#define FAKE_IF2    "fake2"
+
+#define CHECK(cond, message)                        \
+    if (!(cond))                                    \
+    {                                               \
+        printf("### %s (line %d)\n", message, __LINE__); \
+        return 1;                                   \
+    }
+
+/***********************************************************************************************************************
+ * LOCALS
+ */
+typedef enum
+{
+    FAKE_IDLE,          /* no events pending */
+    FAKE_EVENT,         /* report the state of fake1 by an event */
+    FAKE_OVERRUN        /* the events were lost */
+} FAKE_PENDING_T;
+
+static BOOL8            fakeLinkUp[LINK_MONITOR_IF_CNT];    /* state of the interfaces */
+static FAKE_PENDING_T   fakePending = FAKE_IDLE;
+static UINT32           fakeGetStateCnt = 0u;
+
+static TRDP_ERR_T fakeOpen (void)
+{
+    return TRDP_NO_ERR;
+}
+
+static INT32 fakeGetFd (void)
+{
+    return -1;
+}
+
+static void fakeProcess (void)
+{
+    switch (fakePending)
+    {
+       case FAKE_EVENT:
+           tau_linkEvent(FAKE_IF1, fakeLinkUp[0]);
+           break;
+       case FAKE_OVERRUN:
+           tau_linkResync();
+           break;
+       default:
+           break;
+    }
+    fakePending = FAKE_IDLE;
+}
+
+static TRDP_ERR_T fakeGetState (const CHAR8 *pIfName, BOOL8 *pLinkUp)
+{
+    fakeGetStateCnt++;
+    if (strcmp(pIfName, FAKE_IF1) == 0)
+    {
+        *pLinkUp = fakeLinkUp[0];
+    }
+    else if (strcmp(pIfName, FAKE_IF2) == 0)
+    {
+        *pLinkUp = fakeLinkUp[1];
+    }
+    else
+    {
+        return TRDP_PARAM_ERR;
+    }
+    return TRDP_NO_ERR;
+}
+
+static void fakeClose (void)
+{
+}
+
+static const TAU_LINK_MONITOR_T fakeMonitor =
+{
+    fakeOpen, fakeGetFd, fakeProcess, fakeGetState, fakeClose
+};
+
+/**********************************************************************************************************************/
+/** Run the checks
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static int linkMonitorTest (void)
+{
+    BOOL8   linkUp;
+    BOOL8   linkEvent;
+
+    CHECK(tau_setLinkIfName(SUBNET1, FAKE_IF1) == TRDP_NO_ERR, "tau_setLinkIfName 1");
+    CHECK(tau_setLinkIfName(SUBNET2, FAKE_IF2) == TRDP_NO_ERR, "tau_setLinkIfName 2");
+    CHECK(tau_getLinkEvent(&linkEvent) == TRDP_NOINIT_ERR, "tau_getLinkEvent without monitor");
+    CHECK(tau_setLinkMonitor(&fakeMonitor) == TRDP_NO_ERR, "tau_setLinkMonitor");
+
+    /* initial state is taken from the backend */
+    fakeLinkUp[0]   = TRUE;
+    fakeLinkUp[1]   = TRUE;
+    CHECK(tau_openLinkMonitor() == TRDP_NO_ERR, "tau_openLinkMonitor");
+    CHECK(tau_setLinkMonitor(NULL) == TRDP_STATE_ERR, "tau_setLinkMonitor while open");
+    CHECK(tau_getLinkMonitorFd() == -1, "tau_getLinkMonitorFd");
+    CHECK((tau_getLinkEvent(&linkEvent) == TRDP_NO_ERR) && (linkEvent == TRUE), "initial link event");
+    CHECK((tau_getLinkEvent(&linkEvent) == TRDP_NO_ERR) && (linkEvent == FALSE), "link event not cleared");
+
+    /* an event changes the state without asking the interface */
+    fakeGetStateCnt = 0u;
+    fakeLinkUp[0]   = FALSE;
+    fakePending     = FAKE_EVENT;
+    tau_processLinkMonitor();
+    CHECK((tau_checkLinkUpDown(SUBNET1, &linkUp) == TRDP_NO_ERR) && (linkUp == FALSE), "subnet1 down expected");
+    CHECK((tau_checkLinkUpDown(SUBNET2, &linkUp) == TRDP_NO_ERR) && (linkUp == TRUE), "subnet2 up expected");
+    CHECK(fakeGetStateCnt == 0u, "interface asked although the monitor is open");
+    CHECK((tau_getLinkEvent(&linkEvent) == TRDP_NO_ERR) && (linkEvent == TRUE), "link event for subnet1");
+
+    /* the same state again is no event */
+    fakePending = FAKE_EVENT;
+    tau_processLinkMonitor();
+    CHECK((tau_getLinkEvent(&linkEvent) == TRDP_NO_ERR) && (linkEvent == FALSE), "repeated state is no event");
+
+    /* lost events: the states are read anew */
+    fakeLinkUp[0]   = TRUE;
+    fakeLinkUp[1]   = FALSE;
+    fakePending     = FAKE_OVERRUN;
+    tau_processLinkMonitor();
+    CHECK(fakeGetStateCnt == LINK_MONITOR_IF_CNT, "both interfaces re-read after the overrun");
+    CHECK((tau_checkLinkUpDown(SUBNET1, &linkUp) == TRDP_NO_ERR) && (linkUp == TRUE), "subnet1 up after overrun");
+    CHECK((tau_checkLinkUpDown(SUBNET2, &linkUp) == TRDP_NO_ERR) && (linkUp == FALSE), "subnet2 down after overrun");
+    CHECK((tau_getLinkEvent(&linkEvent) == TRDP_NO_ERR) && (linkEvent == TRUE), "link event after overrun");
+
+    /* overrun without a change is still indicated, a flap may have been lost */
+    fakePending = FAKE_OVERRUN;
+    tau_processLinkMonitor();
+    CHECK((tau_getLinkEvent(&linkEvent) == TRDP_NO_ERR) && (linkEvent == TRUE), "link event after quiet overrun");
+
+    tau_closeLinkMonitor();
+    CHECK(tau_getLinkEvent(&linkEvent) == TRDP_NOINIT_ERR, "tau_getLinkEvent after close");
+    CHECK(tau_setLinkMonitor(NULL) == TRDP_NO_ERR, "tau_setLinkMonitor after close");
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    int failed = linkMonitorTest();
+
+    printf("Link monitor test %s\n", (failed == 0) ? "OK" : "FAILED");
+    return failed;
+}
+#endif /* TRDP_OPTION_LADDER */
@@ -39,6 +39,8 @@
 #include "trdp_if_light.h"
 #include "vos_sock.h"
 #include "vos_utils.h"
+#include "vos_shared_mem.h"
+#include "trdp_trace.h"
 
 
 /***********************************************************************************************************************
@@ -2078,8 +2080,1658 @@ static int test16 ()
     CLEANUP;
 }
 
+/**********************************************************************************************************************/
+/** test17 MD Request - Reply, data sent in place (TRDP_FLAGS_NOCOPY, vectored send)
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+#define                 TEST17_COMID            1017u
+#define                 TEST17_REQUEST_LEN      4001u       /* not a multiple of 4: padding is sent separately */
+#define                 TEST17_REPLY_LEN        1031u
+
+static UINT32           gTest17Replies;
+
+static void  test17CBFunction (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    TRDP_ERR_T err = TRDP_NO_ERR;
+
+    if (pMsg->resultCode != TRDP_NO_ERR)
+    {
+        fprintf(gFp, "->> Error %d (ComId %u)\n", pMsg->resultCode, pMsg->comId);
+        gFailed = 1;
+    }
+    else if (pMsg->msgType == TRDP_MSG_MR)
+    {
+        if ((dataSize != TEST17_REQUEST_LEN) || (memcmp(pData, dataBuffer1, TEST17_REQUEST_LEN) != 0))
+        {
+            fprintf(gFp, "## request data wrong (size %u)\n", dataSize);
+            gFailed = 1;
+        }
+        err = tlm_reply(appHandle, &pMsg->sessionId, TEST17_COMID, 0u, NULL,
+                        (UINT8 *)dataBuffer2, TEST17_REPLY_LEN);
+        IF_ERROR("tlm_reply");
+    }
+    else if (pMsg->msgType == TRDP_MSG_MP)
+    {
+        if ((dataSize != TEST17_REPLY_LEN) || (memcmp(pData, dataBuffer2, TEST17_REPLY_LEN) != 0))
+        {
+            fprintf(gFp, "## reply data wrong (size %u)\n", dataSize);
+            gFailed = 1;
+        }
+        else
+        {
+            fprintf(gFp, "->> Reply received (size %u)\n", dataSize);
+        }
+        gTest17Replies++;
+    }
+end:
+    return;
+}
+
+static int test17 ()
+{
+    PREPARE("MD Request - Reply, data sent in place (UDP & TCP)", "test"); /* allocates appHandle1, appHandle2,
+                                                                              failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+        TRDP_UUID_T     sessionId1;
+        TRDP_LIS_T      listenHandle1;
+        TRDP_LIS_T      listenHandle2;
+
+        gTest17Replies = 0u;
+
+        err = tlm_addListener(appHandle2, &listenHandle1, NULL, test17CBFunction,
+                              TRUE,
+                              TEST17_COMID, 0u, 0u, 0u,
+                              VOS_INADDR_ANY, VOS_INADDR_ANY,
+                              TRDP_FLAGS_CALLBACK | TRDP_FLAGS_NOCOPY, NULL, NULL);
+        IF_ERROR("tlm_addListener1");
+
+        err = tlm_addListener(appHandle2, &listenHandle2, NULL, test17CBFunction,
+                              TRUE,
+                              TEST17_COMID, 0u, 0u, 0u,
+                              VOS_INADDR_ANY, VOS_INADDR_ANY,
+                              TRDP_FLAGS_CALLBACK | TRDP_FLAGS_NOCOPY | TRDP_FLAGS_TCP, NULL, NULL);
+        IF_ERROR("tlm_addListener2");
+
+        err = tlm_request(appHandle1, NULL, test17CBFunction, &sessionId1,
+                          TEST17_COMID, 0u, 0u,
+                          0u, gSession2.ifaceIP,
+                          TRDP_FLAGS_CALLBACK | TRDP_FLAGS_NOCOPY, 1u, 1000000u, NULL,
+                          (UINT8 *)dataBuffer1, TEST17_REQUEST_LEN,
+                          NULL, NULL);
+        IF_ERROR("tlm_request UDP");
+        fprintf(gFp, "->> MD UDP Request sent\n");
+
+        vos_threadDelay(1000000u);
+
+        err = tlm_request(appHandle1, NULL, test17CBFunction, &sessionId1,
+                          TEST17_COMID, 0u, 0u,
+                          0u, gSession2.ifaceIP,
+                          TRDP_FLAGS_CALLBACK | TRDP_FLAGS_NOCOPY | TRDP_FLAGS_TCP, 1u, 1000000u, NULL,
+                          (UINT8 *)dataBuffer1, TEST17_REQUEST_LEN,
+                          NULL, NULL);
+        IF_ERROR("tlm_request TCP");
+        fprintf(gFp, "->> MD TCP Request sent\n");
+
+        vos_threadDelay(1000000u);
+
+        if (gTest17Replies != 2u)
+        {
+            fprintf(gFp, "## %u replies received, expected 2\n", gTest17Replies);
+            gFailed = 1;
+        }
+
+        err = tlm_delListener(appHandle2, listenHandle1);
+        IF_ERROR("tlm_delListener1");
+        err = tlm_delListener(appHandle2, listenHandle2);
+        IF_ERROR("tlm_delListener2");
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test18 MD multicast Request - Reply, replies aggregated (TRDP_FLAGS_AGGREGATE)
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+#define                 TEST18_COMID            1018u
+#define                 TEST18_MC_GROUP         0xEF000212u     /* 239.0.2.18 */
+#define                 TEST18_REPLY_LEN        33u
+
+static UINT32           gTest18Callbacks;
+static TRDP_ERR_T       gTest18Result;
+
+static void  test18CBFunction (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    TRDP_ERR_T err = TRDP_NO_ERR;
+
+    if (pMsg->msgType == TRDP_MSG_MR)
+    {
+        err = tlm_reply(appHandle, &pMsg->sessionId, TEST18_COMID, 7u, NULL,
+                        (UINT8 *)dataBuffer2, TEST18_REPLY_LEN);
+        IF_ERROR("tlm_reply");
+    }
+    else
+    {
+        /* the caller gets one callback with all replies */
+        const TRDP_MD_REPLY_REC_T *pRec = (const TRDP_MD_REPLY_REC_T *) pData;
+
+        gTest18Callbacks++;
+        gTest18Result = pMsg->resultCode;
+
+        if ((pData == NULL)
+            || (dataSize != TRDP_MD_REPLY_REC_SIZE(pRec))
+            || (pRec->msgType != TRDP_MSG_MP)
+            || (pRec->userStatus != 7u)
+            || (pRec->dataSize != TEST18_REPLY_LEN)
+            || (memcmp(pRec + 1, dataBuffer2, TEST18_REPLY_LEN) != 0))
+        {
+            fprintf(gFp, "## aggregated reply set wrong (size %u)\n", dataSize);
+            gFailed = 1;
+        }
+        else
+        {
+            fprintf(gFp, "->> Aggregated replies received (%u replies, result %d)\n",
+                    pMsg->numReplies, pMsg->resultCode);
+        }
+    }
+end:
+    return;
+}
+
+static int test18 ()
+{
+    PREPARE("MD multicast Request - Reply, aggregated replies", "test"); /* allocates appHandle1, appHandle2,
+                                                                            failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+        TRDP_UUID_T     sessionId1;
+        TRDP_LIS_T      listenHandle;
+
+        gTest18Callbacks = 0u;
+
+        err = tlm_addListener(appHandle2, &listenHandle, NULL, test18CBFunction,
+                              TRUE,
+                              TEST18_COMID, 0u, 0u, 0u,
+                              VOS_INADDR_ANY, TEST18_MC_GROUP,
+                              TRDP_FLAGS_CALLBACK, NULL, NULL);
+        IF_ERROR("tlm_addListener");
+
+        /* unknown number of replies: delivered on reply timeout */
+        err = tlm_request(appHandle1, NULL, test18CBFunction, &sessionId1,
+                          TEST18_COMID, 0u, 0u,
+                          0u, TEST18_MC_GROUP,
+                          TRDP_FLAGS_CALLBACK | TRDP_FLAGS_AGGREGATE, 0u, 500000u, NULL,
+                          (UINT8 *)dataBuffer1, 16u,
+                          NULL, NULL);
+        IF_ERROR("tlm_request MC");
+
+        vos_threadDelay(1500000u);
+
+        if ((gTest18Callbacks != 1u) || (gTest18Result != TRDP_REPLYTO_ERR))
+        {
+            fprintf(gFp, "## %u callbacks (result %d), expected 1 on timeout\n", gTest18Callbacks, gTest18Result);
+            gFailed = 1;
+        }
+
+        /* known number of replies: delivered on completion */
+        gTest18Callbacks = 0u;
+        err = tlm_request(appHandle1, NULL, test18CBFunction, &sessionId1,
+                          TEST18_COMID, 0u, 0u,
+                          0u, TEST18_MC_GROUP,
+                          TRDP_FLAGS_CALLBACK | TRDP_FLAGS_AGGREGATE, 1u, 500000u, NULL,
+                          (UINT8 *)dataBuffer1, 16u,
+                          NULL, NULL);
+        IF_ERROR("tlm_request MC");
+
+        vos_threadDelay(1000000u);
+
+        if ((gTest18Callbacks != 1u) || (gTest18Result != TRDP_NO_ERR))
+        {
+            fprintf(gFp, "## %u callbacks (result %d), expected 1 on completion\n", gTest18Callbacks, gTest18Result);
+            gFailed = 1;
+        }
+
+        err = tlm_delListener(appHandle2, listenHandle);
+        IF_ERROR("tlm_delListener");
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test19 MD TCP Request - Reply, several requests in flight on one connection
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+#define                 TEST19_COMID            1019u
+#define                 TEST19_REQUESTS         8u
+
+static TRDP_UUID_T      gTest19SessionId[TEST19_REQUESTS];
+static UINT32           gTest19Replies;
+
+static void  test19CBFunction (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    TRDP_ERR_T err = TRDP_NO_ERR;
+
+    if (pMsg->msgType == TRDP_MSG_MR)
+    {
+        /* echo the request, it carries the index of the request (pData is released by tlm_reply) */
+        UINT8 reply[16];
+
+        memcpy(reply, pData, sizeof(reply));
+        err = tlm_reply(appHandle, &pMsg->sessionId, TEST19_COMID, 0u, NULL, reply, sizeof(reply));
+        IF_ERROR("tlm_reply");
+    }
+    else if ((pMsg->msgType == TRDP_MSG_MP) && (pMsg->resultCode == TRDP_NO_ERR))
+    {
+        UINT32 idx = (pData != NULL) ? pData[0] : TEST19_REQUESTS;
+
+        if ((dataSize != 16u)
+            || (idx >= TEST19_REQUESTS)
+            || (memcmp(pMsg->sessionId, gTest19SessionId[idx], TRDP_SESS_ID_SIZE) != 0))
+        {
+            fprintf(gFp, "## reply does not match its request (size %u)\n", dataSize);
+            gFailed = 1;
+        }
+        else
+        {
+            gTest19Replies++;
+        }
+    }
+    else
+    {
+        fprintf(gFp, "## unexpected callback (msgType %x, result %d)\n", pMsg->msgType, pMsg->resultCode);
+        gFailed = 1;
+    }
+end:
+    return;
+}
+
+static int test19 ()
+{
+    PREPARE("MD TCP Request - Reply, pipelined requests", "test"); /* allocates appHandle1, appHandle2,
+                                                                      failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+        TRDP_LIS_T  listenHandle;
+        UINT8       request[16];
+        UINT32      i;
+
+        gTest19Replies = 0u;
+
+        err = tlm_addListener(appHandle2, &listenHandle, NULL, test19CBFunction,
+                              TRUE,
+                              TEST19_COMID, 0u, 0u, 0u,
+                              VOS_INADDR_ANY, VOS_INADDR_ANY,
+                              TRDP_FLAGS_CALLBACK | TRDP_FLAGS_TCP, NULL, NULL);
+        IF_ERROR("tlm_addListener");
+
+        /* all requests are issued before the first reply can arrive */
+        for (i = 0u; i < TEST19_REQUESTS; i++)
+        {
+            memset(request, (int) i, sizeof(request));
+            err = tlm_request(appHandle1, NULL, test19CBFunction, &gTest19SessionId[i],
+                              TEST19_COMID, 0u, 0u,
+                              0u, gSession2.ifaceIP,
+                              TRDP_FLAGS_CALLBACK | TRDP_FLAGS_TCP, 1u, 1000000u, NULL,
+                              request, sizeof(request),
+                              NULL, NULL);
+            IF_ERROR("tlm_request");
+        }
+        fprintf(gFp, "->> %u MD TCP Requests sent\n", TEST19_REQUESTS);
+
+        vos_threadDelay(1000000u);
+
+        if (gTest19Replies != TEST19_REQUESTS)
+        {
+            fprintf(gFp, "## %u replies received, expected %u\n", gTest19Replies, TEST19_REQUESTS);
+            gFailed = 1;
+        }
+
+        err = tlm_delListener(appHandle2, listenHandle);
+        IF_ERROR("tlm_delListener");
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+    CLEANUP;
+}
+
+
+/**********************************************************************************************************************/
+/** test20 PD publish and subscribe of a whole configuration with tlc_applyConfig
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static int test20 ()
+{
+    PREPARE("Bulk publish and subscribe (tlc_applyConfig)", "test"); /* allocates appHandle1, appHandle2,
+                                                                        failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+#define TEST20_NO_OF_TELEGRAMS  50u
+#define TEST20_COMID            20000u
+#define TEST20_INTERVAL         100000u
+#define TEST20_DATA             "Hello Bulk Data!"
+#define TEST20_DATA_LEN         16u
+
+        TRDP_PUBLISH_PAR_T      pub[TEST20_NO_OF_TELEGRAMS + 1u];
+        TRDP_SUBSCRIBE_PAR_T    sub[TEST20_NO_OF_TELEGRAMS];
+        UINT32  received = 0u;
+        UINT32  i;
+
+        memset(pub, 0, sizeof(pub));
+        memset(sub, 0, sizeof(sub));
+        for (i = 0u; i < TEST20_NO_OF_TELEGRAMS; i++)
+        {
+            pub[i].comId        = TEST20_COMID + i;
+            pub[i].destIpAddr   = gSession2.ifaceIP;
+            pub[i].interval     = TEST20_INTERVAL;
+            pub[i].pktFlags     = TRDP_FLAGS_DEFAULT;
+            pub[i].pData        = (UINT8 *) TEST20_DATA;
+            pub[i].dataSize     = TEST20_DATA_LEN;
+
+            sub[i].comId        = TEST20_COMID + i;
+            sub[i].srcIpAddr1   = gSession1.ifaceIP;
+            sub[i].pktFlags     = TRDP_FLAGS_NONE;
+            sub[i].timeout      = TEST20_INTERVAL * 3u;
+            sub[i].toBehavior   = TRDP_TO_DEFAULT;
+        }
+        /* the last entry duplicates the first one and must be rejected */
+        pub[TEST20_NO_OF_TELEGRAMS] = pub[0];
+
+        err = tlc_applyConfig(appHandle1, TEST20_NO_OF_TELEGRAMS + 1u, pub, 0u, NULL);
+        if ((err != TRDP_NOPUB_ERR)
+            || (pub[TEST20_NO_OF_TELEGRAMS].result != TRDP_NOPUB_ERR)
+            || (pub[TEST20_NO_OF_TELEGRAMS].pubHandle != NULL))
+        {
+            FAILED("tlc_applyConfig did not reject the duplicate publication");
+        }
+
+        err = tlc_applyConfig(appHandle2, 0u, NULL, TEST20_NO_OF_TELEGRAMS, sub);
+        IF_ERROR("tlc_applyConfig");
+
+        for (i = 0u; i < TEST20_NO_OF_TELEGRAMS; i++)
+        {
+            if ((pub[i].result != TRDP_NO_ERR) || (pub[i].pubHandle == NULL)
+                || (sub[i].result != TRDP_NO_ERR) || (sub[i].subHandle == NULL))
+            {
+                FAILED("tlc_applyConfig entry failed");
+            }
+        }
+        fprintf(gFp, "\nInitialized %u publishers & subscribers!\n", i);
+
+        vos_threadDelay(3u * TEST20_INTERVAL);
+
+        for (i = 0u; i < TEST20_NO_OF_TELEGRAMS; i++)
+        {
+            char            data2[1432u];
+            UINT32          dataSize2 = sizeof(data2);
+            TRDP_PD_INFO_T  pdInfo;
+
+            err = tlp_get(appHandle2, sub[i].subHandle, &pdInfo, (UINT8 *) data2, &dataSize2);
+            if ((err == TRDP_NO_ERR)
+                && (pdInfo.comId == TEST20_COMID + i)
+                && (dataSize2 == TEST20_DATA_LEN)
+                && (memcmp(data2, TEST20_DATA, TEST20_DATA_LEN) == 0))
+            {
+                received++;
+            }
+        }
+
+        if (received != TEST20_NO_OF_TELEGRAMS)
+        {
+            fprintf(gFp, "## %u telegrams received, expected %u\n", received, TEST20_NO_OF_TELEGRAMS);
+            gFailed = 1;
+        }
+
+        for (i = 0u; i < TEST20_NO_OF_TELEGRAMS; i++)
+        {
+            err = tlp_unpublish(appHandle1, pub[i].pubHandle);
+            IF_ERROR("tlp_unpublish");
+            err = tlp_unsubscribe(appHandle2, sub[i].subHandle);
+            IF_ERROR("tlp_unsubscribe");
+        }
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+    CLEANUP;
+}
+
+
+/**********************************************************************************************************************/
+/** Two sessions served by one select (tlc_getGroupInterval, tlc_processGroup)
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static int test21 ()
+{
+    TRDP_ERR_T              err = TRDP_NO_ERR;
+    TRDP_APP_SESSION_T      session[2] = {NULL, NULL};
+    TRDP_SESSION_GROUP_T    group;
+
+    gFailed     = 0;
+    gFullLog    = FALSE;
+    fprintf(gFp, "\n---- Start of %s (%s) ---------\n\n", __FUNCTION__, "Session group, one select for two sessions");
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+#define TEST21_COMID            21000u
+#define TEST21_INTERVAL         20000u
+#define TEST21_LOOPS            50u
+#define TEST21_DATA             "Hello Group!"
+#define TEST21_DATA_LEN         12u
+
+        TRDP_PUB_T  pubHandle;
+        TRDP_SUB_T  subHandle;
+        UINT32      received    = 0u;
+        UINT32      lastSeq     = 0xFFFFFFFFu;
+        UINT32      loop;
+
+        err = tlc_init(dbgOut, NULL, NULL);
+        IF_ERROR("tlc_init");
+        err = tlc_openSession(&session[0], gSession1.ifaceIP, 0u, NULL, NULL, NULL, NULL);
+        IF_ERROR("tlc_openSession 1");
+        err = tlc_openSession(&session[1], gSession2.ifaceIP, 0u, NULL, NULL, NULL, NULL);
+        IF_ERROR("tlc_openSession 2");
+
+        group.numSessions   = 2u;
+        group.pSession      = session;
+
+        err = tlp_publish(session[0], &pubHandle, NULL, NULL, TEST21_COMID, 0u, 0u,
+                          0u, gSession2.ifaceIP, TEST21_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL,
+                          (UINT8 *) TEST21_DATA, TEST21_DATA_LEN);
+        IF_ERROR("tlp_publish");
+
+        err = tlp_subscribe(session[1], &subHandle, NULL, NULL, TEST21_COMID, 0u, 0u,
+                            gSession1.ifaceIP, 0u, 0u, TRDP_FLAGS_NONE,
+                            TEST21_INTERVAL * 3u, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe");
+
+        for (loop = 0u; loop < TEST21_LOOPS; loop++)
+        {
+            TRDP_FDS_T      rfds;
+            INT32           noDesc  = 0;
+            INT32           rv;
+            TRDP_TIME_T     tv;
+            TRDP_TIME_T     max_tv  = {0u, TEST21_INTERVAL};
+            char            data2[1432u];
+            UINT32          dataSize2 = sizeof(data2);
+            TRDP_PD_INFO_T  pdInfo;
+
+            FD_ZERO(&rfds);
+            err = tlc_getGroupInterval(&group, &tv, &rfds, &noDesc);
+            IF_ERROR("tlc_getGroupInterval");
+            if (vos_cmpTime(&tv, &max_tv) > 0)
+            {
+                tv = max_tv;
+            }
+            rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+            (void) tlc_processGroup(&group, &rfds, &rv);
+
+            err = tlp_get(session[1], subHandle, &pdInfo, (UINT8 *) data2, &dataSize2);
+            if ((err == TRDP_NO_ERR)
+                && (pdInfo.seqCount != lastSeq)
+                && (dataSize2 == TEST21_DATA_LEN)
+                && (memcmp(data2, TEST21_DATA, TEST21_DATA_LEN) == 0))
+            {
+                lastSeq = pdInfo.seqCount;
+                received++;
+            }
+        }
+        err = TRDP_NO_ERR;
+
+        fprintf(gFp, "%u telegrams received in %u loops\n", received, TEST21_LOOPS);
+        if (received < TEST21_LOOPS / 5u)
+        {
+            FAILED("too few telegrams received");
+        }
+
+        err = tlp_unpublish(session[0], pubHandle);
+        IF_ERROR("tlp_unpublish");
+        err = tlp_unsubscribe(session[1], subHandle);
+        IF_ERROR("tlp_unsubscribe");
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+end:
+    if (session[1] != NULL)
+    {
+        (void) tlc_closeSession(session[1]);
+    }
+    if (session[0] != NULL)
+    {
+        (void) tlc_closeSession(session[0]);
+    }
+    tlc_terminate();
+
+    if (gFailed)
+    {
+        fprintf(gFp, "\n###########  FAILED!  ###############\nlasterr = %d\n", err);
+    }
+    else
+    {
+        fprintf(gFp, "\n-----------  Success  ---------------\n");
+    }
+    fprintf(gFp, "--------- End of %s --------------\n\n", __FUNCTION__);
+
+    return gFailed;
+}
+
+
+/**********************************************************************************************************************/
+/** test22 cyclic thread on absolute deadlines (vos_cyclicThreadEx)
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+#define TEST22_INTERVAL         1000u
+#define TEST22_DURATION         200000u
+
+typedef struct
+{
+    VOS_CYCLIC_STATISTICS_T statistics;
+    UINT32                  calls;
+} TEST22_ARG_T;
+
+static void test22Cycle (void *pArg)
+{
+    ((TEST22_ARG_T *) pArg)->calls++;
+}
+
+static void test22Thread (void *pArg)
+{
+    vos_cyclicThreadEx(TEST22_INTERVAL, VOS_CYCLIC_CATCH_UP, &((TEST22_ARG_T *) pArg)->statistics,
+                       test22Cycle, pArg);
+}
+
+static int test22 ()
+{
+    TRDP_ERR_T      err = TRDP_NO_ERR;
+    VOS_THREAD_T    thread  = NULL;
+    TEST22_ARG_T    arg;
+
+    gFailed     = 0;
+    gFullLog    = FALSE;
+    fprintf(gFp, "\n---- Start of %s (%s) ---------\n\n", __FUNCTION__, "Cyclic thread, absolute deadlines");
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+        UINT32  histSum = 0u;
+        UINT32  calls;
+        UINT32  i;
+
+        memset(&arg, 0, sizeof(arg));
+
+        err = tlc_init(dbgOut, NULL, NULL);
+        IF_ERROR("tlc_init");
+
+        if (vos_threadCreate(&thread, "test22", VOS_THREAD_POLICY_OTHER, 0u, 0u, 0u,
+                             test22Thread, &arg) != VOS_NO_ERR)
+        {
+            FAILED("vos_threadCreate");
+        }
+        (void) vos_threadDelay(TEST22_DURATION);
+        (void) vos_threadTerminate(thread);
+        (void) vos_threadDelay(10u * TEST22_INTERVAL);
+
+        calls = arg.calls;
+        for (i = 0u; i < VOS_CYCLIC_HIST_SIZE; i++)
+        {
+            histSum += arg.statistics.execTimeHist[i];
+        }
+        fprintf(gFp, "%u calls, %u overruns, lateness max %u us avg %u us, runtime max %u us\n",
+                calls, arg.statistics.overruns, arg.statistics.maxLateness, arg.statistics.avgLateness,
+                arg.statistics.maxExecTime);
+
+        /* catch-up keeps the number of calls on the deadline grid */
+        if ((calls < (TEST22_DURATION / TEST22_INTERVAL) * 3u / 4u)
+            || (calls > (TEST22_DURATION / TEST22_INTERVAL) + 5u))
+        {
+            FAILED("number of calls off the deadline grid");
+        }
+        if ((arg.statistics.interval != TEST22_INTERVAL)
+            || (arg.statistics.cycles != calls)
+            || (histSum != calls)
+            || (arg.statistics.avgLateness > arg.statistics.maxLateness))
+        {
+            FAILED("inconsistent cyclic thread statistics");
+        }
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+end:
+    tlc_terminate();
+
+    if (gFailed)
+    {
+        fprintf(gFp, "\n###########  FAILED!  ###############\nlasterr = %d\n", err);
+    }
+    else
+    {
+        fprintf(gFp, "\n-----------  Success  ---------------\n");
+    }
+    fprintf(gFp, "--------- End of %s --------------\n\n", __FUNCTION__);
+
+    return gFailed;
+}
+
+
+/**********************************************************************************************************************/
+/** test23 PD timing histograms (TRDP_OPTION_PD_TIMING, tlc_getPdTimingStatistics)
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static void test23PDcallBack (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_PD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    (void) pRefCon;
+    (void) appHandle;
+    (void) pMsg;
+    (void) pData;
+    (void) dataSize;
+}
+
+static UINT32 test23HistSum (
+    const TRDP_TIMING_HIST_T *pHist)
+{
+    UINT32  sum = 0u;
+    UINT32  i;
+
+    for (i = 0u; i < TRDP_TIMING_HIST_SIZE; i++)
+    {
+        sum += pHist->hist[i];
+    }
+    return sum;
+}
+
+static int test23 ()
+{
+    TRDP_ERR_T              err = TRDP_NO_ERR;
+    TRDP_APP_SESSION_T      session[2] = {NULL, NULL};
+    TRDP_SESSION_GROUP_T    group;
+    TRDP_PROCESS_CONFIG_T   processConfig = {"test23", "", 0u, 0u, TRDP_OPTION_PD_TIMING};
+
+    gFailed     = 0;
+    gFullLog    = FALSE;
+    fprintf(gFp, "\n---- Start of %s (%s) ---------\n\n", __FUNCTION__, "PD timing histograms");
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+#define TEST23_COMID            23000u
+#define TEST23_INTERVAL         20000u
+#define TEST23_LOOPS            50u
+#define TEST23_DATA             "Hello Timing!"
+#define TEST23_DATA_LEN         13u
+
+        TRDP_PUB_T                  pubHandle;
+        TRDP_SUB_T                  subHandle;
+        TRDP_PD_TIMING_STATISTICS_T timing[8];
+        TRDP_PD_TIMING_STATISTICS_T pubTiming;
+        TRDP_PD_TIMING_STATISTICS_T subTiming;
+        UINT16                      numPd;
+        UINT32                      loop;
+
+        err = tlc_init(dbgOut, NULL, NULL);
+        IF_ERROR("tlc_init");
+        err = tlc_openSession(&session[0], gSession1.ifaceIP, 0u, NULL, NULL, NULL, &processConfig);
+        IF_ERROR("tlc_openSession 1");
+        err = tlc_openSession(&session[1], gSession2.ifaceIP, 0u, NULL, NULL, NULL, &processConfig);
+        IF_ERROR("tlc_openSession 2");
+
+        group.numSessions   = 2u;
+        group.pSession      = session;
+
+        err = tlp_publish(session[0], &pubHandle, NULL, NULL, TEST23_COMID, 0u, 0u,
+                          0u, gSession2.ifaceIP, TEST23_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL,
+                          (UINT8 *) TEST23_DATA, TEST23_DATA_LEN);
+        IF_ERROR("tlp_publish");
+
+        err = tlp_subscribe(session[1], &subHandle, NULL, test23PDcallBack, TEST23_COMID, 0u, 0u,
+                            gSession1.ifaceIP, 0u, 0u, TRDP_FLAGS_CALLBACK | TRDP_FLAGS_FORCE_CB,
+                            TEST23_INTERVAL * 3u, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe");
+
+        for (loop = 0u; loop < TEST23_LOOPS; loop++)
+        {
+            TRDP_FDS_T      rfds;
+            INT32           noDesc  = 0;
+            INT32           rv;
+            TRDP_TIME_T     tv;
+            TRDP_TIME_T     max_tv  = {0u, TEST23_INTERVAL};
+
+            FD_ZERO(&rfds);
+            (void) tlc_getGroupInterval(&group, &tv, &rfds, &noDesc);
+            if (vos_cmpTime(&tv, &max_tv) > 0)
+            {
+                tv = max_tv;
+            }
+            rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+            (void) tlc_processGroup(&group, &rfds, &rv);
+        }
+
+        /* the sessions also hold the statistics telegrams */
+        memset(&pubTiming, 0, sizeof(pubTiming));
+        memset(&subTiming, 0, sizeof(subTiming));
+        numPd   = 8u;
+        err     = tlc_getPdTimingStatistics(session[0], &numPd, timing);
+        IF_ERROR("tlc_getPdTimingStatistics publisher");
+        while (numPd-- > 0u)
+        {
+            if (timing[numPd].comId == TEST23_COMID)
+            {
+                pubTiming = timing[numPd];
+            }
+        }
+        numPd   = 8u;
+        err     = tlc_getPdTimingStatistics(session[1], &numPd, timing);
+        IF_ERROR("tlc_getPdTimingStatistics subscriber");
+        while (numPd-- > 0u)
+        {
+            if (timing[numPd].comId == TEST23_COMID)
+            {
+                subTiming = timing[numPd];
+            }
+        }
+
+        fprintf(gFp, "send lateness: %u samples, max %u us\n", pubTiming.sendLateness.count, pubTiming.sendLateness.max);
+        fprintf(gFp, "inter-arrival: %u samples, max %u us\n", subTiming.interArrival.count, subTiming.interArrival.max);
+        fprintf(gFp, "callback:      %u samples, max %u us\n", subTiming.cbExecTime.count, subTiming.cbExecTime.max);
+
+        if ((pubTiming.comId != TEST23_COMID) || (pubTiming.subscriber != 0u)
+            || (subTiming.comId != TEST23_COMID) || (subTiming.subscriber != 1u))
+        {
+            FAILED("wrong timing statistics entries");
+        }
+        if ((pubTiming.sendLateness.count < TEST23_LOOPS / 5u)
+            || (subTiming.interArrival.count < TEST23_LOOPS / 5u)
+            || (subTiming.cbExecTime.count < TEST23_LOOPS / 5u))
+        {
+            FAILED("too few timing samples");
+        }
+        if ((test23HistSum(&pubTiming.sendLateness) != pubTiming.sendLateness.count)
+            || (test23HistSum(&subTiming.interArrival) != subTiming.interArrival.count)
+            || (test23HistSum(&subTiming.cbExecTime) != subTiming.cbExecTime.count))
+        {
+            FAILED("histogram does not add up");
+        }
+
+        err = tlc_resetStatistics(session[1]);
+        IF_ERROR("tlc_resetStatistics");
+        numPd   = 8u;
+        err     = tlc_getPdTimingStatistics(session[1], &numPd, timing);
+        IF_ERROR("tlc_getPdTimingStatistics after reset");
+        while (numPd-- > 0u)
+        {
+            if ((timing[numPd].interArrival.count != 0u) || (timing[numPd].cbExecTime.count != 0u))
+            {
+                FAILED("tlc_resetStatistics did not clear the timing histograms");
+            }
+        }
+
+        err = tlp_unpublish(session[0], pubHandle);
+        IF_ERROR("tlp_unpublish");
+        err = tlp_unsubscribe(session[1], subHandle);
+        IF_ERROR("tlp_unsubscribe");
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+end:
+    if (session[1] != NULL)
+    {
+        (void) tlc_closeSession(session[1]);
+    }
+    if (session[0] != NULL)
+    {
+        (void) tlc_closeSession(session[0]);
+    }
+    tlc_terminate();
+
+    if (gFailed)
+    {
+        fprintf(gFp, "\n###########  FAILED!  ###############\nlasterr = %d\n", err);
+    }
+    else
+    {
+        fprintf(gFp, "\n-----------  Success  ---------------\n");
+    }
+    fprintf(gFp, "--------- End of %s --------------\n\n", __FUNCTION__);
+
+    return gFailed;
+}
+
+
+/**********************************************************************************************************************/
+/** test24
+ *
+ *  Statistics read without the session lock while the session threads process, aggregates kept on change
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static int test24 ()
+{
+    /* allocates appHandle1, appHandle2, failed = 0, err = TRDP_NO_ERR */
+    PREPARE("Lock-free statistics", "");
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+#define TEST24_COMID1       24001u
+#define TEST24_COMID2       24002u
+#define TEST24_COMID3       24003u
+#define TEST24_MCDEST       0xEF000318u
+#define TEST24_INTERVAL     10000u
+#define TEST24_DATA         "Hello Statistics!"
+#define TEST24_DATA_LEN     17u
+
+        TRDP_PUB_T          pubHandle;
+        TRDP_SUB_T          subHandle1;
+        TRDP_SUB_T          subHandle2;
+        TRDP_SUB_T          subHandle3;
+        TRDP_STATISTICS_T   pubBefore;
+        TRDP_STATISTICS_T   subBefore;
+        TRDP_STATISTICS_T   pubStats;
+        TRDP_STATISTICS_T   subStats;
+        UINT32              loop;
+
+        err = tlc_getStatistics(appHandle1, &pubBefore);
+        IF_ERROR("tlc_getStatistics 1");
+        err = tlc_getStatistics(appHandle2, &subBefore);
+        IF_ERROR("tlc_getStatistics 2");
+
+        /* two subscriptions on the same multicast group need one join */
+        err = tlp_subscribe(appHandle2, &subHandle1, NULL, NULL, TEST24_COMID1, 0u, 0u, 0u, 0u,
+                            TEST24_MCDEST, TRDP_FLAGS_DEFAULT, TEST24_INTERVAL * 10u, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe1");
+        err = tlp_subscribe(appHandle2, &subHandle2, NULL, NULL, TEST24_COMID2, 0u, 0u, 0u, 0u,
+                            TEST24_MCDEST, TRDP_FLAGS_DEFAULT, TEST24_INTERVAL * 10u, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe2");
+        err = tlp_subscribe(appHandle2, &subHandle3, NULL, NULL, TEST24_COMID3, 0u, 0u, 0u, 0u,
+                            0u, TRDP_FLAGS_DEFAULT, TEST24_INTERVAL * 10u, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe3");
+        err = tlp_publish(appHandle1, &pubHandle, NULL, NULL, TEST24_COMID3, 0u, 0u, 0u, gSession2.ifaceIP,
+                          TEST24_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL, (UINT8 *) TEST24_DATA, TEST24_DATA_LEN);
+        IF_ERROR("tlp_publish");
+
+        /* poll while the session threads are sending and receiving */
+        for (loop = 0u; loop < 20u; loop++)
+        {
+            err = tlc_getStatistics(appHandle2, &subStats);
+            IF_ERROR("tlc_getStatistics");
+            vos_threadDelay(TEST24_INTERVAL);
+        }
+        err = tlc_getStatistics(appHandle1, &pubStats);
+        IF_ERROR("tlc_getStatistics 1");
+        err = tlc_getStatistics(appHandle2, &subStats);
+        IF_ERROR("tlc_getStatistics 2");
+
+        fprintf(gFp, "pub: numPub %u numSend %u, sub: numSubs %u numJoin %u numRcv %u\n",
+                pubStats.pd.numPub, pubStats.pd.numSend, subStats.pd.numSubs, subStats.numJoin, subStats.pd.numRcv);
+
+        if ((pubStats.pd.numPub != pubBefore.pd.numPub + 1u)
+            || (subStats.pd.numSubs != subBefore.pd.numSubs + 3u)
+            || (subStats.numJoin != subBefore.numJoin + 1u))
+        {
+            FAILED("wrong numPub/numSubs/numJoin");
+        }
+        if ((pubStats.pd.numSend <= pubBefore.pd.numSend) || (subStats.pd.numRcv <= subBefore.pd.numRcv))
+        {
+            FAILED("counters did not move");
+        }
+
+        /* reset clears the counters, but not what is currently set up */
+        err = tlc_resetStatistics(appHandle2);
+        IF_ERROR("tlc_resetStatistics");
+        err = tlc_getStatistics(appHandle2, &subStats);
+        IF_ERROR("tlc_getStatistics after reset");
+        if ((subStats.pd.numRcv >= subBefore.pd.numRcv + 10u)
+            || (subStats.pd.numSubs != subBefore.pd.numSubs + 3u)
+            || (subStats.numJoin != subBefore.numJoin + 1u))
+        {
+            FAILED("tlc_resetStatistics");
+        }
+
+        err = tlp_unsubscribe(appHandle2, subHandle1);
+        IF_ERROR("tlp_unsubscribe1");
+        err = tlp_unsubscribe(appHandle2, subHandle2);
+        IF_ERROR("tlp_unsubscribe2");
+        err = tlp_unsubscribe(appHandle2, subHandle3);
+        IF_ERROR("tlp_unsubscribe3");
+        err = tlp_unpublish(appHandle1, pubHandle);
+        IF_ERROR("tlp_unpublish");
+
+        err = tlc_getStatistics(appHandle1, &pubStats);
+        IF_ERROR("tlc_getStatistics 1");
+        err = tlc_getStatistics(appHandle2, &subStats);
+        IF_ERROR("tlc_getStatistics 2");
+        if ((pubStats.pd.numPub != pubBefore.pd.numPub)
+            || (subStats.pd.numSubs != subBefore.pd.numSubs)
+            || (subStats.numJoin != subBefore.numJoin))
+        {
+            FAILED("aggregates not back after unsubscribe/unpublish");
+        }
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test25
+ *
+ *  Statistics exported into shared memory, read back through a second attachment
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static int test25 ()
+{
+    /* allocates appHandle1, appHandle2, failed = 0, err = TRDP_NO_ERR */
+    PREPARE("Shared memory statistics", "");
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+#define TEST25_COMID        25001u
+#define TEST25_KEY          "/trdp_api_test25"
+#define TEST25_INTERVAL     10000u
+#define TEST25_DATA         "Hello Shared Memory!"
+#define TEST25_DATA_LEN     20u
+
+        TRDP_PUB_T              pubHandle;
+        TRDP_SUB_T              subHandle;
+        VOS_SHRD_T              shrdHandle  = NULL;
+        TRDP_STATS_EXPORT_T     *pExport    = NULL;
+        UINT32                  size        = sizeof(TRDP_STATS_EXPORT_T);
+        TRDP_STATS_EXPORT_T     header;
+        TRDP_SUBS_STATISTICS_T  subs[4];
+        UINT32                  seq;
+        UINT32                  i;
+        UINT32                  retries = 0u;
+
+        err = tlp_subscribe(appHandle2, &subHandle, NULL, NULL, TEST25_COMID, 0u, 0u, 0u, 0u,
+                            0u, TRDP_FLAGS_DEFAULT, TEST25_INTERVAL * 10u, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe");
+        err = tlp_publish(appHandle1, &pubHandle, NULL, NULL, TEST25_COMID, 0u, 0u, 0u, gSession2.ifaceIP,
+                          TEST25_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL, (UINT8 *) TEST25_DATA, TEST25_DATA_LEN);
+        IF_ERROR("tlp_publish");
+
+        err = tlc_openStatisticsExport(appHandle2, TEST25_KEY, 4u, 4u, TEST25_INTERVAL);
+        IF_ERROR("tlc_openStatisticsExport");
+        if (tlc_openStatisticsExport(appHandle2, TEST25_KEY, 4u, 4u, TEST25_INTERVAL) != TRDP_PARAM_ERR)
+        {
+            FAILED("second tlc_openStatisticsExport accepted");
+        }
+
+        vos_threadDelay(20u * TEST25_INTERVAL);
+
+        /* attach as a monitoring tool would do: must not disturb the area */
+        if (vos_sharedOpen(TEST25_KEY, &shrdHandle, (UINT8 * *) &pExport, &size) != VOS_NO_ERR)
+        {
+            FAILED("vos_sharedOpen");
+        }
+
+        /* copy between two equal, even sequence counts */
+        do
+        {
+            if (++retries > 1000u)
+            {
+                (void) vos_sharedClose(shrdHandle, (UINT8 *) pExport);
+                FAILED("no stable snapshot");
+            }
+            seq = pExport->sequence;
+            __sync_synchronize();
+            header = *pExport;
+            memcpy(subs, (UINT8 *) pExport + header.subsOffset, sizeof(subs));
+            __sync_synchronize();
+        }
+        while (((seq & 1u) != 0u) || (seq != pExport->sequence));
+
+        (void) vos_sharedClose(shrdHandle, (UINT8 *) pExport);
+
+        fprintf(gFp, "seq %u size %u/%u subs %u pub %u numRcv %u\n",
+                seq, header.size, size, header.numSubs, header.numPub, header.statistics.pd.numRcv);
+
+        if ((header.magic != TRDP_STATS_EXPORT_MAGIC) || (header.version != TRDP_STATS_EXPORT_VERSION) ||
+            (header.size > size) || (header.maxSubs != 4u) || (seq < 4u))
+        {
+            FAILED("export header");
+        }
+        if ((header.statistics.pd.numRcv == 0u) || (header.numSubs != header.statistics.pd.numSubs))
+        {
+            FAILED("export statistics");
+        }
+        for (i = 0u; i < header.numSubs; i++)
+        {
+            if ((subs[i].comId == TEST25_COMID) && (subs[i].numRecv > 0u))
+            {
+                break;
+            }
+        }
+        if (i == header.numSubs)
+        {
+            FAILED("subscription missing in export");
+        }
+
+        err = tlc_closeStatisticsExport(appHandle2);
+        IF_ERROR("tlc_closeStatisticsExport");
+
+        err = tlp_unsubscribe(appHandle2, subHandle);
+        IF_ERROR("tlp_unsubscribe");
+        err = tlp_unpublish(appHandle1, pubHandle);
+        IF_ERROR("tlp_unpublish");
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test26
+ *  Hot path trace (TRACE=TRUE): one ring overfilled, a ring read while it is written, threads beyond the ring count
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+#ifdef TRDP_TRACE
+#define TEST26_COMID        26001u
+#define TEST26_LOOPS        (TRDP_TRACE_RING_SIZE + TRDP_TRACE_RING_SIZE / 2u)
+#define TEST26_FILE         "test26.trace"
+
+typedef struct
+{
+    UINT32          comId;
+    UINT32          numRecords;         /* records to write, 0: until stopped */
+    volatile BOOL8  stop;
+    volatile BOOL8  done;
+    volatile UINT32 written;
+} TEST26_ARG_T;
+
+static TRDP_TRACE_REC_T gTest26Rec[TRDP_TRACE_MAX_THREADS * TRDP_TRACE_RING_SIZE];
+
+static void test26Thread (void *pArg)
+{
+    TEST26_ARG_T *pArgs = (TEST26_ARG_T *) pArg;
+
+    while (!pArgs->stop && ((pArgs->numRecords == 0u) || (pArgs->written < pArgs->numRecords)))
+    {
+        trdp_traceWrite(0u, TRDP_TRACE_PD_SEND, pArgs->comId, pArgs->written + 1u, 0u, vos_getTimeNs(), 0u);
+        pArgs->written++;
+    }
+    pArgs->done = TRUE;
+}
+
+/* Wait for the writer threads */
+static BOOL8 test26Wait (TEST26_ARG_T *pArgs, UINT32 numThreads)
+{
+    UINT32 i;
+    UINT32 loops;
+
+    for (i = 0u; i < numThreads; i++)
+    {
+        for (loops = 0u; !pArgs[i].done && (loops < 5000u); loops++)
+        {
+            (void) vos_threadDelay(1000u);
+        }
+        if (!pArgs[i].done)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* Number of records lost so far (from the header of a trace dump), ~0 on error */
+static UINT32 test26Lost (void)
+{
+    TRDP_TRACE_FILE_T   header;
+    FILE                *pFile;
+    UINT32              numLost = ~0u;
+
+    if (tlc_dumpTrace(TEST26_FILE) == TRDP_NO_ERR)
+    {
+        pFile = fopen(TEST26_FILE, "rb");
+        if (pFile != NULL)
+        {
+            if ((fread(&header, sizeof(header), 1u, pFile) == 1u) && (header.magic == TRDP_TRACE_FILE_MAGIC))
+            {
+                numLost = header.numLost;
+            }
+            fclose(pFile);
+        }
+        (void) remove(TEST26_FILE);
+    }
+    return numLost;
+}
+
+/* Records of one writer: number, first and last sequence count, TRUE if they are consecutive and of one thread */
+static UINT32 test26Records (UINT32 numRecords, UINT32 comId, UINT32 *pFirst, UINT32 *pLast, BOOL8 *pOrdered)
+{
+    UINT32  count   = 0u;
+    UINT32  thread  = 0u;
+    UINT32  i;
+
+    *pOrdered = TRUE;
+    for (i = 0u; i < numRecords; i++)
+    {
+        if (gTest26Rec[i].comId != comId)
+        {
+            continue;
+        }
+        if (count == 0u)
+        {
+            *pFirst = gTest26Rec[i].seqCnt;
+            thread  = gTest26Rec[i].thread;
+        }
+        else if ((gTest26Rec[i].seqCnt != *pLast + 1u) || (gTest26Rec[i].thread != thread))
+        {
+            *pOrdered = FALSE;
+        }
+        *pLast = gTest26Rec[i].seqCnt;
+        count++;
+    }
+    return count;
+}
+#endif
+
+static int test26 ()
+{
+    TRDP_ERR_T  err = TRDP_NO_ERR;
+
+    gFailed     = 0;
+    gFullLog    = FALSE;
+    fprintf(gFp, "\n---- Start of %s (%s) ---------\n\n", __FUNCTION__, "Hot path trace rings");
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifndef TRDP_TRACE
+    fprintf(gFp, "TRDP_TRACE not compiled in (TRACE=TRUE), nothing to test\n");
+    goto end;
+#else
+    {
+        static TEST26_ARG_T arg[TRDP_TRACE_MAX_THREADS + 2u];
+        VOS_THREAD_T        thread;
+        UINT32              numLost;
+        UINT32              numRecords;
+        UINT32              count;
+        UINT32              first   = 0u;
+        UINT32              last    = 0u;
+        BOOL8               ordered;
+        UINT32              i;
+
+        memset(arg, 0, sizeof(arg));
+
+        err = tlc_init(dbgOut, NULL, NULL);
+        IF_ERROR("tlc_init");
+
+        /* one thread overfills its ring: the newest TRDP_TRACE_RING_SIZE - 1 records are read, in order */
+        numLost             = test26Lost();
+        arg[0].comId        = TEST26_COMID;
+        arg[0].numRecords   = TEST26_LOOPS;
+        if ((vos_threadCreate(&thread, "test26", VOS_THREAD_POLICY_OTHER, 0u, 0u, 0u,
+                              test26Thread, &arg[0]) != VOS_NO_ERR) || !test26Wait(&arg[0], 1u))
+        {
+            FAILED("trace writer 1");
+        }
+        if (test26Lost() == numLost + TEST26_LOOPS)
+        {
+            /* the rings are claimed for good, earlier tests of this process may have taken all of them */
+            fprintf(gFp, "No trace ring left for the test thread, run the test on its own (-m 26)\n");
+            goto end;
+        }
+        numRecords  = TRDP_TRACE_MAX_THREADS * TRDP_TRACE_RING_SIZE;
+        err         = tlc_getTrace(gTest26Rec, &numRecords);
+        IF_ERROR("tlc_getTrace");
+        count = test26Records(numRecords, TEST26_COMID, &first, &last, &ordered);
+        fprintf(gFp, "%u records of writer 1 (%u..%u)\n", count, first, last);
+        if ((count != TRDP_TRACE_RING_SIZE - 1u) || (first != TEST26_LOOPS - TRDP_TRACE_RING_SIZE + 2u) ||
+            (last != TEST26_LOOPS) || !ordered)
+        {
+            FAILED("newest records of the overfilled ring expected in order");
+        }
+
+        /* the ring is read while it is written: overwritten records must be left out */
+        arg[1].comId = TEST26_COMID + 1u;
+        if (vos_threadCreate(&thread, "test26", VOS_THREAD_POLICY_OTHER, 0u, 0u, 0u,
+                             test26Thread, &arg[1]) != VOS_NO_ERR)
+        {
+            FAILED("trace writer 2");
+        }
+        for (i = 0u; ((i < 100u) || (arg[1].written < 4u * TRDP_TRACE_RING_SIZE)) && (i < 100000u); i++)
+        {
+            numRecords  = TRDP_TRACE_MAX_THREADS * TRDP_TRACE_RING_SIZE;
+            err         = tlc_getTrace(gTest26Rec, &numRecords);
+            if ((err != TRDP_NO_ERR) && (err != TRDP_MEM_ERR))  /* records left out are reported as missing */
+            {
+                IF_ERROR("tlc_getTrace while writing");
+            }
+            count = test26Records(numRecords, TEST26_COMID + 1u, &first, &last, &ordered);
+            if ((count >= TRDP_TRACE_RING_SIZE) || !ordered)
+            {
+                fprintf(gFp, "read %u: %u records (%u..%u)\n", i, count, first, last);
+                FAILED("torn or reordered records read while writing");
+            }
+        }
+        arg[1].stop = TRUE;
+        if (!test26Wait(&arg[1], 1u) || (arg[1].written < 4u * TRDP_TRACE_RING_SIZE))
+        {
+            FAILED("writer 2 did not wrap its ring");
+        }
+        err = TRDP_NO_ERR;
+
+        /* more threads than rings: the records of the threads without a ring are counted as lost */
+        numLost = test26Lost();
+        for (i = 2u; i < TRDP_TRACE_MAX_THREADS + 2u; i++)
+        {
+            arg[i].comId        = TEST26_COMID + 2u;
+            arg[i].numRecords   = 1u;
+            if (vos_threadCreate(&thread, "test26", VOS_THREAD_POLICY_OTHER, 0u, 0u, 0u,
+                                 test26Thread, &arg[i]) != VOS_NO_ERR)
+            {
+                FAILED("trace writer 3");
+            }
+        }
+        if (!test26Wait(&arg[2], TRDP_TRACE_MAX_THREADS))
+        {
+            FAILED("trace writers 3");
+        }
+        numLost     = test26Lost() - numLost;
+        numRecords  = TRDP_TRACE_MAX_THREADS * TRDP_TRACE_RING_SIZE;
+        (void) tlc_getTrace(gTest26Rec, &numRecords);
+        count = test26Records(numRecords, TEST26_COMID + 2u, &first, &last, &ordered);
+        fprintf(gFp, "%u records of %u single record writers, %u lost\n", count, TRDP_TRACE_MAX_THREADS, numLost);
+        if ((numLost < 2u) || (count + numLost != TRDP_TRACE_MAX_THREADS))
+        {
+            FAILED("records of threads without a ring not counted as lost");
+        }
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+end:
+    tlc_terminate();
+
+    if (gFailed)
+    {
+        fprintf(gFp, "\n###########  FAILED!  ###############\nlasterr = %d\n", err);
+    }
+    else
+    {
+        fprintf(gFp, "\n-----------  Success  ---------------\n");
+    }
+    fprintf(gFp, "--------- End of %s --------------\n\n", __FUNCTION__);
+
+    return gFailed;
+}
+
+/**********************************************************************************************************************/
+/** test27
+ *  Log level threshold: suppressed output must not evaluate its arguments
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static int test27 ()
+{
+    /* allocates appHandle1, appHandle2, failed = 0, err = TRDP_NO_ERR */
+    PREPARE("Log level threshold", "");
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+        UINT32      evaluated   = 0u;
+        VOS_LOG_T   oldLevel    = vos_getLogLevel();
+
+        if (vos_setLogLevel((VOS_LOG_T) (VOS_LOG_USR + 1)) != VOS_PARAM_ERR)
+        {
+            FAILED("invalid level accepted");
+        }
+        if (vos_setLogLevel(VOS_LOG_WARNING) != VOS_NO_ERR)
+        {
+            FAILED("vos_setLogLevel");
+        }
+        vos_printLog(VOS_LOG_DBG, "test27 debug %u\n", ++evaluated);
+        vos_printLog(VOS_LOG_INFO, "test27 info %u\n", ++evaluated);
+        if (evaluated != 0u)
+        {
+            (void) vos_setLogLevel(oldLevel);
+            FAILED("suppressed log arguments evaluated");
+        }
+        vos_printLog(VOS_LOG_WARNING, "test27 warning %u\n", ++evaluated);
+        vos_printLog(VOS_LOG_USR, "test27 user %u\n", ++evaluated);
+        (void) vos_setLogLevel(oldLevel);
+        if (evaluated != 2u)
+        {
+            FAILED("enabled log output dropped");
+        }
+        vos_printLog(VOS_LOG_DBG, "test27 debug %u\n", ++evaluated);
+        if ((evaluated != 3u) || (vos_getLogLevel() != oldLevel))
+        {
+            FAILED("log level not restored");
+        }
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test28
+ *  Sequence counter table bound: a subscription of any source tracks at most maxNumSources senders
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static int test28 ()
+{
+#define TEST28_MEM_SIZE     (2u * 1024u * 1024u)
+
+    /* as PREPARE, but the stack allocates from a memory area (vos_memInit) instead of the heap */
+    static UINT8        memArea[TEST28_MEM_SIZE];
+    TRDP_MEM_CONFIG_T   memConfig;
+    TRDP_ERR_T          err         = TRDP_NO_ERR;
+    TRDP_APP_SESSION_T  appHandle1  = NULL;
+    TRDP_APP_SESSION_T  appHandle2  = NULL;
+
+    gFailed     = 0;
+    gFullLog    = FALSE;
+    fprintf(gFp, "\n---- Start of %s (%s) ---------\n\n", __FUNCTION__, "Bound of senders per subscription");
+
+    memset(&memConfig, 0, sizeof(memConfig));
+    memConfig.p     = memArea;
+    memConfig.size  = TEST28_MEM_SIZE;
+    err = tlc_init(dbgOut, NULL, &memConfig);
+    IF_ERROR("tlc_init");
+    appHandle1  = test_init(NULL, &gSession1, "");
+    appHandle2  = test_init(NULL, &gSession2, "");
+    if ((appHandle1 == NULL) || (appHandle2 == NULL))
+    {
+        FAILED("tlc_openSession");
+    }
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+#define TEST28_COMID        28001u
+#define TEST28_INTERVAL     10000u
+
+        TRDP_PD_CONFIG_T        pdConfig;
+        TRDP_PUB_T              pubHandle1;
+        TRDP_PUB_T              pubHandle2;
+        TRDP_SUB_T              subHandle;
+        TRDP_SUB_T              subHandle2;
+        TRDP_PD_INFO_T          pdInfo;
+        TRDP_SUBS_STATISTICS_T  subsStat[4];
+        UINT16                  numSubs;
+        UINT8                   data[8];
+        UINT32                  dataSize;
+        UINT32                  numMissed;
+        UINT32                  i;
+
+        memset(&pdConfig, 0, sizeof(pdConfig));
+        pdConfig.toBehavior     = TRDP_TO_DEFAULT;
+        pdConfig.maxNumSources  = 1u;
+        err = tlc_configSession(appHandle2, NULL, &pdConfig, NULL, NULL);
+        IF_ERROR("tlc_configSession");
+
+        err = tlp_subscribe(appHandle2, &subHandle, NULL, NULL, TEST28_COMID, 0u, 0u, 0u, 0u,
+                            0u, TRDP_FLAGS_DEFAULT, TEST28_INTERVAL * 10u, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe");
+        err = tlp_publish(appHandle1, &pubHandle1, NULL, NULL, TEST28_COMID, 0u, 0u, 0u, gSession2.ifaceIP,
+                          TEST28_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL, (UINT8 *) "Sender1", 8u);
+        IF_ERROR("tlp_publish 1");
+
+        vos_threadDelay(5u * TEST28_INTERVAL);
+        numSubs = 4u;
+        err     = tlc_getSubsStatistics(appHandle2, &numSubs, subsStat);
+        IF_ERROR("tlc_getSubsStatistics");
+        for (i = 0u; (i < numSubs) && (subsStat[i].comId != TEST28_COMID); i++)
+        {
+            ;
+        }
+        numMissed = (i < numSubs) ? subsStat[i].numMissed : 0u;
+
+        /* a second sender must be ignored, without an error */
+        err = tlp_publish(appHandle2, &pubHandle2, NULL, NULL, TEST28_COMID, 0u, 0u, 0u, gSession2.ifaceIP,
+                          TEST28_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL, (UINT8 *) "Sender2", 8u);
+        IF_ERROR("tlp_publish 2");
+
+        for (i = 0u; i < 10u; i++)
+        {
+            vos_threadDelay(TEST28_INTERVAL);
+            dataSize    = sizeof(data);
+            err         = tlp_get(appHandle2, subHandle, &pdInfo, data, &dataSize);
+            IF_ERROR("tlp_get");
+            if ((pdInfo.srcIpAddr != gSession1.ifaceIP) || (memcmp(data, "Sender1", 8u) != 0))
+            {
+                FAILED("data of a sender beyond maxNumSources received");
+            }
+        }
+        numSubs = 4u;
+        err     = tlc_getSubsStatistics(appHandle2, &numSubs, subsStat);
+        IF_ERROR("tlc_getSubsStatistics");
+        for (i = 0u; (i < numSubs) && (subsStat[i].comId != TEST28_COMID); i++)
+        {
+            ;
+        }
+        if ((i == numSubs) || (subsStat[i].numMissed < numMissed + 5u))
+        {
+            FAILED("ignored packets of a sender beyond maxNumSources not counted");
+        }
+
+        err = tlp_unpublish(appHandle2, pubHandle2);
+        IF_ERROR("tlp_unpublish 2");
+        err = tlp_unpublish(appHandle1, pubHandle1);
+        IF_ERROR("tlp_unpublish 1");
+        err = tlp_unsubscribe(appHandle2, subHandle);
+        IF_ERROR("tlp_unsubscribe");
+
+        /* too many senders for the largest memory block: capped, the sender tables must still be allocated */
+        pdConfig.maxNumSources = 0xFFFFu;
+        err = tlc_configSession(appHandle1, NULL, &pdConfig, NULL, NULL);
+        IF_ERROR("tlc_configSession");
+
+        err = tlp_subscribe(appHandle1, &subHandle2, NULL, NULL, TEST28_COMID + 1u, 0u, 0u, 0u, 0u,
+                            0u, TRDP_FLAGS_MULTI_SRC, TEST28_INTERVAL * 10u, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe 2");
+        err = tlp_publish(appHandle2, &pubHandle2, NULL, NULL, TEST28_COMID + 1u, 0u, 0u, 0u, gSession1.ifaceIP,
+                          TEST28_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL, (UINT8 *) "Sender2", 8u);
+        IF_ERROR("tlp_publish 3");
+
+        vos_threadDelay(5u * TEST28_INTERVAL);
+        dataSize    = sizeof(data);
+        err         = tlp_get(appHandle1, subHandle2, &pdInfo, data, &dataSize);
+        IF_ERROR("tlp_get with maxNumSources capped");
+        if (memcmp(data, "Sender2", 8u) != 0)
+        {
+            FAILED("no data with maxNumSources capped");
+        }
+
+        err = tlp_unpublish(appHandle2, pubHandle2);
+        IF_ERROR("tlp_unpublish 3");
+        err = tlp_unsubscribe(appHandle1, subHandle2);
+        IF_ERROR("tlp_unsubscribe 2");
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test29
+ *  Multi source subscription: one data slot and one time out per sender
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static UINT32 gTest29TimeOuts = 0u;
+
+static void test29PDcallBack (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_PD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    if ((pMsg->resultCode == TRDP_TIMEOUT_ERR) && (pMsg->srcIpAddr == gSession1.ifaceIP))
+    {
+        gTest29TimeOuts++;
+    }
+}
 
+static int test29 ()
+{
+    /* allocates appHandle1, appHandle2, failed = 0, err = TRDP_NO_ERR */
+    PREPARE("Multi source subscription", "");
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+#define TEST29_COMID        29001u
+#define TEST29_INTERVAL     10000u
+
+        TRDP_PUB_T          pubHandle1;
+        TRDP_PUB_T          pubHandle2;
+        TRDP_SUB_T          subHandle;
+        TRDP_PD_INFO_T      pdInfo;
+        UINT8               data[8];
+        UINT32              dataSize;
+        UINT32              numSources = 0u;
+        UINT32              i;
+
+        gTest29TimeOuts = 0u;
+        err = tlp_subscribe(appHandle2, &subHandle, NULL, test29PDcallBack, TEST29_COMID, 0u, 0u, 0u, 0u,
+                            0u, TRDP_FLAGS_MULTI_SRC | TRDP_FLAGS_CALLBACK, TEST29_INTERVAL * 5u, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe");
+        err = tlp_publish(appHandle1, &pubHandle1, NULL, NULL, TEST29_COMID, 0u, 0u, 0u, gSession2.ifaceIP,
+                          TEST29_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL, (UINT8 *) "Sender1", 8u);
+        IF_ERROR("tlp_publish 1");
+        err = tlp_publish(appHandle2, &pubHandle2, NULL, NULL, TEST29_COMID, 0u, 0u, 0u, gSession2.ifaceIP,
+                          TEST29_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL, (UINT8 *) "Sender2", 8u);
+        IF_ERROR("tlp_publish 2");
+
+        vos_threadDelay(10u * TEST29_INTERVAL);
+
+        err = tlp_getSources(appHandle2, subHandle, &numSources);
+        IF_ERROR("tlp_getSources");
+        if (numSources != 2u)
+        {
+            FAILED("two senders expected");
+        }
+        for (i = 0u; i < numSources; i++)
+        {
+            dataSize    = sizeof(data);
+            err         = tlp_getSourceByIndex(appHandle2, subHandle, i, &pdInfo, data, &dataSize);
+            IF_ERROR("tlp_getSourceByIndex");
+            if (memcmp(data, (pdInfo.srcIpAddr == gSession1.ifaceIP) ? "Sender1" : "Sender2", 8u) != 0)
+            {
+                FAILED("data of another sender received");
+            }
+        }
+        dataSize    = sizeof(data);
+        err         = tlp_getSourceByAddr(appHandle2, subHandle, gSession1.ifaceIP, &pdInfo, data, &dataSize);
+        IF_ERROR("tlp_getSourceByAddr 1");
+        if ((pdInfo.srcIpAddr != gSession1.ifaceIP) || (memcmp(data, "Sender1", 8u) != 0))
+        {
+            FAILED("data of sender 1 expected");
+        }
+
+        /* sender 1 stops, sender 2 must stay valid */
+        err = tlp_unpublish(appHandle1, pubHandle1);
+        IF_ERROR("tlp_unpublish 1");
 
+        vos_threadDelay(10u * TEST29_INTERVAL);
+
+        dataSize    = sizeof(data);
+        err         = tlp_getSourceByAddr(appHandle2, subHandle, gSession1.ifaceIP, &pdInfo, data, &dataSize);
+        if (err != TRDP_TIMEOUT_ERR)
+        {
+            FAILED("time out of sender 1 expected");
+        }
+        dataSize    = sizeof(data);
+        err         = tlp_getSourceByAddr(appHandle2, subHandle, gSession2.ifaceIP, &pdInfo, data, &dataSize);
+        IF_ERROR("tlp_getSourceByAddr 2");
+        if (memcmp(data, "Sender2", 8u) != 0)
+        {
+            FAILED("data of sender 2 expected");
+        }
+        if (gTest29TimeOuts != 1u)
+        {
+            FAILED("one time out callback for sender 1 expected");
+        }
+        err = tlp_getSourceByAddr(appHandle2, subHandle, 0x0A000263u, &pdInfo, NULL, NULL);
+        if (err != TRDP_NODATA_ERR)
+        {
+            FAILED("unknown sender must report TRDP_NODATA_ERR");
+        }
+        err = TRDP_NO_ERR;
+
+        err = tlp_unpublish(appHandle2, pubHandle2);
+        IF_ERROR("tlp_unpublish 2");
+        err = tlp_unsubscribe(appHandle2, subHandle);
+        IF_ERROR("tlp_unsubscribe");
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+    CLEANUP;
+}
 
 /**********************************************************************************************************************/
 /* This array holds pointers to the m-th test (m = 1 will execute test1...)                                           */
@@ -2103,6 +3755,19 @@ test_func_t *testArray[] =
     test14,  /* Publish & Subscribe, Callback */
     test15, /* MD Request - Reply / Reuse of TCP connection */
     test16, /* MD Request - Reply / UDP */
+    test17, /* MD Request - Reply, data sent in place (vectored send) */
+    test18, /* MD multicast Request - Reply, aggregated replies */
+    test19, /* MD TCP Request - Reply, pipelined requests */
+    test20, /* Bulk publish and subscribe (tlc_applyConfig) */
+    test21, /* Session group, one select for two sessions */
+    test22, /* Cyclic thread, absolute deadlines */
+    test23, /* PD timing histograms */
+    test24, /* Lock-free statistics */
+    test25, /* Shared memory statistics export */
+    test26, /* Hot path trace rings (TRACE=TRUE) */
+    test27, /* Log level threshold */
+    test28, /* Bound of senders per subscription */
+    test29, /* Multi source subscription */
     NULL
 };
 
@@ -0,0 +1,55 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-xmlcompile.c
+ *
+ * @brief           Compile an XML configuration into a binary configuration image
+ *
+ * @details         Parses the XML configuration file with tau_readXmlDeviceConfig, tau_readXmlInterfaceConfig
+ *                  and tau_readXmlDatasetConfig and writes the results as image for tau_prepareXmlImage.
+ *                  The image is only valid for the platform this tool is built for.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          TCNOpen TRDP contributors
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen TRDP contributors, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include "tau_xml.h"
+
+/***********************************************************************************************************************
+    Compile XML configuration file
+***********************************************************************************************************************/
+int main (int argc, char *argv[])
+{
+    TRDP_XML_DOC_HANDLE_T   docHandle;
+    TRDP_ERR_T              result;
+
+    if (argc != 3)
+    {
+        printf("usage: %s <xmlfilename> <imagefilename>\n", argv[0]);
+        return 1;
+    }
+
+    result = tau_prepareXmlDoc(argv[1], &docHandle);
+    if (result != TRDP_NO_ERR)
+    {
+        printf("Failed to parse XML document %s\n", argv[1]);
+        return 1;
+    }
+
+    result = tau_compileXmlConfig(&docHandle, argv[2]);
+    tau_freeXmlDoc(&docHandle);
+    if (result != TRDP_NO_ERR)
+    {
+        printf("Failed to compile %s (error %d)\n", argv[1], result);
+        return 1;
+    }
+    return 0;
+}
@@ -9,6 +9,7 @@
  *                  tau_readXmlDatasetConfig
  *                  tau_readXmlInterfaceConfig
  *                  Prints all parsed data to stdout.
+ *                  With option -i the data is taken from a configuration image made by trdp-xmlcompile.
  *
  * @note            Project: TCNOpen TRDP prototype stack
  *
@@ -20,6 +21,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-18: Option -i prints a compiled configuration image
  */
 
 #include <stdio.h>
@@ -292,6 +294,8 @@ int main(int argc, char * argv[])
 {
     const char * pFileName;
     TRDP_XML_DOC_HANDLE_T   docHandle;
+    TRDP_XML_IMAGE_HANDLE_T imgHandle;
+    int                     useImage = 0;
     TRDP_ERR_T              result;
     TRDP_MEM_CONFIG_T       memConfig;
     TRDP_DBG_CONFIG_T       dbgConfig;
@@ -309,27 +313,49 @@ int main(int argc, char * argv[])
 
     printf("TRDP xml parsing test program\n");
 
-    if (argc != 2)
+    if ((argc == 3) && (strcmp(argv[1], "-i") == 0))
     {
-        printf("usage: %s <xmlfilename>\n", argv[0]);
+        useImage = 1;
+    }
+    else if (argc != 2)
+    {
+        printf("usage: %s [-i] <xmlfilename>\n", argv[0]);
         return 1;
     }
-    pFileName = argv[1];
+    pFileName = argv[argc - 1];
 
-    /*  Prepare XML document    */
-    result = tau_prepareXmlDoc(pFileName, &docHandle);
-    if (result != TRDP_NO_ERR)
+    if (useImage)
     {
-        printf("Failed to parse XML document\n");
-        return 1;
+        /*  Map compiled configuration  */
+        result = tau_prepareXmlImage(pFileName, &imgHandle);
+        if (result != TRDP_NO_ERR)
+        {
+            printf("Failed to load configuration image\n");
+            return 1;
+        }
+        result = tau_readImageDeviceConfig(
+            &imgHandle,
+            &memConfig, &dbgConfig,
+            &numComPar, &pComPar,
+            &numIfConfig, &pIfConfig);
     }
+    else
+    {
+        /*  Prepare XML document    */
+        result = tau_prepareXmlDoc(pFileName, &docHandle);
+        if (result != TRDP_NO_ERR)
+        {
+            printf("Failed to parse XML document\n");
+            return 1;
+        }
 
-    /*  Read general parameters from XML configuration*/
-    result = tau_readXmlDeviceConfig(
-        &docHandle, 
-        &memConfig, &dbgConfig, 
-        &numComPar, &pComPar, 
-        &numIfConfig, &pIfConfig);
+        /*  Read general parameters from XML configuration*/
+        result = tau_readXmlDeviceConfig(
+            &docHandle,
+            &memConfig, &dbgConfig,
+            &numComPar, &pComPar,
+            &numIfConfig, &pIfConfig);
+    }
     if (result == TRDP_NO_ERR)
     {
         /*  Print general parameters    */
@@ -341,9 +367,18 @@ int main(int argc, char * argv[])
     }
 
     /*  Read dataset configuration  */
-    result = tau_readXmlDatasetConfig(&docHandle, 
-        &numComId, &pComIdDsIdMap,
-        &numDataset, &apDataset);
+    if (useImage)
+    {
+        result = tau_readImageDatasetConfig(&imgHandle,
+            &numComId, &pComIdDsIdMap,
+            &numDataset, &apDataset);
+    }
+    else
+    {
+        result = tau_readXmlDatasetConfig(&docHandle,
+            &numComId, &pComIdDsIdMap,
+            &numDataset, &apDataset);
+    }
     if (result == TRDP_NO_ERR)
     {
         /*  Print dataset configuration */
@@ -364,10 +399,20 @@ int main(int argc, char * argv[])
         UINT32              numExchgPar = 0;
         TRDP_EXCHG_PAR_T    *pExchgPar = NULL;
         /*  Read telegrams configured for the interface */
-        result = tau_readXmlInterfaceConfig(
-            &docHandle, pIfConfig[ifIndex].ifName, 
-            &processConfig, &pdConfig, &mdConfig,
-            &numExchgPar, &pExchgPar);
+        if (useImage)
+        {
+            result = tau_readImageInterfaceConfig(
+                &imgHandle, pIfConfig[ifIndex].ifName,
+                &processConfig, &pdConfig, &mdConfig,
+                &numExchgPar, &pExchgPar);
+        }
+        else
+        {
+            result = tau_readXmlInterfaceConfig(
+                &docHandle, pIfConfig[ifIndex].ifName,
+                &processConfig, &pdConfig, &mdConfig,
+                &numExchgPar, &pExchgPar);
+        }
         if (result == TRDP_NO_ERR)
         {
             printf("%s interface configuration\n", 
@@ -379,10 +424,20 @@ int main(int argc, char * argv[])
             printTelegrams(pIfConfig[ifIndex].ifName, numExchgPar, pExchgPar);
             printf("\n");
             /*  Free allocated memory */
-            tau_freeTelegrams(numExchgPar, pExchgPar);
+            if (!useImage)
+            {
+                tau_freeTelegrams(numExchgPar, pExchgPar);
+            }
         }
     }
 
+    if (useImage)
+    {
+        /*  All configuration data is part of the image    */
+        tau_freeXmlImage(&imgHandle);
+        return 0;
+    }
+
     /*  Free parsed document    */
     tau_freeXmlDoc(&docHandle);
 